@@ -10,6 +10,9 @@ module;
 
 #include <Furud.hpp>
 #include <stdint.h>
+#include <array>
+#include <cmath>
+#include <span>
 
 
 
@@ -17,6 +20,8 @@ export module Furud.Core.Color;
 
 import Furud.Core.Matrix;
 import Furud.Core.Math;
+import Furud.Platform.Math;
+import Furud.Platform.SIMD;
 
 
 
@@ -94,5 +99,258 @@ export namespace Furud
 		{
 			return { uint8_t(color.x), uint8_t(color.y), uint8_t(color.z) };
 		}
+
+
+	public:
+		furud_nodiscard furud_inline Vector4f ToLinearVector() const
+		{
+			constexpr float INV_255 = 1.f / 255.f;
+			return { r * INV_255, g * INV_255, b * INV_255, a * INV_255 };
+		}
 	};
+}
+
+
+
+namespace Furud::Internal
+{
+	//****************************************************************
+	// Per-channel transfer functions (IEC 61966-2-1), alpha is always linear.
+	//****************************************************************
+
+	furud_inline float LinearToSRGB(const float& value) noexcept
+	{
+		const float v = value < 0.f ? 0.f : (value < 1.f ? value : 1.f);
+		return v <= 0.0031308f ? v * 12.92f : 1.055f * IMath::Pow(v, 1.f / 2.4f) - 0.055f;
+	}
+
+	furud_inline float SRGBToLinear(const float& value) noexcept
+	{
+		const float v = value < 0.f ? 0.f : (value < 1.f ? value : 1.f);
+		return v <= 0.04045f ? v * (1.f / 12.92f) : IMath::Pow((v + 0.055f) * (1.f / 1.055f), 2.4f);
+	}
+
+	furud_inline Vec8f LinearToSRGB(const Vec8f& value) noexcept
+	{
+		const Vec8f v = Min(Max(value, Vec8f(0.f)), Vec8f(1.f));
+		const Vec8f curve = MulAdd(Pow(v, Vec8f(1.f / 2.4f)), Vec8f(1.055f), Vec8f(-0.055f));
+		return Select(LessThanOrEqual(v, Vec8f(0.0031308f)), v * Vec8f(12.92f), curve);
+	}
+
+	furud_inline Vec8f SRGBToLinear(const Vec8f& value) noexcept
+	{
+		const Vec8f v = Min(Max(value, Vec8f(0.f)), Vec8f(1.f));
+		const Vec8f curve = Pow((v + Vec8f(0.055f)) * Vec8f(1.f / 1.055f), Vec8f(2.4f));
+		return Select(LessThanOrEqual(v, Vec8f(0.04045f)), v * Vec8f(1.f / 12.92f), curve);
+	}
+
+	/** Decoded sRGB for every 8-bit value, exact and cheaper than the curve. */
+	inline const std::array<float, 256> SRGB8ToLinearTable = []
+	{
+		std::array<float, 256> table;
+		for (size_t i = 0; i < table.size(); ++i)
+		{
+			table[i] = SRGBToLinear(static_cast<float>(i) * (1.f / 255.f));
+		}
+		return table;
+	}();
+
+	furud_inline uint8_t QuantizeChannel(const float& value) noexcept
+	{
+		const float v = value < 0.f ? 0.f : (value < 1.f ? value : 1.f);
+		return static_cast<uint8_t>(std::lrint(v * 255.f));
+	}
+
+
+	//****************************************************************
+	// Batch kernels over interleaved RGBA, each Vec8f holds two pixels.
+	// Pixels left over from the 8-wide loop go through the scalar path.
+	//****************************************************************
+
+	/** ( 0, 0, 0, ~0, 0, 0, 0, ~0 ), selects the alpha lanes. */
+	furud_inline Vec8f AlphaLanes() noexcept
+	{
+		return Equal(Vec8f(0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f), Vec8f(1.f));
+	}
+
+	template <bool bSRGB>
+	void EncodeColors(const Vector4f* in, Color* out, size_t num) noexcept
+	{
+		const float* src = &in->x;
+		uint8_t* dst = &out->r;
+		const size_t numFloats = num * 4;
+		const Vec8f alpha = AlphaLanes();
+		const Vec8f zero = 0.f;
+		const Vec8f one = 1.f;
+		const Vec8f scale = 255.f;
+
+		size_t i = 0;
+		for (Vec8f v; i + 8 <= numFloats; i += 8)
+		{
+			v.LoadUnaligned(src + i);
+			if constexpr (bSRGB)
+			{
+				v = Select(alpha, v, LinearToSRGB(v));
+			}
+			(Min(Max(v, zero), one) * scale).StoreUint8(dst + i);
+		}
+		for (size_t p = i / 4; p < num; ++p)
+		{
+			const Vector4f& c = in[p];
+			out[p] = bSRGB
+				? Color(QuantizeChannel(LinearToSRGB(c.x)), QuantizeChannel(LinearToSRGB(c.y)), QuantizeChannel(LinearToSRGB(c.z)), QuantizeChannel(c.w))
+				: Color(QuantizeChannel(c.x), QuantizeChannel(c.y), QuantizeChannel(c.z), QuantizeChannel(c.w));
+		}
+	}
+
+	inline void DecodeColors(const Color* in, Vector4f* out, size_t num) noexcept
+	{
+		const uint8_t* src = &in->r;
+		float* dst = &out->x;
+		const size_t numFloats = num * 4;
+		const Vec8f invScale = 1.f / 255.f;
+
+		size_t i = 0;
+		for (Vec8f v; i + 8 <= numFloats; i += 8)
+		{
+			(v.LoadUint8(src + i) * invScale).StoreUnaligned(dst + i);
+		}
+		for (size_t p = i / 4; p < num; ++p)
+		{
+			out[p] = in[p].ToLinearVector();
+		}
+	}
+
+	inline void DecodeSRGBColors(const Color* in, Vector4f* out, size_t num) noexcept
+	{
+		const std::array<float, 256>& table = SRGB8ToLinearTable;
+		for (size_t p = 0; p < num; ++p)
+		{
+			const Color c = in[p];
+			out[p] = { table[c.r], table[c.g], table[c.b], c.a * (1.f / 255.f) };
+		}
+	}
+
+	template <bool bToSRGB>
+	void ConvertSRGB(const Vector4f* in, Vector4f* out, size_t num) noexcept
+	{
+		const float* src = &in->x;
+		float* dst = &out->x;
+		const size_t numFloats = num * 4;
+		const Vec8f alpha = AlphaLanes();
+
+		size_t i = 0;
+		for (Vec8f v; i + 8 <= numFloats; i += 8)
+		{
+			v.LoadUnaligned(src + i);
+			Select(alpha, v, bToSRGB ? LinearToSRGB(v) : SRGBToLinear(v)).StoreUnaligned(dst + i);
+		}
+		for (size_t p = i / 4; p < num; ++p)
+		{
+			const Vector4f c = in[p];
+			out[p] = bToSRGB
+				? Vector4f { LinearToSRGB(c.x), LinearToSRGB(c.y), LinearToSRGB(c.z), c.w }
+				: Vector4f { SRGBToLinear(c.x), SRGBToLinear(c.y), SRGBToLinear(c.z), c.w };
+		}
+	}
+
+	template <bool bPremultiply>
+	void PremultiplyColors(const Vector4f* in, Vector4f* out, size_t num) noexcept
+	{
+		const float* src = &in->x;
+		float* dst = &out->x;
+		const size_t numFloats = num * 4;
+		const Vec8f alpha = AlphaLanes();
+		const Vec8f zero = 0.f;
+		const Vec8f one = 1.f;
+
+		size_t i = 0;
+		for (Vec8f v; i + 8 <= numFloats; i += 8)
+		{
+			v.LoadUnaligned(src + i);
+			Vec8f factor = v.Swizzle<3, 3, 3, 3>();
+			if constexpr (!bPremultiply)
+			{
+				factor = Select(Equal(factor, zero), zero, one / factor);
+			}
+			(v * Select(alpha, one, factor)).StoreUnaligned(dst + i);
+		}
+		for (size_t p = i / 4; p < num; ++p)
+		{
+			const Vector4f c = in[p];
+			const float factor = bPremultiply ? c.w : (c.w == 0.f ? 0.f : 1.f / c.w);
+			out[p] = { c.x * factor, c.y * factor, c.z * factor, c.w };
+		}
+	}
+
+	template <bool bPremultiply>
+	void PremultiplyColors(const Color* in, Color* out, size_t num) noexcept
+	{
+		const uint8_t* src = &in->r;
+		uint8_t* dst = &out->r;
+		const size_t numBytes = num * 4;
+		const Vec8f alpha = AlphaLanes();
+		const Vec8f zero = 0.f;
+		const Vec8f one = 1.f;
+		const Vec8f scale = 255.f;
+
+		size_t i = 0;
+		for (Vec8f v; i + 8 <= numBytes; i += 8)
+		{
+			v.LoadUint8(src + i);
+			Vec8f factor = v.Swizzle<3, 3, 3, 3>();
+			factor = bPremultiply
+				? factor / scale
+				: Select(Equal(factor, zero), zero, scale / factor);
+			Min(v * Select(alpha, one, factor), scale).StoreUint8(dst + i);
+		}
+		for (size_t p = i / 4; p < num; ++p)
+		{
+			const Color c = in[p];
+			const float factor = bPremultiply ? c.a / 255.f : (c.a == 0 ? 0.f : 255.f / c.a);
+			const auto channel = [factor](const uint8_t& value) -> uint8_t
+			{
+				const float v = value * factor;
+				return static_cast<uint8_t>(std::lrint(v < 255.f ? v : 255.f));
+			};
+			out[p] = Color(channel(c.r), channel(c.g), channel(c.b), c.a);
+		}
+	}
+}
+
+
+
+/** Batched color conversions, `out` must be at least as long as `in` and may be `in` itself. */
+export namespace Furud::IColor
+{
+	//****************************************************************
+	// @brief    Converts linear float colors to RGBA8 and back, rounding to nearest.
+	// @details  批量线性颜色与 RGBA8 互转。
+	//****************************************************************
+
+	inline void LinearToColors(std::span<const Vector4f> in, std::span<Color> out) noexcept { Internal::EncodeColors<false>(in.data(), out.data(), in.size()); }
+	inline void ColorsToLinear(std::span<const Color> in, std::span<Vector4f> out) noexcept { Internal::DecodeColors(in.data(), out.data(), in.size()); }
+
+
+	//****************************************************************
+	// @brief    Applies the sRGB transfer function to rgb, alpha stays linear.
+	//           8-bit decoding goes through a 256-entry table, the rest through the Vec8f curve.
+	// @details  批量 sRGB 编码与解码。
+	//****************************************************************
+
+	inline void LinearToSRGBColors(std::span<const Vector4f> in, std::span<Color> out) noexcept { Internal::EncodeColors<true>(in.data(), out.data(), in.size()); }
+	inline void SRGBColorsToLinear(std::span<const Color> in, std::span<Vector4f> out) noexcept { Internal::DecodeSRGBColors(in.data(), out.data(), in.size()); }
+	inline void LinearToSRGB(std::span<const Vector4f> in, std::span<Vector4f> out) noexcept { Internal::ConvertSRGB<true>(in.data(), out.data(), in.size()); }
+	inline void SRGBToLinear(std::span<const Vector4f> in, std::span<Vector4f> out) noexcept { Internal::ConvertSRGB<false>(in.data(), out.data(), in.size()); }
+
+
+	//****************************************************************
+	// @brief    Multiplies rgb by alpha, or divides it back ( zero alpha gives black ).
+	// @details  批量预乘与反预乘透明度。
+	//****************************************************************
+
+	inline void Premultiply(std::span<const Vector4f> in, std::span<Vector4f> out) noexcept { Internal::PremultiplyColors<true>(in.data(), out.data(), in.size()); }
+	inline void Unpremultiply(std::span<const Vector4f> in, std::span<Vector4f> out) noexcept { Internal::PremultiplyColors<false>(in.data(), out.data(), in.size()); }
+	inline void Premultiply(std::span<const Color> in, std::span<Color> out) noexcept { Internal::PremultiplyColors<true>(in.data(), out.data(), in.size()); }
+	inline void Unpremultiply(std::span<const Color> in, std::span<Color> out) noexcept { Internal::PremultiplyColors<false>(in.data(), out.data(), in.size()); }
 }
\ No newline at end of file
@@ -10,6 +10,7 @@ module;
 
 #include <Furud.hpp>
 #include <cstdint>
+#include <span>
 
 
 
@@ -18,6 +19,102 @@ export module Furud.Core.Matrix:Matrix;
 export import :Vector4;
 export import Furud.Numbers;
 import Furud.Platform.SIMD;
+import Furud.Platform.Thread.Parallel;
+
+
+
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Transforms 8 packed Vector3f per iteration as row vectors, all 16 matrix terms stay in registers.
+	 * @details  批量变换实现。
+	 *
+	 * - bPosition    w = 1, otherwise w = 0 (directions).
+	 * - bHomogenize  divides by the transformed w, only meaningful for positions under projective matrices.
+	 */
+	template <bool bPosition, bool bHomogenize>
+	void TransformVector3Batch(const float (&m)[4][4], const Vector3f* in, Vector3f* out, size_t num) noexcept
+	{
+		const Vec8f m00 = m[0][0], m01 = m[0][1], m02 = m[0][2], m03 = m[0][3];
+		const Vec8f m10 = m[1][0], m11 = m[1][1], m12 = m[1][2], m13 = m[1][3];
+		const Vec8f m20 = m[2][0], m21 = m[2][1], m22 = m[2][2], m23 = m[2][3];
+		const Vec8f m30 = m[3][0], m31 = m[3][1], m32 = m[3][2], m33 = m[3][3];
+
+		size_t i = 0;
+		for (; i + 8 <= num; i += 8)
+		{
+			Vec8f x, y, z;
+			LoadDeinterleave3(&in[i].x, x, y, z);
+
+			Vec8f rx = MulAdd(z, m20, MulAdd(y, m10, x * m00));
+			Vec8f ry = MulAdd(z, m21, MulAdd(y, m11, x * m01));
+			Vec8f rz = MulAdd(z, m22, MulAdd(y, m12, x * m02));
+			if constexpr (bPosition)
+			{
+				rx += m30;
+				ry += m31;
+				rz += m32;
+			}
+			if constexpr (bPosition && bHomogenize)
+			{
+				const Vec8f rw = MulAdd(z, m23, MulAdd(y, m13, MulAdd(x, m03, m33)));
+				rx /= rw;
+				ry /= rw;
+				rz /= rw;
+			}
+
+			StoreInterleave3(&out[i].x, rx, ry, rz);
+		}
+
+		for (; i < num; ++i)
+		{
+			const float x = in[i].x;
+			const float y = in[i].y;
+			const float z = in[i].z;
+			float rx = x * m[0][0] + y * m[1][0] + z * m[2][0];
+			float ry = x * m[0][1] + y * m[1][1] + z * m[2][1];
+			float rz = x * m[0][2] + y * m[1][2] + z * m[2][2];
+			if constexpr (bPosition)
+			{
+				rx += m[3][0];
+				ry += m[3][1];
+				rz += m[3][2];
+			}
+			if constexpr (bPosition && bHomogenize)
+			{
+				const float rw = x * m[0][3] + y * m[1][3] + z * m[2][3] + m[3][3];
+				rx /= rw;
+				ry /= rw;
+				rz /= rw;
+			}
+			out[i] = { rx, ry, rz };
+		}
+	}
+
+
+	/**
+	 * @brief    Splits a batch transform into chunks run by IParallel::For.
+	 * @details  并行批量变换。Chunks are multiples of 8 so that only the last one has a scalar tail.
+	 */
+	template <bool bPosition, bool bHomogenize>
+	void ParallelTransformVector3Batch(const float (&m)[4][4], const Vector3f* in, Vector3f* out, size_t num, size_t chunkSize) noexcept
+	{
+		chunkSize = (chunkSize + 7) & ~size_t(7);
+		if (num <= chunkSize)
+		{
+			TransformVector3Batch<bPosition, bHomogenize>(m, in, out, num);
+			return;
+		}
+
+		const int32_t numChunks = static_cast<int32_t>((num + chunkSize - 1) / chunkSize);
+		IParallel::For(numChunks, [&](int32_t chunk)
+		{
+			const size_t first = static_cast<size_t>(chunk) * chunkSize;
+			const size_t count = num - first < chunkSize ? num - first : chunkSize;
+			TransformVector3Batch<bPosition, bHomogenize>(m, in + first, out + first, count);
+		});
+	}
+}
 
 
 
@@ -203,6 +300,19 @@ export namespace Furud
 			return *this;
 		}
 
+		furud_nodiscard furud_inline Matrix44f operator * (Matrix44f const& rhs) const noexcept
+		{
+			Matrix44f result;
+			Mat44f::Multiply(this, &rhs, &result);
+			return result;
+		}
+
+		furud_inline Matrix44f const& operator *= (Matrix44f const& rhs) noexcept
+		{
+			Mat44f::Multiply(this, &rhs, this);
+			return *this;
+		}
+
 
 	public:
 		furud_nodiscard furud_inline Matrix44f Transpose() const noexcept
@@ -219,6 +329,13 @@ export namespace Furud
 			return result;
 		}
 
+		furud_nodiscard furud_inline Matrix44f InverseAffine() const noexcept
+		{
+			Matrix44f result;
+			result.AsMat4() = AsMat4().InverseAffine();
+			return result;
+		}
+
 
 	public:
 		furud_nodiscard furud_inline Vector3f TransformPosition3(Vector3f const& rhs) const noexcept
@@ -300,8 +417,151 @@ export namespace Furud
 			(v * m).Store4(&result);
 			return result;
 		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Transforms a span of vectors, 8 at a time.
+		//           `out` must be at least as long as `in`, and may be `in` itself (but no other overlap).
+		//           TransformPositions    w = 1, divides by the transformed w like TransformPosition3.
+		//           TransformPositionsAffine   w = 1, skips the divide, for matrices whose last column is (0, 0, 0, 1).
+		//           TransformVectors      w = 0, like TransformVector3.
+		// @details  批量变换。
+		//****************************************************************
+
+		furud_inline void TransformPositions(std::span<const Vector3f> in, std::span<Vector3f> out) const noexcept
+		{
+			Internal::TransformVector3Batch<true, true>(m, in.data(), out.data(), in.size());
+		}
+
+		furud_inline void TransformPositionsAffine(std::span<const Vector3f> in, std::span<Vector3f> out) const noexcept
+		{
+			Internal::TransformVector3Batch<true, false>(m, in.data(), out.data(), in.size());
+		}
+
+		furud_inline void TransformVectors(std::span<const Vector3f> in, std::span<Vector3f> out) const noexcept
+		{
+			Internal::TransformVector3Batch<false, false>(m, in.data(), out.data(), in.size());
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Same as above, split into chunks of `chunkSize` vectors over the job system.
+		//           Spans no longer than one chunk are transformed on the calling thread.
+		// @details  并行批量变换。
+		//****************************************************************
+
+		static constexpr size_t ParallelTransformChunkSize = 4096;
+
+		furud_inline void ParallelTransformPositions(std::span<const Vector3f> in, std::span<Vector3f> out, size_t chunkSize = ParallelTransformChunkSize) const noexcept
+		{
+			Internal::ParallelTransformVector3Batch<true, true>(m, in.data(), out.data(), in.size(), chunkSize);
+		}
+
+		furud_inline void ParallelTransformPositionsAffine(std::span<const Vector3f> in, std::span<Vector3f> out, size_t chunkSize = ParallelTransformChunkSize) const noexcept
+		{
+			Internal::ParallelTransformVector3Batch<true, false>(m, in.data(), out.data(), in.size(), chunkSize);
+		}
+
+		furud_inline void ParallelTransformVectors(std::span<const Vector3f> in, std::span<Vector3f> out, size_t chunkSize = ParallelTransformChunkSize) const noexcept
+		{
+			Internal::ParallelTransformVector3Batch<false, false>(m, in.data(), out.data(), in.size(), chunkSize);
+		}
 	};
 
 
 	const Matrix44f Matrix44f::IDENTITY = 1.f;
+}
+
+
+
+/** Batched matrix operations. */
+export namespace Furud::IMatrix
+{
+	/**
+	 * @brief    Multiplies matrices pairwise, ( out[i] = lhs[i] * rhs[i] ).
+	 * @details  批量矩阵乘法。`out` may be `lhs` or `rhs` itself.
+	 */
+	inline void Multiply(std::span<const Matrix44f> lhs, std::span<const Matrix44f> rhs, std::span<Matrix44f> out) noexcept
+	{
+		const size_t num = lhs.size();
+		size_t i = 0;
+		for (; i + 2 <= num; i += 2)
+		{
+			Mat44f::Multiply(&lhs[i], &rhs[i], &out[i]);
+			Mat44f::Multiply(&lhs[i + 1], &rhs[i + 1], &out[i + 1]);
+		}
+		if (i < num)
+		{
+			Mat44f::Multiply(&lhs[i], &rhs[i], &out[i]);
+		}
+	}
+
+
+	/**
+	 * @brief    Multiplies every matrix by the same one, ( out[i] = lhs[i] * rhs ).
+	 * @details  批量矩阵乘法（共用右矩阵）。
+	 */
+	inline void Multiply(std::span<const Matrix44f> lhs, const Matrix44f& rhs, std::span<Matrix44f> out) noexcept
+	{
+		const size_t num = lhs.size();
+		size_t i = 0;
+		for (; i + 2 <= num; i += 2)
+		{
+			Mat44f::Multiply(&lhs[i], &rhs, &out[i]);
+			Mat44f::Multiply(&lhs[i + 1], &rhs, &out[i + 1]);
+		}
+		if (i < num)
+		{
+			Mat44f::Multiply(&lhs[i], &rhs, &out[i]);
+		}
+	}
+
+
+	/**
+	 * @brief    Propagates local transforms down a hierarchy, ( world[i] = local[i] * world[parents[i]] ).
+	 * @details  层级世界矩阵计算。
+	 *
+	 * - Nodes must be sorted so that every parent comes before its children ( parents[i] < i ).
+	 * - A negative parent index marks a root, whose world matrix is its local one.
+	 */
+	inline void PropagateHierarchy(std::span<const Matrix44f> local, std::span<const int32_t> parents, std::span<Matrix44f> world) noexcept
+	{
+		const size_t num = local.size();
+		for (size_t i = 0; i < num; ++i)
+		{
+			const int32_t parent = parents[i];
+			if (parent < 0)
+			{
+				Mat44f::Copy(&local[i], &world[i]);
+			}
+			else
+			{
+				Mat44f::Multiply(&local[i], &world[parent], &world[i]);
+			}
+		}
+	}
+
+
+	/**
+	 * @brief    Inverts affine matrices ( last column is (0, 0, 0, 1) ), see Matrix44f::InverseAffine.
+	 * @details  批量仿射矩阵求逆。`out` may be `in` itself.
+	 */
+	inline void InverseAffine(std::span<const Matrix44f> in, std::span<Matrix44f> out) noexcept
+	{
+		const size_t num = in.size();
+		size_t i = 0;
+		for (; i + 2 <= num; i += 2)
+		{
+			const Mat44f m0 = in[i].AsMat4().InverseAffine();
+			const Mat44f m1 = in[i + 1].AsMat4().InverseAffine();
+			out[i].AsMat4() = m0;
+			out[i + 1].AsMat4() = m1;
+		}
+		if (i < num)
+		{
+			out[i].AsMat4() = in[i].AsMat4().InverseAffine();
+		}
+	}
 }
\ No newline at end of file
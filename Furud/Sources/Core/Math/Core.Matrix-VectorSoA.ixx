@@ -0,0 +1,675 @@
+//
+// Core.Matrix-VectorSoA.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Structure-of-arrays vector batches.
+//
+module;
+
+#include <Furud.hpp>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <new>
+#include <type_traits>
+
+
+
+export module Furud.Core.Matrix:VectorSoA;
+
+import :Vector3;
+import :Vector4;
+import Furud.Numbers;
+import Furud.Platform.SIMD;
+
+
+
+/** Wide views. */
+export namespace Furud
+{
+	/**
+	 * @brief    A non-owning view of N float streams holding `size` vectors, component c of vector i at streams[c][i].
+	 * @details  结构数组视图。TFloat is `float` for writable views and `const float` for read-only ones.
+	 */
+	template <typename TFloat, size_t N>
+	struct TVectorSoAView
+	{
+		static_assert(N == 3 || N == 4, "[Furud] only 3 and 4 component batches are supported.");
+
+		using TElement = std::conditional_t<N == 3, Vector3f, Vector4f>;
+
+		TFloat* streams[N] = {};
+		size_t size = 0;
+
+
+	public:
+		constexpr TVectorSoAView() noexcept = default;
+
+		constexpr TVectorSoAView(TFloat* x, TFloat* y, TFloat* z, size_t count) noexcept requires (N == 3)
+			: streams{ x, y, z }, size(count)
+		{}
+
+		constexpr TVectorSoAView(TFloat* x, TFloat* y, TFloat* z, TFloat* w, size_t count) noexcept requires (N == 4)
+			: streams{ x, y, z, w }, size(count)
+		{}
+
+		/** Writable views convert to read-only ones. */
+		constexpr operator TVectorSoAView<const float, N>() const noexcept requires (!std::is_const_v<TFloat>)
+		{
+			TVectorSoAView<const float, N> result;
+			for (size_t c = 0; c < N; ++c)
+			{
+				result.streams[c] = streams[c];
+			}
+			result.size = size;
+			return result;
+		}
+
+
+	public:
+		/** Returns the view of `count` vectors starting at `offset`, e.g. one chunk of a parallel loop. */
+		furud_nodiscard constexpr TVectorSoAView Slice(size_t offset, size_t count) const noexcept
+		{
+			TVectorSoAView result;
+			for (size_t c = 0; c < N; ++c)
+			{
+				result.streams[c] = streams[c] + offset;
+			}
+			result.size = count;
+			return result;
+		}
+
+		furud_nodiscard furud_inline TElement Get(size_t index) const noexcept
+		{
+			if constexpr (N == 3)
+			{
+				return { streams[0][index], streams[1][index], streams[2][index] };
+			}
+			else
+			{
+				return { streams[0][index], streams[1][index], streams[2][index], streams[3][index] };
+			}
+		}
+
+		furud_inline void Set(size_t index, const TElement& value) const noexcept requires (!std::is_const_v<TFloat>)
+		{
+			streams[0][index] = value.x;
+			streams[1][index] = value.y;
+			streams[2][index] = value.z;
+			if constexpr (N == 4)
+			{
+				streams[3][index] = value.w;
+			}
+		}
+	};
+
+
+	using Vector3fSoAView      = TVectorSoAView<float, 3>;
+	using Vector3fSoAConstView = TVectorSoAView<const float, 3>;
+	using Vector4fSoAView      = TVectorSoAView<float, 4>;
+	using Vector4fSoAConstView = TVectorSoAView<const float, 4>;
+}
+
+
+
+/** Containers. */
+export namespace Furud
+{
+	/**
+	 * @brief    Owns N float streams in one 64-byte aligned block.
+	 * @details  结构数组容器。Every stream starts on a 64-byte boundary and its capacity is a multiple
+	 *           of 16, so full Vec8f/Vec16f loads of a stream never cross into the next one.
+	 */
+	template <size_t N>
+	class TVectorfSoA
+	{
+		static_assert(N == 3 || N == 4, "[Furud] only 3 and 4 component batches are supported.");
+
+	public:
+		using TElement   = std::conditional_t<N == 3, Vector3f, Vector4f>;
+		using TView      = TVectorSoAView<float, N>;
+		using TConstView = TVectorSoAView<const float, N>;
+
+		static constexpr size_t StreamAlignment = 64;
+		static constexpr size_t StreamGranularity = 16;
+
+
+	private:
+		float* data = nullptr;
+		size_t size = 0;
+		size_t capacity = 0;
+
+
+	public:
+		constexpr TVectorfSoA() noexcept = default;
+
+		explicit TVectorfSoA(size_t count)
+		{
+			Resize(count);
+		}
+
+		TVectorfSoA(const TVectorfSoA& other)
+		{
+			Reserve(other.size);
+			for (size_t c = 0; c < N && other.size > 0; ++c)
+			{
+				memcpy(data + c * capacity, other.data + c * other.capacity, other.size * sizeof(float));
+			}
+			size = other.size;
+		}
+
+		TVectorfSoA(TVectorfSoA&& other) noexcept
+			: data(other.data), size(other.size), capacity(other.capacity)
+		{
+			other.data = nullptr;
+			other.size = 0;
+			other.capacity = 0;
+		}
+
+		TVectorfSoA& operator = (const TVectorfSoA& other)
+		{
+			if (this != &other)
+			{
+				TVectorfSoA copy(other);
+				*this = static_cast<TVectorfSoA&&>(copy);
+			}
+			return *this;
+		}
+
+		TVectorfSoA& operator = (TVectorfSoA&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Release();
+				data = other.data;
+				size = other.size;
+				capacity = other.capacity;
+				other.data = nullptr;
+				other.size = 0;
+				other.capacity = 0;
+			}
+			return *this;
+		}
+
+		~TVectorfSoA()
+		{
+			Release();
+		}
+
+
+	public:
+		furud_nodiscard furud_inline size_t Size() const noexcept { return size; }
+		furud_nodiscard furud_inline size_t Capacity() const noexcept { return capacity; }
+		furud_nodiscard furud_inline bool IsEmpty() const noexcept { return size == 0; }
+
+		furud_nodiscard furud_inline float* Stream(size_t component) noexcept { return data + component * capacity; }
+		furud_nodiscard furud_inline const float* Stream(size_t component) const noexcept { return data + component * capacity; }
+
+		furud_nodiscard furud_inline float* X() noexcept { return Stream(0); }
+		furud_nodiscard furud_inline float* Y() noexcept { return Stream(1); }
+		furud_nodiscard furud_inline float* Z() noexcept { return Stream(2); }
+		furud_nodiscard furud_inline float* W() noexcept requires (N == 4) { return Stream(3); }
+
+		furud_nodiscard furud_inline TView View() noexcept
+		{
+			TView result;
+			for (size_t c = 0; c < N; ++c)
+			{
+				result.streams[c] = Stream(c);
+			}
+			result.size = size;
+			return result;
+		}
+
+		furud_nodiscard furud_inline TConstView View() const noexcept
+		{
+			TConstView result;
+			for (size_t c = 0; c < N; ++c)
+			{
+				result.streams[c] = Stream(c);
+			}
+			result.size = size;
+			return result;
+		}
+
+		furud_nodiscard furud_inline TElement Get(size_t index) const noexcept { return View().Get(index); }
+
+		furud_inline void Set(size_t index, const TElement& value) noexcept { View().Set(index, value); }
+
+
+	public:
+		/** Grows the streams to hold at least `count` vectors, keeping the contents. */
+		void Reserve(size_t count)
+		{
+			if (count <= capacity)
+			{
+				return;
+			}
+
+			size_t newCapacity = capacity ? capacity : StreamGranularity;
+			while (newCapacity < count)
+			{
+				newCapacity *= 2;
+			}
+
+			float* newData = static_cast<float*>(::operator new(N * newCapacity * sizeof(float), std::align_val_t(StreamAlignment)));
+			memset(newData, 0, N * newCapacity * sizeof(float));
+			for (size_t c = 0; c < N && size > 0; ++c)
+			{
+				memcpy(newData + c * newCapacity, data + c * capacity, size * sizeof(float));
+			}
+
+			Release();
+			data = newData;
+			capacity = newCapacity;
+		}
+
+		/** Resizes to `count` vectors, new vectors are zero. */
+		void Resize(size_t count)
+		{
+			Reserve(count);
+			if (count > size)
+			{
+				for (size_t c = 0; c < N; ++c)
+				{
+					memset(Stream(c) + size, 0, (count - size) * sizeof(float));
+				}
+			}
+			size = count;
+		}
+
+		void Clear() noexcept
+		{
+			size = 0;
+		}
+
+		void PushBack(const TElement& value)
+		{
+			if (size == capacity) furud_unlikely
+			{
+				Reserve(size + 1);
+			}
+			++size;
+			Set(size - 1, value);
+		}
+
+
+	private:
+		void Release() noexcept
+		{
+			if (data)
+			{
+				::operator delete(data, std::align_val_t(StreamAlignment));
+				data = nullptr;
+			}
+			capacity = 0;
+		}
+	};
+
+
+	using Vector3fSoA = TVectorfSoA<3>;
+	using Vector4fSoA = TVectorfSoA<4>;
+}
+
+
+
+namespace Furud::Internal
+{
+	//****************************************************************
+	// Batch kernels, written once over the lane type so that the same body serves
+	// Vec8f (compiled baseline) and Vec16f (AVX-512, picked at runtime).
+	// Each iteration loads every input before storing, so outputs may alias inputs.
+	//****************************************************************
+
+	template <typename TWide, size_t N>
+	furud_noinline void SoADotProduct(const TVectorSoAView<const float, N>& lhs, const TVectorSoAView<const float, N>& rhs, float* out) noexcept
+	{
+		constexpr size_t Lanes = sizeof(TWide) / sizeof(float);
+		for (size_t i = 0; i < lhs.size; i += Lanes)
+		{
+			const size_t count = lhs.size - i;
+			TWide l, r;
+			TWide sum = l.LoadPartial(lhs.streams[0] + i, count) * r.LoadPartial(rhs.streams[0] + i, count);
+			for (size_t c = 1; c < N; ++c)
+			{
+				sum = MulAdd(l.LoadPartial(lhs.streams[c] + i, count), r.LoadPartial(rhs.streams[c] + i, count), sum);
+			}
+			sum.StorePartial(out + i, count);
+		}
+	}
+
+
+	template <typename TWide, size_t N>
+	furud_noinline void SoALength(const TVectorSoAView<const float, N>& value, float* out) noexcept
+	{
+		constexpr size_t Lanes = sizeof(TWide) / sizeof(float);
+		for (size_t i = 0; i < value.size; i += Lanes)
+		{
+			const size_t count = value.size - i;
+			TWide v;
+			TWide sum = v.LoadPartial(value.streams[0] + i, count).Squares();
+			for (size_t c = 1; c < N; ++c)
+			{
+				v.LoadPartial(value.streams[c] + i, count);
+				sum = MulAdd(v, v, sum);
+			}
+			sum.Sqrt().StorePartial(out + i, count);
+		}
+	}
+
+
+	template <typename TWide, size_t N>
+	furud_noinline void SoANormalize(const TVectorSoAView<const float, N>& value, const TVectorSoAView<float, N>& out, float tolerance) noexcept
+	{
+		constexpr size_t Lanes = sizeof(TWide) / sizeof(float);
+		for (size_t i = 0; i < value.size; i += Lanes)
+		{
+			const size_t count = value.size - i;
+			TWide v[N];
+			TWide sum = v[0].LoadPartial(value.streams[0] + i, count).Squares();
+			for (size_t c = 1; c < N; ++c)
+			{
+				sum = MulAdd(v[c].LoadPartial(value.streams[c] + i, count), v[c], sum);
+			}
+
+			// Vectors at or below the tolerance are passed through, like Vector3f::Normalize().
+			const TWide scale = Select(GreaterThan(sum, TWide(tolerance)), TWide(1.f) / sum.Sqrt(), TWide(1.f));
+			for (size_t c = 0; c < N; ++c)
+			{
+				(v[c] * scale).StorePartial(out.streams[c] + i, count);
+			}
+		}
+	}
+
+
+	template <typename TWide>
+	furud_noinline void SoACrossProduct(const TVectorSoAView<const float, 3>& lhs, const TVectorSoAView<const float, 3>& rhs, const TVectorSoAView<float, 3>& out) noexcept
+	{
+		constexpr size_t Lanes = sizeof(TWide) / sizeof(float);
+		for (size_t i = 0; i < lhs.size; i += Lanes)
+		{
+			const size_t count = lhs.size - i;
+			TWide lx, ly, lz, rx, ry, rz;
+			lx.LoadPartial(lhs.streams[0] + i, count);
+			ly.LoadPartial(lhs.streams[1] + i, count);
+			lz.LoadPartial(lhs.streams[2] + i, count);
+			rx.LoadPartial(rhs.streams[0] + i, count);
+			ry.LoadPartial(rhs.streams[1] + i, count);
+			rz.LoadPartial(rhs.streams[2] + i, count);
+			(ly * rz - lz * ry).StorePartial(out.streams[0] + i, count);
+			(lz * rx - lx * rz).StorePartial(out.streams[1] + i, count);
+			(lx * ry - ly * rx).StorePartial(out.streams[2] + i, count);
+		}
+	}
+
+
+	template <typename TWide, size_t N>
+	furud_noinline void SoALerp(const TVectorSoAView<const float, N>& lhs, const TVectorSoAView<const float, N>& rhs, float alpha, const TVectorSoAView<float, N>& out) noexcept
+	{
+		constexpr size_t Lanes = sizeof(TWide) / sizeof(float);
+		const TWide t = alpha;
+		for (size_t i = 0; i < lhs.size; i += Lanes)
+		{
+			const size_t count = lhs.size - i;
+			TWide l[N], r[N];
+			for (size_t c = 0; c < N; ++c)
+			{
+				l[c].LoadPartial(lhs.streams[c] + i, count);
+				r[c].LoadPartial(rhs.streams[c] + i, count);
+			}
+			for (size_t c = 0; c < N; ++c)
+			{
+				MulAdd(r[c] - l[c], t, l[c]).StorePartial(out.streams[c] + i, count);
+			}
+		}
+	}
+
+
+	template <typename TWide, size_t N>
+	furud_noinline void SoAClamp(const TVectorSoAView<const float, N>& value, float minValue, float maxValue, const TVectorSoAView<float, N>& out) noexcept
+	{
+		constexpr size_t Lanes = sizeof(TWide) / sizeof(float);
+		const TWide lo = minValue;
+		const TWide hi = maxValue;
+		for (size_t i = 0; i < value.size; i += Lanes)
+		{
+			const size_t count = value.size - i;
+			TWide v;
+			for (size_t c = 0; c < N; ++c)
+			{
+				Min(Max(v.LoadPartial(value.streams[c] + i, count), lo), hi).StorePartial(out.streams[c] + i, count);
+			}
+		}
+	}
+
+
+
+	// gcc/clang take the target of an instantiation from where it is instantiated explicitly,
+	// so the 16-wide kernels are pinned here under AVX-512 (the members of Vec16f require it).
+	// The portable backend has no Vec16f.
+#if !FURUD_SIMD_PORTABLE
+#if FURUD_OS_LINUX && !defined(__AVX512F__)
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512dq,avx512bw,avx512vl,avx2,fma")
+#endif
+	template void SoADotProduct<Vec16f, 3>(const TVectorSoAView<const float, 3>&, const TVectorSoAView<const float, 3>&, float*) noexcept;
+	template void SoADotProduct<Vec16f, 4>(const TVectorSoAView<const float, 4>&, const TVectorSoAView<const float, 4>&, float*) noexcept;
+	template void SoALength<Vec16f, 3>(const TVectorSoAView<const float, 3>&, float*) noexcept;
+	template void SoALength<Vec16f, 4>(const TVectorSoAView<const float, 4>&, float*) noexcept;
+	template void SoANormalize<Vec16f, 3>(const TVectorSoAView<const float, 3>&, const TVectorSoAView<float, 3>&, float) noexcept;
+	template void SoANormalize<Vec16f, 4>(const TVectorSoAView<const float, 4>&, const TVectorSoAView<float, 4>&, float) noexcept;
+	template void SoACrossProduct<Vec16f>(const TVectorSoAView<const float, 3>&, const TVectorSoAView<const float, 3>&, const TVectorSoAView<float, 3>&) noexcept;
+	template void SoALerp<Vec16f, 3>(const TVectorSoAView<const float, 3>&, const TVectorSoAView<const float, 3>&, float, const TVectorSoAView<float, 3>&) noexcept;
+	template void SoALerp<Vec16f, 4>(const TVectorSoAView<const float, 4>&, const TVectorSoAView<const float, 4>&, float, const TVectorSoAView<float, 4>&) noexcept;
+	template void SoAClamp<Vec16f, 3>(const TVectorSoAView<const float, 3>&, float, float, const TVectorSoAView<float, 3>&) noexcept;
+	template void SoAClamp<Vec16f, 4>(const TVectorSoAView<const float, 4>&, float, float, const TVectorSoAView<float, 4>&) noexcept;
+#if FURUD_OS_LINUX && !defined(__AVX512F__)
+#pragma GCC pop_options
+#endif
+#endif
+
+
+
+	template <size_t N>
+	inline TSimdDispatch<void(const TVectorSoAView<const float, N>&, const TVectorSoAView<const float, N>&, float*)> SoADotProductKernels
+	{
+		{ CompiledSimdLevel, &SoADotProduct<Vec8f, N> },
+#if !FURUD_SIMD_PORTABLE
+		{ ESimdLevel::AVX512, &SoADotProduct<Vec16f, N> },
+#endif
+	};
+
+	template <size_t N>
+	inline TSimdDispatch<void(const TVectorSoAView<const float, N>&, float*)> SoALengthKernels
+	{
+		{ CompiledSimdLevel, &SoALength<Vec8f, N> },
+#if !FURUD_SIMD_PORTABLE
+		{ ESimdLevel::AVX512, &SoALength<Vec16f, N> },
+#endif
+	};
+
+	template <size_t N>
+	inline TSimdDispatch<void(const TVectorSoAView<const float, N>&, const TVectorSoAView<float, N>&, float)> SoANormalizeKernels
+	{
+		{ CompiledSimdLevel, &SoANormalize<Vec8f, N> },
+#if !FURUD_SIMD_PORTABLE
+		{ ESimdLevel::AVX512, &SoANormalize<Vec16f, N> },
+#endif
+	};
+
+	inline TSimdDispatch<void(const TVectorSoAView<const float, 3>&, const TVectorSoAView<const float, 3>&, const TVectorSoAView<float, 3>&)> SoACrossProductKernels
+	{
+		{ CompiledSimdLevel, &SoACrossProduct<Vec8f> },
+#if !FURUD_SIMD_PORTABLE
+		{ ESimdLevel::AVX512, &SoACrossProduct<Vec16f> },
+#endif
+	};
+
+	template <size_t N>
+	inline TSimdDispatch<void(const TVectorSoAView<const float, N>&, const TVectorSoAView<const float, N>&, float, const TVectorSoAView<float, N>&)> SoALerpKernels
+	{
+		{ CompiledSimdLevel, &SoALerp<Vec8f, N> },
+#if !FURUD_SIMD_PORTABLE
+		{ ESimdLevel::AVX512, &SoALerp<Vec16f, N> },
+#endif
+	};
+
+	template <size_t N>
+	inline TSimdDispatch<void(const TVectorSoAView<const float, N>&, float, float, const TVectorSoAView<float, N>&)> SoAClampKernels
+	{
+		{ CompiledSimdLevel, &SoAClamp<Vec8f, N> },
+#if !FURUD_SIMD_PORTABLE
+		{ ESimdLevel::AVX512, &SoAClamp<Vec16f, N> },
+#endif
+	};
+}
+
+
+
+/** Batched operations. */
+export namespace Furud::ISoA
+{
+	//****************************************************************
+	// @brief    Transposes `out.size` (`in.size`) packed vectors into SoA streams, and back.
+	// @details  数组结构与结构数组互转。
+	//****************************************************************
+
+	furud_inline void FromAoS(const Vector3f* furud_restrict aos, const Vector3fSoAView& out) noexcept
+	{
+		static_assert(sizeof(Vector3f) == 3 * sizeof(float));
+		const float* furud_restrict data = &aos->x;
+		size_t i = 0;
+		for (; i + 8 <= out.size; i += 8)
+		{
+			Vec8f x, y, z;
+			LoadDeinterleave3(data + i * 3, x, y, z);
+			x.StoreUnaligned(out.streams[0] + i);
+			y.StoreUnaligned(out.streams[1] + i);
+			z.StoreUnaligned(out.streams[2] + i);
+		}
+		for (; i < out.size; ++i)
+		{
+			out.Set(i, aos[i]);
+		}
+	}
+
+	furud_inline void FromAoS(const Vector4f* furud_restrict aos, const Vector4fSoAView& out) noexcept
+	{
+		static_assert(sizeof(Vector4f) == 4 * sizeof(float));
+		const float* furud_restrict data = &aos->x;
+		size_t i = 0;
+		for (; i + 8 <= out.size; i += 8)
+		{
+			Vec8f x, y, z, w;
+			LoadDeinterleave4(data + i * 4, x, y, z, w);
+			x.StoreUnaligned(out.streams[0] + i);
+			y.StoreUnaligned(out.streams[1] + i);
+			z.StoreUnaligned(out.streams[2] + i);
+			w.StoreUnaligned(out.streams[3] + i);
+		}
+		for (; i < out.size; ++i)
+		{
+			out.Set(i, aos[i]);
+		}
+	}
+
+	furud_inline void ToAoS(const Vector3fSoAConstView& in, Vector3f* furud_restrict aos) noexcept
+	{
+		float* furud_restrict data = &aos->x;
+		size_t i = 0;
+		for (; i + 8 <= in.size; i += 8)
+		{
+			Vec8f x, y, z;
+			x.LoadUnaligned(in.streams[0] + i);
+			y.LoadUnaligned(in.streams[1] + i);
+			z.LoadUnaligned(in.streams[2] + i);
+			StoreInterleave3(data + i * 3, x, y, z);
+		}
+		for (; i < in.size; ++i)
+		{
+			aos[i] = in.Get(i);
+		}
+	}
+
+	furud_inline void ToAoS(const Vector4fSoAConstView& in, Vector4f* furud_restrict aos) noexcept
+	{
+		float* furud_restrict data = &aos->x;
+		size_t i = 0;
+		for (; i + 8 <= in.size; i += 8)
+		{
+			Vec8f x, y, z, w;
+			x.LoadUnaligned(in.streams[0] + i);
+			y.LoadUnaligned(in.streams[1] + i);
+			z.LoadUnaligned(in.streams[2] + i);
+			w.LoadUnaligned(in.streams[3] + i);
+			StoreInterleave4(data + i * 4, x, y, z, w);
+		}
+		for (; i < in.size; ++i)
+		{
+			aos[i] = in.Get(i);
+		}
+	}
+
+
+	//****************************************************************
+	// @brief    Dot products of `lhs.size` vector pairs.
+	// @return   out[i] = lhs[i] | rhs[i]
+	// @details  批量点乘。
+	//****************************************************************
+
+	furud_inline void DotProduct(const Vector3fSoAConstView& lhs, const Vector3fSoAConstView& rhs, float* out) noexcept { Internal::SoADotProductKernels<3>(lhs, rhs, out); }
+	furud_inline void DotProduct(const Vector4fSoAConstView& lhs, const Vector4fSoAConstView& rhs, float* out) noexcept { Internal::SoADotProductKernels<4>(lhs, rhs, out); }
+
+
+	//****************************************************************
+	// @brief    Lengths of `value.size` vectors.
+	// @return   out[i] = |value[i]|
+	// @details  批量求模。
+	//****************************************************************
+
+	furud_inline void Length(const Vector3fSoAConstView& value, float* out) noexcept { Internal::SoALengthKernels<3>(value, out); }
+	furud_inline void Length(const Vector4fSoAConstView& value, float* out) noexcept { Internal::SoALengthKernels<4>(value, out); }
+
+
+	//****************************************************************
+	// @brief    Normalizes `value.size` vectors, the ones whose squared length is not above `tolerance` are copied as is.
+	//           `out` may be `value` itself.
+	// @return   out[i] = value[i] / |value[i]|
+	// @details  批量单位化。
+	//****************************************************************
+
+	furud_inline void Normalize(const Vector3fSoAConstView& value, const Vector3fSoAView& out, float tolerance = IFloat::SMALLER) noexcept { Internal::SoANormalizeKernels<3>(value, out, tolerance); }
+	furud_inline void Normalize(const Vector4fSoAConstView& value, const Vector4fSoAView& out, float tolerance = IFloat::SMALLER) noexcept { Internal::SoANormalizeKernels<4>(value, out, tolerance); }
+
+
+	/**
+	 * @brief    Cross products of `lhs.size` vector pairs, `out` may be either input.
+	 * @return   out[i] = lhs[i] ^ rhs[i]
+	 * @details  批量叉乘。
+	 */
+	furud_inline void CrossProduct(const Vector3fSoAConstView& lhs, const Vector3fSoAConstView& rhs, const Vector3fSoAView& out) noexcept
+	{
+		Internal::SoACrossProductKernels(lhs, rhs, out);
+	}
+
+
+	//****************************************************************
+	// @brief    Linear interpolation of `lhs.size` vector pairs.
+	// @return   out[i] = lhs[i] + (rhs[i] - lhs[i]) * alpha
+	// @details  批量插值。
+	//****************************************************************
+
+	furud_inline void Lerp(const Vector3fSoAConstView& lhs, const Vector3fSoAConstView& rhs, float alpha, const Vector3fSoAView& out) noexcept { Internal::SoALerpKernels<3>(lhs, rhs, alpha, out); }
+	furud_inline void Lerp(const Vector4fSoAConstView& lhs, const Vector4fSoAConstView& rhs, float alpha, const Vector4fSoAView& out) noexcept { Internal::SoALerpKernels<4>(lhs, rhs, alpha, out); }
+
+
+	//****************************************************************
+	// @brief    Clamps every component of `value.size` vectors into [minValue, maxValue].
+	// @details  批量钳制。
+	//****************************************************************
+
+	furud_inline void Clamp(const Vector3fSoAConstView& value, float minValue, float maxValue, const Vector3fSoAView& out) noexcept { Internal::SoAClampKernels<3>(value, minValue, maxValue, out); }
+	furud_inline void Clamp(const Vector4fSoAConstView& value, float minValue, float maxValue, const Vector4fSoAView& out) noexcept { Internal::SoAClampKernels<4>(value, minValue, maxValue, out); }
+}
@@ -11,4 +11,5 @@ export module Furud.Core.Matrix;
 export import :Vector2;
 export import :Vector3;
 export import :Vector4;
+export import :VectorSoA;
 export import :Matrix;
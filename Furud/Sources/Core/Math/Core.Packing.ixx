@@ -0,0 +1,512 @@
+//
+// Core.Packing.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+//  Compressed vertex formats: half floats, octahedral normals and snorm/unorm quantization.
+//
+module;
+
+#include <Furud.hpp>
+#include <stdint.h>
+#include <bit>
+#include <cmath>
+#include <span>
+
+
+
+export module Furud.Core.Packing;
+
+export import Furud.Core.Matrix;
+import Furud.Platform.SIMD;
+
+
+
+/** Packed normals. */
+export namespace Furud
+{
+	/**
+	 * @brief    Octahedral-encoded unit vector, two snorm16 components ( 4 bytes ).
+	 * @details  八面体编码法线（16 位）。
+	 */
+	struct OctNormal16
+	{
+		int16_t x, y;
+	};
+
+
+	/**
+	 * @brief    Octahedral-encoded unit vector, two snorm8 components ( 2 bytes ).
+	 * @details  八面体编码法线（8 位）。
+	 */
+	struct OctNormal8
+	{
+		int8_t x, y;
+	};
+}
+
+
+
+/** Scalar conversions, also the portable fallback and the tails of the batch kernels. */
+export namespace Furud::IPacking
+{
+	//****************************************************************
+	// @brief    Converts between float and IEEE 754 binary16, rounding to nearest even.
+	//           Overflow goes to infinity, NaN stays NaN, and subnormals are kept.
+	// @details  单精度与半精度浮点互转。
+	//****************************************************************
+
+	furud_nodiscard furud_inline uint16_t FloatToHalf(const float& value) noexcept
+	{
+		constexpr uint32_t F32_INFINITY = 255u << 23;
+		constexpr uint32_t F16_OVERFLOW = (127u + 16u) << 23;
+		constexpr uint32_t F16_MIN_NORMAL = 113u << 23;
+		constexpr float DENORMAL_MAGIC = std::bit_cast<float>(((127u - 15u) + (23u - 10u) + 1u) << 23);
+
+		uint32_t f = std::bit_cast<uint32_t>(value);
+		const uint32_t sign = f & 0x80000000u;
+		f ^= sign;
+
+		uint16_t result;
+		if (f >= F16_OVERFLOW)
+		{
+			result = static_cast<uint16_t>(f > F32_INFINITY ? 0x7e00u : 0x7c00u);
+		}
+		else if (f < F16_MIN_NORMAL)
+		{
+			// Lets the FPU round the mantissa into place.
+			const float shifted = std::bit_cast<float>(f) + DENORMAL_MAGIC;
+			result = static_cast<uint16_t>(std::bit_cast<uint32_t>(shifted) - std::bit_cast<uint32_t>(DENORMAL_MAGIC));
+		}
+		else
+		{
+			const uint32_t mantissaOdd = (f >> 13) & 1u;
+			f += ((15u - 127u) << 23) + 0xfffu;
+			f += mantissaOdd;
+			result = static_cast<uint16_t>(f >> 13);
+		}
+		return static_cast<uint16_t>(result | (sign >> 16));
+	}
+
+	furud_nodiscard furud_inline float HalfToFloat(const uint16_t& value) noexcept
+	{
+		constexpr uint32_t SHIFTED_EXPONENT = 0x7c00u << 13;
+		constexpr float DENORMAL_MAGIC = std::bit_cast<float>(113u << 23);
+
+		uint32_t f = (value & 0x7fffu) << 13;
+		const uint32_t exponent = f & SHIFTED_EXPONENT;
+		f += (127u - 15u) << 23;
+
+		if (exponent == SHIFTED_EXPONENT)
+		{
+			// Infinity or NaN.
+			f += (128u - 16u) << 23;
+		}
+		else if (exponent == 0)
+		{
+			// Zero or subnormal, renormalized by the FPU.
+			f += 1u << 23;
+			f = std::bit_cast<uint32_t>(std::bit_cast<float>(f) - DENORMAL_MAGIC);
+		}
+
+		f |= (value & 0x8000u) << 16;
+		return std::bit_cast<float>(f);
+	}
+
+
+	//****************************************************************
+	// @brief    Quantizes to / expands from normalized integers.
+	//           snorm maps [-1, 1] to [-MAX, MAX], unorm maps [0, 1] to [0, MAX], rounding to nearest even.
+	// @details  归一化整型量化。
+	//****************************************************************
+
+	furud_nodiscard furud_inline int16_t QuantizeSnorm16(const float& value) noexcept
+	{
+		const float v = value < -1.f ? -1.f : (value < 1.f ? value : 1.f);
+		return static_cast<int16_t>(std::lrint(v * 32767.f));
+	}
+
+	furud_nodiscard furud_inline uint16_t QuantizeUnorm16(const float& value) noexcept
+	{
+		const float v = value < 0.f ? 0.f : (value < 1.f ? value : 1.f);
+		return static_cast<uint16_t>(std::lrint(v * 65535.f));
+	}
+
+	furud_nodiscard furud_inline int8_t QuantizeSnorm8(const float& value) noexcept
+	{
+		const float v = value < -1.f ? -1.f : (value < 1.f ? value : 1.f);
+		return static_cast<int8_t>(std::lrint(v * 127.f));
+	}
+
+	furud_nodiscard furud_inline uint8_t QuantizeUnorm8(const float& value) noexcept
+	{
+		const float v = value < 0.f ? 0.f : (value < 1.f ? value : 1.f);
+		return static_cast<uint8_t>(std::lrint(v * 255.f));
+	}
+
+	furud_nodiscard furud_inline float DequantizeSnorm16(const int16_t& value) noexcept
+	{
+		const float v = static_cast<float>(value) * (1.f / 32767.f);
+		return v < -1.f ? -1.f : v;
+	}
+
+	furud_nodiscard furud_inline float DequantizeUnorm16(const uint16_t& value) noexcept
+	{
+		return static_cast<float>(value) * (1.f / 65535.f);
+	}
+
+	furud_nodiscard furud_inline float DequantizeSnorm8(const int8_t& value) noexcept
+	{
+		const float v = static_cast<float>(value) * (1.f / 127.f);
+		return v < -1.f ? -1.f : v;
+	}
+
+	furud_nodiscard furud_inline float DequantizeUnorm8(const uint8_t& value) noexcept
+	{
+		return static_cast<float>(value) * (1.f / 255.f);
+	}
+
+
+	//****************************************************************
+	// @brief    Octahedral normal encoding: the unit sphere is projected on the octahedron |x|+|y|+|z| = 1,
+	//           and the lower half is folded over the upper one into the [-1, 1] square.
+	// @details  八面体法线编码。
+	//****************************************************************
+
+	furud_nodiscard furud_inline Vector2f EncodeOctahedral(Vector3f const& normal) noexcept
+	{
+		const float l1 = std::fabs(normal.x) + std::fabs(normal.y) + std::fabs(normal.z);
+		const float invL1 = 1.f / (l1 > 1e-30f ? l1 : 1e-30f);
+		const float x = normal.x * invL1;
+		const float y = normal.y * invL1;
+
+		if (normal.z < 0.f)
+		{
+			return { std::copysign(1.f - std::fabs(y), x), std::copysign(1.f - std::fabs(x), y) };
+		}
+		return { x, y };
+	}
+
+	furud_nodiscard furud_inline Vector3f DecodeOctahedral(Vector2f const& encoded) noexcept
+	{
+		const float z = 1.f - std::fabs(encoded.x) - std::fabs(encoded.y);
+		const float t = z < 0.f ? -z : 0.f;
+		const float x = encoded.x - std::copysign(t, encoded.x);
+		const float y = encoded.y - std::copysign(t, encoded.y);
+
+		const float invLength = 1.f / std::sqrt(x * x + y * y + z * z);
+		return { x * invLength, y * invLength, z * invLength };
+	}
+
+	furud_nodiscard furud_inline OctNormal16 PackNormal16(Vector3f const& normal) noexcept
+	{
+		const Vector2f e = EncodeOctahedral(normal);
+		return { QuantizeSnorm16(e.x), QuantizeSnorm16(e.y) };
+	}
+
+	furud_nodiscard furud_inline OctNormal8 PackNormal8(Vector3f const& normal) noexcept
+	{
+		const Vector2f e = EncodeOctahedral(normal);
+		return { QuantizeSnorm8(e.x), QuantizeSnorm8(e.y) };
+	}
+
+	furud_nodiscard furud_inline Vector3f UnpackNormal(OctNormal16 const& packed) noexcept
+	{
+		return DecodeOctahedral({ DequantizeSnorm16(packed.x), DequantizeSnorm16(packed.y) });
+	}
+
+	furud_nodiscard furud_inline Vector3f UnpackNormal(OctNormal8 const& packed) noexcept
+	{
+		return DecodeOctahedral({ DequantizeSnorm8(packed.x), DequantizeSnorm8(packed.y) });
+	}
+}
+
+
+
+namespace Furud::Internal
+{
+	//****************************************************************
+	// Half conversion kernels, F16C from the AVX2 tier on, bit manipulation otherwise.
+	//****************************************************************
+
+	inline void FloatsToHalvesScalar(const float* in, uint16_t* out, size_t num) noexcept
+	{
+		for (size_t i = 0; i < num; ++i)
+		{
+			out[i] = IPacking::FloatToHalf(in[i]);
+		}
+	}
+
+	inline void HalvesToFloatsScalar(const uint16_t* in, float* out, size_t num) noexcept
+	{
+		for (size_t i = 0; i < num; ++i)
+		{
+			out[i] = IPacking::HalfToFloat(in[i]);
+		}
+	}
+
+	inline void FloatsToHalvesF16C(const float* in, uint16_t* out, size_t num) noexcept
+	{
+		size_t i = 0;
+		for (Vec8f v; i + 8 <= num; i += 8)
+		{
+			v.LoadUnaligned(in + i).StoreHalf(out + i);
+		}
+		FloatsToHalvesScalar(in + i, out + i, num - i);
+	}
+
+	inline void HalvesToFloatsF16C(const uint16_t* in, float* out, size_t num) noexcept
+	{
+		size_t i = 0;
+		for (Vec8f v; i + 8 <= num; i += 8)
+		{
+			v.LoadHalf(in + i).StoreUnaligned(out + i);
+		}
+		HalvesToFloatsScalar(in + i, out + i, num - i);
+	}
+
+	inline TSimdDispatch<void(const float*, uint16_t*, size_t)> FloatsToHalvesKernels
+	{
+		{ ESimdLevel::Scalar, &FloatsToHalvesScalar },
+		{ ESimdLevel::AVX2, &FloatsToHalvesF16C },
+	};
+
+	inline TSimdDispatch<void(const uint16_t*, float*, size_t)> HalvesToFloatsKernels
+	{
+		{ ESimdLevel::Scalar, &HalvesToFloatsScalar },
+		{ ESimdLevel::AVX2, &HalvesToFloatsF16C },
+	};
+
+
+	//****************************************************************
+	// Normalized integer formats, see IPacking::Quantize*.
+	//****************************************************************
+
+	struct Snorm16Format
+	{
+		using Type = int16_t;
+		static constexpr float MIN = -1.f;
+		static constexpr float SCALE = 32767.f;
+		furud_inline static void Store(const Vec8f& v, Type* data) noexcept { v.StoreInt16(data); }
+		furud_inline static Vec8f Load(const Type* data) noexcept { Vec8f v; return v.LoadInt16(data); }
+		furud_inline static Type Quantize(const float& v) noexcept { return IPacking::QuantizeSnorm16(v); }
+		furud_inline static float Dequantize(const Type& v) noexcept { return IPacking::DequantizeSnorm16(v); }
+	};
+
+	struct Unorm16Format
+	{
+		using Type = uint16_t;
+		static constexpr float MIN = 0.f;
+		static constexpr float SCALE = 65535.f;
+		furud_inline static void Store(const Vec8f& v, Type* data) noexcept { v.StoreUint16(data); }
+		furud_inline static Vec8f Load(const Type* data) noexcept { Vec8f v; return v.LoadUint16(data); }
+		furud_inline static Type Quantize(const float& v) noexcept { return IPacking::QuantizeUnorm16(v); }
+		furud_inline static float Dequantize(const Type& v) noexcept { return IPacking::DequantizeUnorm16(v); }
+	};
+
+	struct Snorm8Format
+	{
+		using Type = int8_t;
+		static constexpr float MIN = -1.f;
+		static constexpr float SCALE = 127.f;
+		furud_inline static void Store(const Vec8f& v, Type* data) noexcept { v.StoreInt8(data); }
+		furud_inline static Vec8f Load(const Type* data) noexcept { Vec8f v; return v.LoadInt8(data); }
+		furud_inline static Type Quantize(const float& v) noexcept { return IPacking::QuantizeSnorm8(v); }
+		furud_inline static float Dequantize(const Type& v) noexcept { return IPacking::DequantizeSnorm8(v); }
+	};
+
+	struct Unorm8Format
+	{
+		using Type = uint8_t;
+		static constexpr float MIN = 0.f;
+		static constexpr float SCALE = 255.f;
+		furud_inline static void Store(const Vec8f& v, Type* data) noexcept { v.StoreUint8(data); }
+		furud_inline static Vec8f Load(const Type* data) noexcept { Vec8f v; return v.LoadUint8(data); }
+		furud_inline static Type Quantize(const float& v) noexcept { return IPacking::QuantizeUnorm8(v); }
+		furud_inline static float Dequantize(const Type& v) noexcept { return IPacking::DequantizeUnorm8(v); }
+	};
+
+
+	template <typename TFormat>
+	void QuantizeBatch(const float* in, typename TFormat::Type* out, size_t num) noexcept
+	{
+		const Vec8f lower = TFormat::MIN;
+		const Vec8f upper = 1.f;
+		const Vec8f scale = TFormat::SCALE;
+
+		size_t i = 0;
+		for (Vec8f v; i + 8 <= num; i += 8)
+		{
+			TFormat::Store(Min(Max(v.LoadUnaligned(in + i), lower), upper) * scale, out + i);
+		}
+		for (; i < num; ++i)
+		{
+			out[i] = TFormat::Quantize(in[i]);
+		}
+	}
+
+	template <typename TFormat>
+	void DequantizeBatch(const typename TFormat::Type* in, float* out, size_t num) noexcept
+	{
+		const Vec8f lower = TFormat::MIN;
+		const Vec8f invScale = 1.f / TFormat::SCALE;
+
+		size_t i = 0;
+		for (; i + 8 <= num; i += 8)
+		{
+			Max(TFormat::Load(in + i) * invScale, lower).StoreUnaligned(out + i);
+		}
+		for (; i < num; ++i)
+		{
+			out[i] = TFormat::Dequantize(in[i]);
+		}
+	}
+
+
+	//****************************************************************
+	// Octahedral normal kernels, 8 normals per iteration, see IPacking::EncodeOctahedral.
+	//****************************************************************
+
+	furud_inline void EncodeOctahedral(const Vec8f& x, const Vec8f& y, const Vec8f& z, Vec8f& outX, Vec8f& outY) noexcept
+	{
+		const Vec8f one = 1.f;
+		const Vec8f invL1 = one / Max(x.Abs() + y.Abs() + z.Abs(), Vec8f(1e-30f));
+		const Vec8f ex = x * invL1;
+		const Vec8f ey = y * invL1;
+
+		const Vec8f lowerHalf = LessThan(z, Vec8f(0.f));
+		outX = Select(lowerHalf, Copysign(one - ey.Abs(), ex), ex);
+		outY = Select(lowerHalf, Copysign(one - ex.Abs(), ey), ey);
+	}
+
+	furud_inline void DecodeOctahedral(const Vec8f& ex, const Vec8f& ey, Vec8f& outX, Vec8f& outY, Vec8f& outZ) noexcept
+	{
+		const Vec8f z = Vec8f(1.f) - ex.Abs() - ey.Abs();
+		const Vec8f t = Max(-z, Vec8f(0.f));
+		const Vec8f x = ex - Copysign(t, ex);
+		const Vec8f y = ey - Copysign(t, ey);
+
+		const Vec8f invLength = Vec8f(1.f) / MulAdd(z, z, MulAdd(y, y, x * x)).Sqrt();
+		outX = x * invLength;
+		outY = y * invLength;
+		outZ = z * invLength;
+	}
+
+	template <typename TPacked>
+	void PackNormalsBatch(const Vector3f* in, TPacked* out, size_t num) noexcept
+	{
+		constexpr bool b16 = sizeof(TPacked) == sizeof(OctNormal16);
+		const Vec8f scale = b16 ? 32767.f : 127.f;
+		const Vec8f lower = -1.f;
+		const Vec8f upper = 1.f;
+
+		size_t i = 0;
+		for (; i + 8 <= num; i += 8)
+		{
+			Vec8f x, y, z, ex, ey;
+			LoadDeinterleave3(&in[i].x, x, y, z);
+			EncodeOctahedral(x, y, z, ex, ey);
+			ex = Min(Max(ex, lower), upper) * scale;
+			ey = Min(Max(ey, lower), upper) * scale;
+
+			if constexpr (b16)
+			{
+				StoreInterleaveInt16(out + i, ex, ey);
+			}
+			else
+			{
+				StoreInterleaveInt8(out + i, ex, ey);
+			}
+		}
+		for (; i < num; ++i)
+		{
+			if constexpr (b16)
+			{
+				out[i] = IPacking::PackNormal16(in[i]);
+			}
+			else
+			{
+				out[i] = IPacking::PackNormal8(in[i]);
+			}
+		}
+	}
+
+	template <typename TPacked>
+	void UnpackNormalsBatch(const TPacked* in, Vector3f* out, size_t num) noexcept
+	{
+		constexpr bool b16 = sizeof(TPacked) == sizeof(OctNormal16);
+		const Vec8f invScale = b16 ? 1.f / 32767.f : 1.f / 127.f;
+		const Vec8f lower = -1.f;
+
+		size_t i = 0;
+		for (; i + 8 <= num; i += 8)
+		{
+			Vec8f ex, ey, x, y, z;
+			if constexpr (b16)
+			{
+				LoadDeinterleaveInt16(in + i, ex, ey);
+			}
+			else
+			{
+				LoadDeinterleaveInt8(in + i, ex, ey);
+			}
+			DecodeOctahedral(Max(ex * invScale, lower), Max(ey * invScale, lower), x, y, z);
+			StoreInterleave3(&out[i].x, x, y, z);
+		}
+		for (; i < num; ++i)
+		{
+			out[i] = IPacking::UnpackNormal(in[i]);
+		}
+	}
+}
+
+
+
+/** Batch conversions, `out` must be at least as long as `in`. */
+export namespace Furud::IPacking
+{
+	//****************************************************************
+	// @brief    Converts between float and half float streams.
+	// @details  批量单精度与半精度浮点互转。
+	//****************************************************************
+
+	inline void FloatsToHalves(std::span<const float> in, std::span<uint16_t> out) noexcept
+	{
+		Internal::FloatsToHalvesKernels(in.data(), out.data(), in.size());
+	}
+
+	inline void HalvesToFloats(std::span<const uint16_t> in, std::span<float> out) noexcept
+	{
+		Internal::HalvesToFloatsKernels(in.data(), out.data(), in.size());
+	}
+
+
+	//****************************************************************
+	// @brief    Quantizes float streams to normalized integers, and back.
+	//           Vector3f / Vector4f spans can be passed as float streams of 3 / 4 times their size.
+	// @details  批量归一化整型量化。
+	//****************************************************************
+
+	inline void QuantizeSnorm16(std::span<const float> in, std::span<int16_t> out) noexcept { Internal::QuantizeBatch<Internal::Snorm16Format>(in.data(), out.data(), in.size()); }
+	inline void QuantizeUnorm16(std::span<const float> in, std::span<uint16_t> out) noexcept { Internal::QuantizeBatch<Internal::Unorm16Format>(in.data(), out.data(), in.size()); }
+	inline void QuantizeSnorm8(std::span<const float> in, std::span<int8_t> out) noexcept { Internal::QuantizeBatch<Internal::Snorm8Format>(in.data(), out.data(), in.size()); }
+	inline void QuantizeUnorm8(std::span<const float> in, std::span<uint8_t> out) noexcept { Internal::QuantizeBatch<Internal::Unorm8Format>(in.data(), out.data(), in.size()); }
+
+	inline void DequantizeSnorm16(std::span<const int16_t> in, std::span<float> out) noexcept { Internal::DequantizeBatch<Internal::Snorm16Format>(in.data(), out.data(), in.size()); }
+	inline void DequantizeUnorm16(std::span<const uint16_t> in, std::span<float> out) noexcept { Internal::DequantizeBatch<Internal::Unorm16Format>(in.data(), out.data(), in.size()); }
+	inline void DequantizeSnorm8(std::span<const int8_t> in, std::span<float> out) noexcept { Internal::DequantizeBatch<Internal::Snorm8Format>(in.data(), out.data(), in.size()); }
+	inline void DequantizeUnorm8(std::span<const uint8_t> in, std::span<float> out) noexcept { Internal::DequantizeBatch<Internal::Unorm8Format>(in.data(), out.data(), in.size()); }
+
+
+	//****************************************************************
+	// @brief    Packs unit normals with the octahedral encoding, and back.
+	// @details  批量法线压缩与解压。
+	//****************************************************************
+
+	inline void PackNormals(std::span<const Vector3f> in, std::span<OctNormal16> out) noexcept { Internal::PackNormalsBatch(in.data(), out.data(), in.size()); }
+	inline void PackNormals(std::span<const Vector3f> in, std::span<OctNormal8> out) noexcept { Internal::PackNormalsBatch(in.data(), out.data(), in.size()); }
+
+	inline void UnpackNormals(std::span<const OctNormal16> in, std::span<Vector3f> out) noexcept { Internal::UnpackNormalsBatch(in.data(), out.data(), in.size()); }
+	inline void UnpackNormals(std::span<const OctNormal8> in, std::span<Vector3f> out) noexcept { Internal::UnpackNormalsBatch(in.data(), out.data(), in.size()); }
+}
@@ -0,0 +1,310 @@
+//
+// Core.Quaternion.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+//  Quaternion definition.
+//
+module;
+
+#include <Furud.hpp>
+#include <span>
+
+
+
+export module Furud.Core.Quaternion;
+
+export import Furud.Core.Matrix;
+export import Furud.Core.Rotator;
+import Furud.Platform.SIMD;
+import Furud.Platform.Math;
+
+
+
+export namespace Furud
+{
+	/**
+	 * @brief  Unit quaternion, rotates a vector as ( q * v * q^-1 ).
+	 *         Shares the conventions of Rotator, so `Quaternionf(r).ToMatrix()` equals `r.ToMatrix()`.
+	 * @details  四元数。
+	 */
+	struct alignas(16) Quaternionf
+	{
+		float x, y, z, w;
+
+
+	public:
+		static const Quaternionf IDENTITY;
+
+
+	public:
+		constexpr Quaternionf() noexcept {}
+		constexpr Quaternionf(float const& sx, float const& sy, float const& sz, float const& sw) noexcept : x(sx), y(sy), z(sz), w(sw) {}
+
+		/**
+		 * @brief    Builds the quaternion of a Rotator, ( yaw * pitch * roll ).
+		 * @details  欧拉角转四元数。
+		 */
+		explicit Quaternionf(Rotator const& rotator) noexcept
+		{
+			Vec4f halfRadians { rotator.pitch, rotator.yaw, rotator.roll, 0.f };
+			halfRadians = halfRadians * (IFloat::DEG_TO_RAD * 0.5f);
+
+			Vec4f s; // ( pitch, yaw, roll, unused )
+			Vec4f c; // ( pitch, yaw, roll, unused )
+			SinCos(halfRadians, s, c);
+
+			const float sp = s.X(), sy = s.Y(), sr = s.Z();
+			const float cp = c.X(), cy = c.Y(), cr = c.Z();
+
+			const Vec4f lhs = Vec4f { sp, cp, cp, cp } * Vec4f { cy, sy, cy, cy } * Vec4f { cr, cr, sr, cr };
+			const Vec4f rhs = Vec4f { cp, sp, sp, sp } * Vec4f { sy, cy, sy, sy } * Vec4f { sr, sr, cr, sr };
+			AsVec4() = MultiplyAdd(rhs, Vec4f { 1.f, -1.f, -1.f, 1.f }, lhs);
+		}
+
+		/**
+		 * @brief    Builds the quaternion rotating `degrees` around the unit vector `axis`.
+		 * @details  轴角转四元数。
+		 */
+		furud_nodiscard furud_inline static Quaternionf FromAxisAngle(Vector3f const& axis, float const& degrees) noexcept
+		{
+			const float halfRadians = degrees * (IFloat::DEG_TO_RAD * 0.5f);
+			const float s = IMath::Sin(halfRadians);
+			return { axis.x * s, axis.y * s, axis.z * s, IMath::Cos(halfRadians) };
+		}
+
+
+	public:
+		Quaternionf(const Quaternionf&) = default;
+		Quaternionf& operator = (const Quaternionf&) = default;
+		Quaternionf(Quaternionf&&) = default;
+		Quaternionf& operator = (Quaternionf&&) = default;
+		~Quaternionf() noexcept {}
+
+
+	public:
+		furud_nodiscard furud_intrinsic Vec4f& AsVec4() noexcept
+		{
+			return *(Vec4f*)(this);
+		}
+
+		furud_nodiscard furud_intrinsic const Vec4f& AsVec4() const noexcept
+		{
+			return *(Vec4f*)(this);
+		}
+
+
+	public:
+		bool operator == (const Quaternionf& rhs) const noexcept { return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w; }
+		bool operator != (const Quaternionf& rhs) const noexcept { return x != rhs.x || y != rhs.y || z != rhs.z || w != rhs.w; }
+
+
+	public:
+		/**
+		 * @brief    Hamilton product, the result rotates by `rhs` first, then by `this`.
+		 * @details  四元数乘法。
+		 */
+		furud_nodiscard furud_inline Quaternionf operator * (const Quaternionf& rhs) const noexcept
+		{
+			const Vec4f& a = AsVec4();
+			const Vec4f& b = rhs.AsVec4();
+			const Vec4f sign { 1.f, 1.f, 1.f, -1.f };
+
+			// x = aw*bx + ax*bw + ay*bz - az*by, and so on.
+			Vec4f r = a.ReplicateW() * b;
+			r = MultiplyAdd(a.Swizzle<0, 1, 2, 0>() * b.Swizzle<3, 3, 3, 0>(), sign, r);
+			r = MultiplyAdd(a.Swizzle<1, 2, 0, 1>() * b.Swizzle<2, 0, 1, 1>(), sign, r);
+			r = r - a.Swizzle<2, 0, 1, 2>() * b.Swizzle<1, 2, 0, 2>();
+
+			Quaternionf result;
+			result.AsVec4() = r;
+			return result;
+		}
+
+		furud_inline const Quaternionf& operator *= (const Quaternionf& rhs) noexcept
+		{
+			*this = *this * rhs;
+			return *this;
+		}
+
+
+	public:
+		furud_nodiscard furud_inline Quaternionf Conjugate() const noexcept
+		{
+			return { -x, -y, -z, w };
+		}
+
+		furud_nodiscard furud_inline Quaternionf Inverse() const noexcept
+		{
+			Quaternionf result;
+			result.AsVec4() = Conjugate().AsVec4() / Vec4f(DotProduct(AsVec4(), AsVec4()));
+			return result;
+		}
+
+		furud_nodiscard furud_inline Quaternionf Normalize() const noexcept
+		{
+			Quaternionf result;
+			result.AsVec4() = AsVec4().Normalize();
+			return result;
+		}
+
+
+	public:
+		/**
+		 * @brief    Rotates a vector, ( v + w * t + u x t ) where u is the vector part and t = 2 * ( u x v ).
+		 * @details  旋转向量。
+		 */
+		furud_nodiscard furud_inline Vector3f RotateVector(Vector3f const& v) const noexcept
+		{
+			const Vec4f q = AsVec4();
+			const Vec4f p { v.x, v.y, v.z, 0.f };
+
+			const Vec4f t2 = q.Swizzle<1, 2, 0, 3>() * p.Swizzle<2, 0, 1, 3>() - q.Swizzle<2, 0, 1, 3>() * p.Swizzle<1, 2, 0, 3>();
+			const Vec4f t = t2 + t2;
+			const Vec4f ut = q.Swizzle<1, 2, 0, 3>() * t.Swizzle<2, 0, 1, 3>() - q.Swizzle<2, 0, 1, 3>() * t.Swizzle<1, 2, 0, 3>();
+			Vec4f r = MultiplyAdd(q.ReplicateW(), t, p) + ut;
+
+			Vector3f result;
+			r.Store3(&result);
+			return result;
+		}
+
+		furud_nodiscard furud_inline Vector3f UnrotateVector(Vector3f const& v) const noexcept
+		{
+			return Conjugate().RotateVector(v);
+		}
+
+		/**
+		 * @brief    The rotation matrix, row-vector convention like Rotator::ToMatrix.
+		 * @details  四元数转矩阵。
+		 */
+		furud_nodiscard furud_inline Matrix44f ToMatrix() const noexcept
+		{
+			const float x2 = x + x, y2 = y + y, z2 = z + z;
+			const float xx = x * x2, yy = y * y2, zz = z * z2;
+			const float xy = x * y2, xz = x * z2, yz = y * z2;
+			const float wx = w * x2, wy = w * y2, wz = w * z2;
+
+			return Matrix44f
+			{
+				Vector4f { 1.f - (yy + zz), xy + wz, xz - wy, 0.f },
+				Vector4f { xy - wz, 1.f - (xx + zz), yz + wx, 0.f },
+				Vector4f { xz + wy, yz - wx, 1.f - (xx + yy), 0.f },
+				Vector4f { 0.f, 0.f, 0.f, 1.f }
+			};
+		}
+
+
+	public:
+		furud_inline friend float DotProduct(const Quaternionf& lhs, const Quaternionf& rhs) noexcept
+		{
+			return DotProduct(lhs.AsVec4(), rhs.AsVec4());
+		}
+
+		/**
+		 * @brief    Normalized linear interpolation along the shortest path.
+		 * @details  归一化线性插值。
+		 */
+		furud_nodiscard furud_inline friend Quaternionf NLerp(const Quaternionf& lhs, const Quaternionf& rhs, const float& alpha) noexcept
+		{
+			const Vec4f& a = lhs.AsVec4();
+			const Vec4f b = DotProduct(lhs, rhs) < 0.f ? -rhs.AsVec4() : rhs.AsVec4();
+
+			Quaternionf result;
+			result.AsVec4() = MultiplyAdd(b - a, Vec4f(alpha), a).Normalize();
+			return result;
+		}
+
+		/**
+		 * @brief    Spherical linear interpolation along the shortest path.
+		 *           The three sines it needs come from a single Vec4f Sin, nearly parallel inputs fall back to NLerp.
+		 * @details  球面线性插值。
+		 */
+		furud_nodiscard furud_inline friend Quaternionf Slerp(const Quaternionf& lhs, const Quaternionf& rhs, const float& alpha) noexcept
+		{
+			float cosTheta = DotProduct(lhs, rhs);
+			const Vec4f& a = lhs.AsVec4();
+			Vec4f b = rhs.AsVec4();
+			if (cosTheta < 0.f)
+			{
+				cosTheta = -cosTheta;
+				b = -b;
+			}
+
+			Quaternionf result;
+			if (cosTheta > 0.9995f)
+			{
+				result.AsVec4() = MultiplyAdd(b - a, Vec4f(alpha), a).Normalize();
+				return result;
+			}
+
+			const float theta = IMath::Acos(cosTheta);
+			const Vec4f s = Sin(Vec4f { (1.f - alpha) * theta, alpha * theta, theta, 0.f });
+			const float invSinTheta = 1.f / s.Z();
+
+			result.AsVec4() = MultiplyAdd(a, Vec4f(s.X() * invSinTheta), b * Vec4f(s.Y() * invSinTheta));
+			return result;
+		}
+	};
+
+
+	const Quaternionf Quaternionf::IDENTITY = { 0.f, 0.f, 0.f, 1.f };
+}
+
+
+
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Converts 8 rotators per iteration, the half-angle sines and cosines come from 3 Vec8f SinCos.
+	 * @details  批量欧拉角转四元数。
+	 */
+	furud_inline void RotatorsToQuaternions(const Rotator* in, Quaternionf* out, size_t num) noexcept
+	{
+		const Vec8f halfDegToRad = IFloat::DEG_TO_RAD * 0.5f;
+
+		size_t i = 0;
+		for (; i + 8 <= num; i += 8)
+		{
+			Vec8f yaw, pitch, roll;
+			LoadDeinterleave3(&in[i].yaw, yaw, pitch, roll);
+
+			Vec8f sy, cy, sp, cp, sr, cr;
+			SinCos(yaw * halfDegToRad, sy, cy);
+			SinCos(pitch * halfDegToRad, sp, cp);
+			SinCos(roll * halfDegToRad, sr, cr);
+
+			const Vec8f cpcy = cp * cy;
+			const Vec8f spsy = sp * sy;
+			const Vec8f spcy = sp * cy;
+			const Vec8f cpsy = cp * sy;
+
+			const Vec8f qx = MulAdd(cpsy, sr, spcy * cr);
+			const Vec8f qy = cpsy * cr - spcy * sr;
+			const Vec8f qz = cpcy * sr - spsy * cr;
+			const Vec8f qw = MulAdd(spsy, sr, cpcy * cr);
+
+			StoreInterleave4(&out[i].x, qx, qy, qz, qw);
+		}
+
+		for (; i < num; ++i)
+		{
+			out[i] = Quaternionf(in[i]);
+		}
+	}
+}
+
+
+
+export namespace Furud::IQuaternion
+{
+	/**
+	 * @brief    Converts rotators to quaternions, ( out[i] = Quaternionf(in[i]) ).
+	 * @details  批量欧拉角转四元数。
+	 */
+	inline void FromRotators(std::span<const Rotator> in, std::span<Quaternionf> out) noexcept
+	{
+		Internal::RotatorsToQuaternions(in.data(), out.data(), in.size());
+	}
+}
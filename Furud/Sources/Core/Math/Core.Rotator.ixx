@@ -22,6 +22,18 @@ import Furud.Platform.Math;
 
 export namespace Furud
 {
+	/**
+	 * @brief  The basis vectors of a rotation.
+	 * @details  旋转基向量。
+	 */
+	struct RotatorAxes
+	{
+		Vector3f forward;
+		Vector3f right;
+		Vector3f up;
+	};
+
+
 	/**
 	 * @brief  Implements a container for rotation information.
 	 *         all rotation values are stored in degrees, range in [-180, 180].
@@ -241,6 +253,35 @@ export namespace Furud
 
 			return result;
 		}
+
+		furud_nodiscard furud_inline RotatorAxes GetAxes() const
+		{
+			// The same as GetForwardVector/GetRightVector/GetUpVector, sharing one SinCos.
+			Vector4f degrees { 0, yaw, pitch, roll };
+			Vector4f radians { degrees * IFloat::DEG_TO_RAD };
+
+			Vector4f s; // ( Unused, yaw, pitch, roll )
+			Vector4f c; // ( Unused, yaw, pitch, roll )
+			SinCos(radians, s, c);
+
+			const float s1s2 = s[1] * s[2];
+			const float c1s2 = c[1] * s[2];
+
+			RotatorAxes result;
+			result.forward.x = -s[1] * c[2];
+			result.forward.y = s[2];
+			result.forward.z = -c[1] * c[2];
+
+			result.right.x = c[1] * c[3] + s1s2 * s[3];
+			result.right.y = c[2] * s[3];
+			result.right.z = c1s2 * s[3] - s[1] * c[3];
+
+			result.up.x = s1s2 * c[3] - c[1] * s[3];
+			result.up.y = c[2] * c[3];
+			result.up.z = c1s2 * c[3] + s[1] * s[3];
+
+			return result;
+		}
 	};
 
 
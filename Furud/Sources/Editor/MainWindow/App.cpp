@@ -36,7 +36,9 @@ module;
 module Furud.App;
 
 import Furud.Platform.API.FrameTimer;
+import Furud.Platform.Memory.FrameArena;
 import Furud.Platform.RHI;
+import Furud.Platform.SIMD;
 
 namespace Furud
 {
@@ -283,6 +285,15 @@ namespace Furud
 		LoadStringW(hInstance, IDC_FURUD, wndClass, MaxLoadString);
 		appInstance = hInstance;
 
+		// Reports the instruction set, hosts below the compiled level are already rejected by FurudStartup ( Startup.cpp ).
+		{
+			const SimdFeatures& features = GetSimdFeatures();
+			const std::string message = std::format(
+				"[Furud] CPU: {} ({}), SIMD level: {}, compiled for: {}\n",
+				features.brand, features.vendor, GetSimdLevelName(GetSimdLevel()), GetSimdLevelName(CompiledSimdLevel));
+			OutputDebugStringA(message.c_str());
+		}
+
 		// Register window class.
 		if (SUCCEEDED(hr))
 		{
@@ -354,6 +365,7 @@ namespace Furud
 			{
 				frameCount++;
 				timer.BeginFrame();
+				IFrameArena::BeginFrame();
 				Draw(timer.GetDeltaTime());
 				timer.EndFrame();
 			}
@@ -0,0 +1,75 @@
+//
+// Startup.cpp
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @Author FongZiSing
+//
+// The process entry point, checks the processor before the C runtime starts.
+// This file is compiled without /arch, the rest of the binary requires AVX2, FMA3 and F16C,
+// so any code here must not touch Furud modules or run through dynamic initializers.
+//
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <intrin.h>
+
+
+
+/** The C runtime entry point of a wWinMain application. */
+extern "C" DWORD wWinMainCRTStartup(LPVOID parameter);
+
+
+
+namespace
+{
+	/**
+	 * @brief    Whether the host runs code compiled with /arch:AVX2 ( AVX2, FMA3 and F16C with ymm state saved by the os ).
+	 * @note     Mirrors the AVX2 level of Furud::Internal::DetectSimdFeatures().
+	 */
+	__declspec(safebuffers) bool IsAvx2Supported() noexcept
+	{
+		int regs[4];
+		__cpuidex(regs, 0, 0);
+		if (regs[0] < 7)
+		{
+			return false;
+		}
+
+		__cpuidex(regs, 1, 0);
+		const unsigned ecx1 = (unsigned)regs[2];
+		const bool bSSE41   = (ecx1 & (1u << 19)) != 0;
+		const bool bFMA     = (ecx1 & (1u << 12)) != 0;
+		const bool bOSXSave = (ecx1 & (1u << 27)) != 0;
+		const bool bAVX     = (ecx1 & (1u << 28)) != 0;
+		const bool bF16C    = (ecx1 & (1u << 29)) != 0;
+		if (!bSSE41 || !bFMA || !bOSXSave || !bAVX || !bF16C)
+		{
+			return false;
+		}
+
+		// AVX registers are only usable when the os saves them on context switch.
+		if ((_xgetbv(0) & 0x06) != 0x06)
+		{
+			return false;
+		}
+
+		__cpuidex(regs, 7, 0);
+		return ((unsigned)regs[1] & (1u << 5)) != 0;
+	}
+}
+
+
+
+/**
+ * @brief    Linker entry point ( /ENTRY:FurudStartup ), runs before the C runtime and all static constructors.
+ * @details  进程入口，检查处理器指令集后再启动 C 运行时。
+ */
+extern "C" __declspec(safebuffers) DWORD FurudStartup(LPVOID parameter)
+{
+	if (!IsAvx2Supported())
+	{
+		::MessageBoxA(nullptr, "[Furud] This processor does not support AVX2, FMA3 and F16C.", "Unsupported processor", MB_OK | MB_ICONERROR);
+		::ExitProcess(1);
+	}
+	return wWinMainCRTStartup(parameter);
+}
@@ -18,8 +18,8 @@
 
 
 // TODO
-//   Furud Engine is available only with windows platform
-//   and visual studio compiler now.
+//   Furud Engine is available with windows platform (visual studio compiler)
+//   and linux platform (gcc/clang) now.
 #if defined(WIN32) || defined(_WIN32) || defined(_WIN32_) || defined(WIN64) || defined(_WIN64) || defined(_WIN64_)
 	#ifdef _MSC_VER
 		#define FURUD_OS_WIN   1
@@ -28,6 +28,43 @@
 	#else
 		#error "[Furud] unsupported operation system!"
 	#endif
+#elif defined(__linux__)
+	#if defined(__GNUC__) || defined(__clang__)
+		#define FURUD_OS_WIN   0
+		#define FURUD_OS_MAC   0
+		#define FURUD_OS_LINUX 1
+	#else
+		#error "[Furud] unsupported operation system!"
+	#endif
+#endif
+
+
+
+// Simd backend of Furud.Platform.SIMD.
+//   FURUD_SIMD_PORTABLE     1: the x86 intrinsics are emulated with gcc/clang vector extensions (SIMDPortable.hpp),
+//                           which lower to NEON on arm. Defaults to 1 on every target but x86, can be forced on x86.
+//   FURUD_SIMD_STRICT_IEEE  1: every Vec/Mat operation is correctly rounded (no rcp/rsqrt estimates) and TSimdDispatch
+//                           stays on CompiledSimdLevel, so the same inputs give the same bits on every host and backend.
+//                           Also compile with /fp:precise (msvc) or -ffp-contract=off (gcc/clang), so that the compiler
+//                           does not fuse separate multiplies and adds on some targets only.
+#ifndef FURUD_SIMD_PORTABLE
+	#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+		#define FURUD_SIMD_PORTABLE 0
+	#else
+		#define FURUD_SIMD_PORTABLE 1
+	#endif
+#endif
+
+#ifndef FURUD_SIMD_STRICT_IEEE
+	#define FURUD_SIMD_STRICT_IEEE 0
+#endif
+
+#if FURUD_SIMD_PORTABLE && FURUD_OS_WIN
+	#error "[Furud] the portable simd backend requires gcc/clang!"
+#endif
+
+#if FURUD_SIMD_STRICT_IEEE && (defined(__FAST_MATH__) || defined(_M_FP_FAST))
+	#error "[Furud] strict ieee simd requires the compiler to keep ieee semantics, disable fast-math!"
 #endif
 
 
@@ -82,10 +119,76 @@
 	#define furud_fastapi __fastcall
 	#endif
 
+	#ifndef furud_target
+	#define furud_target(isa)
+	#endif
+
 	#ifndef furud_softbreak
 	#define furud_softbreak { *(volatile int*)0 = 0; }
 	#endif
 
+#elif FURUD_OS_LINUX
+
+	#ifndef furud_inline
+	#define furud_inline [[gnu::always_inline]] inline
+	#endif
+
+	#ifndef furud_noinline
+	#define furud_noinline [[gnu::noinline]]
+	#endif
+
+	#ifndef furud_intrinsic
+	#define furud_intrinsic
+	#endif
+
+	#ifndef furud_unused
+	#define furud_unused [[maybe_unused]]
+	#endif
+
+	#ifndef furud_likely
+	#define furud_likely [[likely]]
+	#endif
+
+	#ifndef furud_unlikely
+	#define furud_unlikely [[unlikely]]
+	#endif
+
+	#ifndef furud_nodiscard
+	#define furud_nodiscard [[nodiscard]]
+	#endif
+
+	#ifndef furud_deprecated
+	#define furud_deprecated(message) [[deprecated(message)]]
+	#endif
+
+	#ifndef furud_restrict
+	#define furud_restrict __restrict__
+	#endif
+
+	#ifndef furud_interface
+	#define furud_interface
+	#endif
+
+	#ifndef furud_vectorapi
+	#define furud_vectorapi
+	#endif
+
+	#ifndef furud_fastapi
+	#define furud_fastapi
+	#endif
+
+	#ifndef furud_target
+		#if FURUD_SIMD_PORTABLE
+		#define furud_target(isa)
+		#else
+		#define furud_target(isa) [[gnu::target(isa)]]
+		#endif
+	#endif
+
+	#ifndef furud_softbreak
+	#define furud_softbreak { __builtin_trap(); }
+	#endif
+
 #endif
 
 
@@ -9,19 +9,32 @@
 module;
 
 #include <Furud.hpp>
+#include <bit>
+#include <cstddef>
+#include <string>
 #include <type_traits>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
+#include <wchar.h>
+#include <wctype.h>
 #include <utility>
+#include <immintrin.h>
 
 
 
 export module Furud.Platform.API.CharArray;
 
+import :Number;
+
 /** Forward declaration. */
 namespace Furud::Internal
 {
-	template <typename C, typename S>
+	template <typename TChar, typename TSize>
+	struct TStringAllocator;
+
+	template <typename C, typename S, typename A = TStringAllocator<C, S>>
 	class TCharArray;
 
 	template <typename C, typename S>
@@ -30,6 +43,313 @@ namespace Furud::Internal
 
 
 
+/** Vectorized character routines. */
+namespace Furud::Internal
+{
+	template <typename TChar>
+	furud_inline __m128i SimdSet128(TChar ch) noexcept
+	{
+		if constexpr (sizeof(TChar) == 1)      return _mm_set1_epi8((char)ch);
+		else if constexpr (sizeof(TChar) == 2) return _mm_set1_epi16((short)ch);
+		else                                   return _mm_set1_epi32((int)ch);
+	}
+
+	template <typename TChar>
+	furud_inline __m128i SimdCompareEqual128(__m128i a, __m128i b) noexcept
+	{
+		if constexpr (sizeof(TChar) == 1)      return _mm_cmpeq_epi8(a, b);
+		else if constexpr (sizeof(TChar) == 2) return _mm_cmpeq_epi16(a, b);
+		else                                   return _mm_cmpeq_epi32(a, b);
+	}
+
+	template <typename TChar>
+	furud_inline __m128i SimdCompareGreater128(__m128i a, __m128i b) noexcept
+	{
+		if constexpr (sizeof(TChar) == 1)      return _mm_cmpgt_epi8(a, b);
+		else if constexpr (sizeof(TChar) == 2) return _mm_cmpgt_epi16(a, b);
+		else                                   return _mm_cmpgt_epi32(a, b);
+	}
+
+#if defined(__AVX2__)
+	template <typename TChar>
+	furud_inline __m256i SimdSet256(TChar ch) noexcept
+	{
+		if constexpr (sizeof(TChar) == 1)      return _mm256_set1_epi8((char)ch);
+		else if constexpr (sizeof(TChar) == 2) return _mm256_set1_epi16((short)ch);
+		else                                   return _mm256_set1_epi32((int)ch);
+	}
+
+	template <typename TChar>
+	furud_inline __m256i SimdCompareEqual256(__m256i a, __m256i b) noexcept
+	{
+		if constexpr (sizeof(TChar) == 1)      return _mm256_cmpeq_epi8(a, b);
+		else if constexpr (sizeof(TChar) == 2) return _mm256_cmpeq_epi16(a, b);
+		else                                   return _mm256_cmpeq_epi32(a, b);
+	}
+
+	template <typename TChar>
+	furud_inline __m256i SimdCompareGreater256(__m256i a, __m256i b) noexcept
+	{
+		if constexpr (sizeof(TChar) == 1)      return _mm256_cmpgt_epi8(a, b);
+		else if constexpr (sizeof(TChar) == 2) return _mm256_cmpgt_epi16(a, b);
+		else                                   return _mm256_cmpgt_epi32(a, b);
+	}
+#endif
+
+
+	/**
+	 * @brief    Clears the mask bits of the lowest lane, a lane has `sizeof(TChar)` bits in the byte mask.
+	 */
+	template <typename TChar>
+	furud_inline uint32_t SimdClearLowestLane(uint32_t mask) noexcept
+	{
+		const uint32_t lane = (uint32_t)std::countr_zero(mask) / sizeof(TChar);
+		return mask & ~(((1u << sizeof(TChar)) - 1) << (lane * sizeof(TChar)));
+	}
+
+
+	/**
+	 * @brief    Finds the first `ch` in [first, last), 32/16 bytes per compare.
+	 * @returns  `last` if not found.
+	 * @details  向量化字符查找。
+	 */
+	template <typename TChar>
+	const TChar* SimdFindChar(const TChar* first, const TChar* last, TChar ch) noexcept
+	{
+#if defined(__AVX2__)
+		constexpr ptrdiff_t Lanes256 = 32 / sizeof(TChar);
+		const __m256i target256 = SimdSet256(ch);
+		for (; last - first >= Lanes256; first += Lanes256)
+		{
+			const __m256i chunk = _mm256_loadu_si256((const __m256i*)first);
+			const uint32_t mask = (uint32_t)_mm256_movemask_epi8(SimdCompareEqual256<TChar>(chunk, target256));
+			if (mask)
+			{
+				return first + std::countr_zero(mask) / sizeof(TChar);
+			}
+		}
+#endif
+
+		constexpr ptrdiff_t Lanes128 = 16 / sizeof(TChar);
+		const __m128i target128 = SimdSet128(ch);
+		for (; last - first >= Lanes128; first += Lanes128)
+		{
+			const __m128i chunk = _mm_loadu_si128((const __m128i*)first);
+			const uint32_t mask = (uint32_t)_mm_movemask_epi8(SimdCompareEqual128<TChar>(chunk, target128));
+			if (mask)
+			{
+				return first + std::countr_zero(mask) / sizeof(TChar);
+			}
+		}
+
+		for (; first < last; ++first)
+		{
+			if (*first == ch)
+			{
+				return first;
+			}
+		}
+		return last;
+	}
+
+
+	/**
+	 * @brief    Finds the first occurrence of `search` in [first, last).
+	 *           The positions whose first and last characters both match are compared only.
+	 * @returns  `last` if not found.
+	 * @details  向量化子串查找。
+	 */
+	template <typename TChar>
+	const TChar* SimdFindString(const TChar* first, const TChar* last, const TChar* search, size_t searchSize) noexcept
+	{
+		if (searchSize == 0)
+		{
+			return first;
+		}
+
+		if (size_t(last - first) < searchSize)
+		{
+			return last;
+		}
+
+		if (searchSize == 1)
+		{
+			return SimdFindChar(first, last, search[0]);
+		}
+
+		// The last position a match can start.
+		const TChar* const end = last - searchSize + 1;
+		const TChar* const middle = search + 1;
+		const size_t middleSize = searchSize - 2;
+		const size_t tailOffset = searchSize - 1;
+
+#if defined(__AVX2__)
+		constexpr ptrdiff_t Lanes256 = 32 / sizeof(TChar);
+		const __m256i head256 = SimdSet256(search[0]);
+		const __m256i tail256 = SimdSet256(search[tailOffset]);
+		for (; end - first >= Lanes256; first += Lanes256)
+		{
+			const __m256i heads = SimdCompareEqual256<TChar>(_mm256_loadu_si256((const __m256i*)first), head256);
+			const __m256i tails = SimdCompareEqual256<TChar>(_mm256_loadu_si256((const __m256i*)(first + tailOffset)), tail256);
+			uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(heads, tails));
+			while (mask)
+			{
+				const TChar* candidate = first + std::countr_zero(mask) / sizeof(TChar);
+				if (std::char_traits<TChar>::compare(candidate + 1, middle, middleSize) == 0)
+				{
+					return candidate;
+				}
+				mask = SimdClearLowestLane<TChar>(mask);
+			}
+		}
+#endif
+
+		constexpr ptrdiff_t Lanes128 = 16 / sizeof(TChar);
+		const __m128i head128 = SimdSet128(search[0]);
+		const __m128i tail128 = SimdSet128(search[tailOffset]);
+		for (; end - first >= Lanes128; first += Lanes128)
+		{
+			const __m128i heads = SimdCompareEqual128<TChar>(_mm_loadu_si128((const __m128i*)first), head128);
+			const __m128i tails = SimdCompareEqual128<TChar>(_mm_loadu_si128((const __m128i*)(first + tailOffset)), tail128);
+			uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(heads, tails));
+			while (mask)
+			{
+				const TChar* candidate = first + std::countr_zero(mask) / sizeof(TChar);
+				if (std::char_traits<TChar>::compare(candidate + 1, middle, middleSize) == 0)
+				{
+					return candidate;
+				}
+				mask = SimdClearLowestLane<TChar>(mask);
+			}
+		}
+
+		for (; first < end; ++first)
+		{
+			if (first[0] == search[0] && first[tailOffset] == search[tailOffset]
+				&& std::char_traits<TChar>::compare(first + 1, middle, middleSize) == 0)
+			{
+				return first;
+			}
+		}
+		return last;
+	}
+
+
+	/**
+	 * @brief    Classifies the ASCII whitespace (0x09 - 0x0D or 0x20) of a vector.
+	 *           The characters above 0x7F are never classified as whitespace here.
+	 */
+	template <typename TChar>
+	furud_inline __m128i SimdIsAsciiWhitespace128(__m128i chunk) noexcept
+	{
+		const __m128i controls = _mm_and_si128(
+			SimdCompareGreater128<TChar>(chunk, SimdSet128(TChar(0x08))),
+			SimdCompareGreater128<TChar>(SimdSet128(TChar(0x0E)), chunk));
+		return _mm_or_si128(controls, SimdCompareEqual128<TChar>(chunk, SimdSet128(TChar(0x20))));
+	}
+
+#if defined(__AVX2__)
+	template <typename TChar>
+	furud_inline __m256i SimdIsAsciiWhitespace256(__m256i chunk) noexcept
+	{
+		const __m256i controls = _mm256_and_si256(
+			SimdCompareGreater256<TChar>(chunk, SimdSet256(TChar(0x08))),
+			SimdCompareGreater256<TChar>(SimdSet256(TChar(0x0E)), chunk));
+		return _mm256_or_si256(controls, SimdCompareEqual256<TChar>(chunk, SimdSet256(TChar(0x20))));
+	}
+#endif
+
+
+	/**
+	 * @brief    Skips the ASCII whitespace from the start of [first, last).
+	 * @returns  The first character which is not ASCII whitespace, or `last`.
+	 * @details  向量化跳过开头空格。
+	 */
+	template <typename TChar>
+	const TChar* SimdSkipAsciiWhitespace(const TChar* first, const TChar* last) noexcept
+	{
+#if defined(__AVX2__)
+		constexpr ptrdiff_t Lanes256 = 32 / sizeof(TChar);
+		for (; last - first >= Lanes256; first += Lanes256)
+		{
+			const __m256i chunk = _mm256_loadu_si256((const __m256i*)first);
+			const uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(SimdIsAsciiWhitespace256<TChar>(chunk));
+			if (mask)
+			{
+				return first + std::countr_zero(mask) / sizeof(TChar);
+			}
+		}
+#endif
+
+		constexpr ptrdiff_t Lanes128 = 16 / sizeof(TChar);
+		for (; last - first >= Lanes128; first += Lanes128)
+		{
+			const __m128i chunk = _mm_loadu_si128((const __m128i*)first);
+			const uint32_t mask = ~(uint32_t)_mm_movemask_epi8(SimdIsAsciiWhitespace128<TChar>(chunk)) & 0xFFFFu;
+			if (mask)
+			{
+				return first + std::countr_zero(mask) / sizeof(TChar);
+			}
+		}
+
+		for (; first < last; ++first)
+		{
+			const uint32_t ch = (uint32_t)std::make_unsigned_t<TChar>(*first);
+			if (ch != 0x20 && ch - 0x09 > 0x04)
+			{
+				return first;
+			}
+		}
+		return last;
+	}
+
+
+	/**
+	 * @brief    Skips the ASCII whitespace from the end of [first, last).
+	 * @returns  The position past the last character which is not ASCII whitespace, or `first`.
+	 * @details  向量化跳过结尾空格。
+	 */
+	template <typename TChar>
+	const TChar* SimdSkipAsciiWhitespaceBackward(const TChar* first, const TChar* last) noexcept
+	{
+#if defined(__AVX2__)
+		constexpr ptrdiff_t Lanes256 = 32 / sizeof(TChar);
+		for (; last - first >= Lanes256; last -= Lanes256)
+		{
+			const __m256i chunk = _mm256_loadu_si256((const __m256i*)(last - Lanes256));
+			const uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(SimdIsAsciiWhitespace256<TChar>(chunk));
+			if (mask)
+			{
+				return last - Lanes256 + (31 - std::countl_zero(mask)) / sizeof(TChar) + 1;
+			}
+		}
+#endif
+
+		constexpr ptrdiff_t Lanes128 = 16 / sizeof(TChar);
+		for (; last - first >= Lanes128; last -= Lanes128)
+		{
+			const __m128i chunk = _mm_loadu_si128((const __m128i*)(last - Lanes128));
+			const uint32_t mask = ~(uint32_t)_mm_movemask_epi8(SimdIsAsciiWhitespace128<TChar>(chunk)) & 0xFFFFu;
+			if (mask)
+			{
+				return last - Lanes128 + (31 - std::countl_zero(mask)) / sizeof(TChar) + 1;
+			}
+		}
+
+		for (; last > first; --last)
+		{
+			const uint32_t ch = (uint32_t)std::make_unsigned_t<TChar>(last[-1]);
+			if (ch != 0x20 && ch - 0x09 > 0x04)
+			{
+				return last;
+			}
+		}
+		return first;
+	}
+}
+
+
+
 /** Template char builder. */
 namespace Furud::Internal
 {
@@ -55,13 +375,13 @@ namespace Furud::Internal
 				// vertical tab    (0x0b, '\v').
 				// form feed       (0x0c, '\f')
 				// carriage return (0x0d, '\r')
-				if (static_cast<uint16_t>(ch) >= 0x09ui16 && static_cast<uint16_t>(ch) <= 0x0Dui16)
+				if (static_cast<uint16_t>(ch) >= uint16_t(0x09) && static_cast<uint16_t>(ch) <= uint16_t(0x0D))
 				{
 					return true;
 				}
 
 				// space  (0x20, ' ').
-				if (static_cast<uint16_t>(ch) == 0x20ui16)
+				if (static_cast<uint16_t>(ch) == uint16_t(0x20))
 				{
 					return true;
 				}
@@ -82,6 +402,64 @@ namespace Furud::Internal
 		}
 
 
+		/**
+		 * @brief    Skips the whitespace from the start of a buffer.
+		 * @returns  Index of the first character which is not whitespace, or `size`.
+		 * @details  跳过开头的空格符号。(支持常量求值)
+		 */
+		furud_nodiscard static constexpr TSize SkipWhitespace(const TChar* furud_restrict str, TSize size) noexcept
+		{
+			TSize index = 0;
+			while (index < size)
+			{
+				// The ASCII whitespace is skipped by vector, the others are left to `IsWhitespace`.
+				if (!std::is_constant_evaluated())
+				{
+					index = static_cast<TSize>(SimdSkipAsciiWhitespace(str + index, str + size) - str);
+					if (index == size)
+					{
+						break;
+					}
+				}
+
+				if (!IsWhitespace(str[index]))
+				{
+					break;
+				}
+				++index;
+			}
+			return index;
+		}
+
+
+		/**
+		 * @brief    Skips the whitespace from the end of a buffer.
+		 * @returns  Size of the buffer without the trailing whitespace.
+		 * @details  跳过结尾的空格符号。(支持常量求值)
+		 */
+		furud_nodiscard static constexpr TSize SkipWhitespaceBackward(const TChar* furud_restrict str, TSize size) noexcept
+		{
+			while (size > 0)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					size = static_cast<TSize>(SimdSkipAsciiWhitespaceBackward(str, str + size) - str);
+					if (size == 0)
+					{
+						break;
+					}
+				}
+
+				if (!IsWhitespace(str[size - 1]))
+				{
+					break;
+				}
+				--size;
+			}
+			return size;
+		}
+
+
 		/**
 		 * @brief    Convert the character to uppercase.
 		 * @details  转换成大写。(支持常量求值)
@@ -248,14 +626,7 @@ namespace Furud::Internal
 		 */
 		furud_nodiscard static constexpr TSize Length(const TChar* furud_restrict str) noexcept
 		{
-			if constexpr (std::same_as<TChar, char>)
-			{
-				return str == nullptr ? 0ull : static_cast<TSize>(__builtin_strlen(str));
-			}
-			else
-			{
-				return str == nullptr ? 0ull : static_cast<TSize>(__builtin_wcslen(str));
-			}
+			return str == nullptr ? 0ull : static_cast<TSize>(std::char_traits<TChar>::length(str));
 		}
 
 
@@ -272,14 +643,7 @@ namespace Furud::Internal
 			, TSize count
 		) noexcept
 		{
-			if constexpr (std::same_as<TChar, char>)
-			{
-				return __builtin_memcmp(str1, str2, count);
-			}
-			else
-			{
-				return __builtin_wmemcmp(str1, str2, count);
-			}
+			return std::char_traits<TChar>::compare(str1, str2, count);
 		}
 
 		/**
@@ -294,14 +658,7 @@ namespace Furud::Internal
 			, const TSize size
 		) noexcept
 		{
-			if constexpr (std::same_as<TChar, char>)
-			{
-				return __builtin_char_memchr(str, ch, size);
-			}
-			else
-			{
-				return __builtin_wmemchr(str, ch, size);
-			}
+			return const_cast<TChar*>(Locate(const_cast<const TChar*>(str), ch, size));
 		}
 
 
@@ -317,13 +674,14 @@ namespace Furud::Internal
 			, const TSize size
 		) noexcept
 		{
-			if constexpr (std::same_as<TChar, char>)
+			if (std::is_constant_evaluated())
 			{
-				return __builtin_char_memchr(str, ch, size);
+				return std::char_traits<TChar>::find(str, size, ch);
 			}
 			else
 			{
-				return __builtin_wmemchr(str, ch, size);
+				const TChar* found = SimdFindChar(str, str + size, ch);
+				return found != str + size ? found : nullptr;
 			}
 		}
 
@@ -378,6 +736,12 @@ namespace Furud::Internal
 				return from;
 			}
 
+			if (!std::is_constant_evaluated())
+			{
+				const TChar* found = SimdFindString(str + from, str + strSize, search, size_t(searchSize));
+				return found != str + strSize ? static_cast<TSize>(found - str) : npos;
+			}
+
 			const auto tryEnd = str + (strSize - searchSize) + 1;
 			for (auto tryPtr = str + from; ; ++tryPtr)
 			{
@@ -446,23 +810,52 @@ namespace Furud::Internal
 
 
 		/**
-		 * @brief    Converts a string to 64-bit floating point (double).
-		 * @returns  0 if failure.
-		 * @details  字符串转浮点数。
+		 * @brief    Parses a number at the beginning of a buffer, the buffer needs no null terminator.
+		 *           The format is locale-independent, the floating point is correctly rounded,
+		 *           and the integer saturates on overflow.
+		 * @returns  The number of characters consumed, 0 if failure.
+		 * @details  解析数值，返回消耗的字符数。
 		 */
-		furud_nodiscard furud_inline static double ToDouble(const TChar* str) noexcept
+		template <typename T> requires Internal::is_parsable_number<T>
+		furud_inline static TSize Parse(const TChar* furud_restrict str, TSize size, T& outValue) noexcept
 		{
-			if constexpr (std::same_as<TChar, char>)
+			if constexpr (std::is_floating_point_v<T>)
 			{
-				return ::atof(str);
+				return static_cast<TSize>(Internal::ParseFloatingPoint(str, str + size, outValue));
 			}
 			else
 			{
-				return ::_wtof(str);
+				return static_cast<TSize>(Internal::ParseInteger(str, str + size, outValue));
 			}
 		}
 
 
+		/**
+		 * @brief    Converts a buffer to a number, the leading whitespace is skipped.
+		 * @returns  0 if failure.
+		 * @details  字符串转数值。
+		 */
+		template <typename T> requires Internal::is_parsable_number<T>
+		furud_nodiscard furud_inline static T ToNumber(const TChar* furud_restrict str, TSize size) noexcept
+		{
+			T value = 0;
+			const TSize spaceNum = SkipWhitespace(str, size);
+			Parse(str + spaceNum, size - spaceNum, value);
+			return value;
+		}
+
+
+		/**
+		 * @brief    Converts a string to 64-bit floating point (double).
+		 * @returns  0 if failure.
+		 * @details  字符串转浮点数。
+		 */
+		furud_nodiscard furud_inline static double ToDouble(const TChar* str) noexcept
+		{
+			return ToNumber<double>(str, Length(str));
+		}
+
+
 		/**
 		 * @brief    Converts a string to 32-bit floating point (float).
 		 * @returns  0 if failure.
@@ -470,83 +863,55 @@ namespace Furud::Internal
 		 */
 		furud_nodiscard furud_inline static float ToFloat(const TChar* str) noexcept
 		{
-			return static_cast<float>(ToDouble(str));
+			return ToNumber<float>(str, Length(str));
 		}
 
 
 		/**
 		 * @brief    Converts a string to a 64-bit integer.
 		 * @returns  0 if failure.
-		 *           LLONG_MIN/LLONG_MAX if overflow.
+		 *           INT64_MIN/INT64_MAX if overflow.
 		 * @details  字符串转整型。
 		 */
 		furud_nodiscard furud_inline static int64_t ToInt64(const TChar* str) noexcept
 		{
-			if constexpr (std::same_as<TChar, char>)
-			{
-				return ::_atoi64(str);
-			}
-			else
-			{
-				return ::_wtoi64(str);
-			}
+			return ToNumber<int64_t>(str, Length(str));
 		}
 
 
 		/**
 		 * @brief    Converts a string to an unsigned 64-bit integer.
 		 * @returns  0 if failure.
-		 *           ULLONG_MAX if overflow.
+		 *           UINT64_MAX if overflow.
 		 * @details  字符串转整型。
 		 */
 		furud_nodiscard furud_inline static uint64_t ToUint64(const TChar* str) noexcept
 		{
-			if constexpr (std::same_as<TChar, char>)
-			{
-				return ::_strtoui64(str, nullptr, 10);
-			}
-			else
-			{
-				return ::_wcstoui64(str, nullptr, 10);
-			}
+			return ToNumber<uint64_t>(str, Length(str));
 		}
 
 
 		/**
 		 * @brief    Converts a string to a 32-bit integer.
 		 * @returns  0 if failure.
-		 *           LONG_MIN/LONG_MAX if overflow.
+		 *           INT32_MIN/INT32_MAX if overflow.
 		 * @details  字符串转整型。
 		 */
 		furud_nodiscard furud_inline static int32_t ToInt32(const TChar* str) noexcept
 		{
-			if constexpr (std::same_as<TChar, char>)
-			{
-				return ::atoi(str);
-			}
-			else
-			{
-				return ::_wtoi(str);
-			}
+			return ToNumber<int32_t>(str, Length(str));
 		}
 
 
 		/**
 		 * @brief    Converts a string to an unsigned 32-bit integer.
 		 * @returns  0 if failure.
-		 *           ULONG_MAX if overflow.
+		 *           UINT32_MAX if overflow.
 		 * @details  字符串转整型。
 		 */
 		furud_nodiscard furud_inline static uint32_t ToUint32(const TChar* str) noexcept
 		{
-			if constexpr (std::same_as<TChar, char>)
-			{
-				return ::strtoul(str, nullptr, 10);
-			}
-			else
-			{
-				return ::wcstoul(str, nullptr, 10);
-			}
+			return ToNumber<uint32_t>(str, Length(str));
 		}
 	};
 }
@@ -658,7 +1023,7 @@ namespace Furud::Internal
 
 	protected:
 		const TChar* data;
-		const TSize size;
+		TSize size;
 
 
 	public:
@@ -682,11 +1047,12 @@ namespace Furud::Internal
 			, size(std::max<TSize>(TSize(inLast - inFirst), 0))
 		{}
 
-		constexpr TCharArrayView(const TCharArray<C, S>& inArr) noexcept;
+		template <typename A>
+		constexpr TCharArrayView(const TCharArray<C, S, A>& inArr) noexcept;
 
 		constexpr TCharArrayView(const TCharArrayView&) noexcept = default;
 
-		constexpr TCharArrayView& operator = (const TCharArrayView&) noexcept = delete;
+		constexpr TCharArrayView& operator = (const TCharArrayView&) noexcept = default;
 
 
 	public:
@@ -753,15 +1119,7 @@ namespace Furud::Internal
 		 */
 		furud_nodiscard constexpr TCharArrayView TrimLeft() const noexcept
 		{
-			TSize spaceNum = 0;
-			for (TSize i = 0; i < size; ++i)
-			{
-				if (!IStringBuilder::IsWhitespace(data[i]))
-				{
-					break;
-				}
-				++spaceNum;
-			}
+			const TSize spaceNum = IStringBuilder::SkipWhitespace(data, size);
 			return { data + spaceNum, size - spaceNum };
 		};
 
@@ -771,12 +1129,7 @@ namespace Furud::Internal
 		 */
 		furud_nodiscard constexpr TCharArrayView TrimRight() const noexcept
 		{
-			TSize newSize = size;
-			while (newSize > 0 && IStringBuilder::IsWhitespace(data[newSize - 1]))
-			{
-				--newSize;
-			}
-			return { data, newSize };
+			return { data, IStringBuilder::SkipWhitespaceBackward(data, size) };
 		};
 
 		/**
@@ -805,7 +1158,7 @@ namespace Furud::Internal
 		 */
 		furud_nodiscard constexpr bool EndWith(const TChar& suffix) const noexcept
 		{
-			return size >= 1 && data[size - 1] = suffix;
+			return size >= 1 && data[size - 1] == suffix;
 		}
 
 		/**
@@ -835,7 +1188,7 @@ namespace Furud::Internal
 			}
 
 			TSize newSize = size - suffix.size;
-			TCharArrayView sub{ data + newSize, newSize };
+			TCharArrayView sub{ data + newSize, suffix.size };
 			return suffix == sub;
 		}
 
@@ -867,40 +1220,51 @@ namespace Furud::Internal
 
 
 	public:
+		/**
+		 * @brief    Parses a number at the beginning of this view.
+		 * @returns  The number of characters consumed, 0 if failure.
+		 * @details  解析数值，返回消耗的字符数。
+		 */
+		template <typename T> requires Internal::is_parsable_number<T>
+		furud_inline TSize Parse(T& outValue) const noexcept
+		{
+			return IStringBuilder::Parse(data, size, outValue);
+		}
+
 		/**
 		 * @brief    Converts to double number.
 		 * @details  转换成双精度浮点数。
 		 */
-		furud_nodiscard constexpr double ToDouble() const noexcept
+		furud_nodiscard furud_inline double ToDouble() const noexcept
 		{
-			return IStringBuilder::ToDouble(data);
+			return IStringBuilder::template ToNumber<double>(data, size);
 		}
 
 		/**
 		 * @brief    Converts to float number.
 		 * @details  转换成单精度浮点数。
 		 */
-		furud_nodiscard constexpr float ToFloat() const noexcept
+		furud_nodiscard furud_inline float ToFloat() const noexcept
 		{
-			return IStringBuilder::ToFloat(data);
+			return IStringBuilder::template ToNumber<float>(data, size);
 		}
 
 		/**
 		 * @brief    Converts to 64-bit signed integer number.
 		 * @details  转换成64位有符号整数。
 		 */
-		furud_nodiscard constexpr int64_t ToInt64() const noexcept
+		furud_nodiscard furud_inline int64_t ToInt64() const noexcept
 		{
-			return IStringBuilder::ToInt64(data);
+			return IStringBuilder::template ToNumber<int64_t>(data, size);
 		}
 
 		/**
 		 * @brief    Converts to 32-bit signed integer number.
-		 * @details  转换成64位有符号整数。
+		 * @details  转换成32位有符号整数。
 		 */
-		furud_nodiscard constexpr int32_t ToInt32() const noexcept
+		furud_nodiscard furud_inline int32_t ToInt32() const noexcept
 		{
-			return IStringBuilder::ToInt32(data);
+			return IStringBuilder::template ToNumber<int32_t>(data, size);
 		}
 
 
@@ -935,30 +1299,141 @@ namespace Furud::Internal
 	/**
 	 * @brief    This template describes the minimal common interface necessary to read character than std::string.
 	 * 	         In particular, it is noniterable and noncopyable. But it can be duplicated by Clone() function.
+	 *           Short arrays are stored inline without allocation, the longer ones come from the allocator `A`,
+	 *           which provides the static `Alloc`, `Free` and `CalculateCapacityGrowth` like `TStringAllocator`.
 	 * @tparam   C  -  Char type.
 	 * @tparam   S  -  Size type.
+	 * @tparam   A  -  Allocator type.
 	 * @details  一个更简易通用的字符串实现，可替代std::string。有更常用的接口。此外
 	 *              -  禁止placement new，避免不良编程方式导致的内存泄露。
 	 *              -  禁止拷贝复制行为，从而保证任何地方只能通过指针或引用使用，除非使用显示的Clone函数。
+	 *              -  短字符串内联存储，不申请内存。
 	 */
-	template <typename C, typename S>
+	template <typename C, typename S, typename A>
 	class TCharArray
 	{
 	public:
 		using TChar = C;
 		using TSize = S;
+		using TAllocator = A;
 		static constexpr TSize npos = TSize(-1);
 
+		/** The inline capacity including the terminator, 22 characters of `char` or 10 of 16-bit `wchar_t`. */
+		static constexpr TSize InlineCapacity = TSize(23 / sizeof(TChar));
+
 
 	protected:
 		using IStringBuilder = TStringBuilder<TChar, TSize>;
-		using ICharAllocator = TStringAllocator<TChar, TSize>;
+		using ICharAllocator = A;
+
+		/** The top bit of `sizeAndFlag`, set if the characters are stored on the heap. */
+		static constexpr TSize HeapFlag = TSize(TSize(1) << (sizeof(TSize) * 8 - 1));
 
 
 	protected:
-		TChar* data;
-		TSize size;
-		TSize capacity;
+		/** The heap storage, overlaps the inline storage. */
+		struct HeapStorage
+		{
+			TChar* data;
+			TSize capacity;
+		};
+
+		union
+		{
+			HeapStorage heap;
+			TChar inlineData[InlineCapacity];
+		};
+
+		/** The number of characters, and the storage flag in the top bit. */
+		TSize sizeAndFlag;
+
+
+	protected:
+		/**
+		 * @brief    Sets the number of characters, the storage is unchanged.
+		 * @details  设置字符数量。
+		 */
+		furud_inline void SetSize(const TSize& inSize) noexcept
+		{
+			sizeAndFlag = (sizeAndFlag & HeapFlag) | inSize;
+		}
+
+		/**
+		 * @brief    Points to the storage of at least `inCapacity` characters, uninitialized.
+		 *           The array must not own any heap storage, its size becomes zero.
+		 * @details  申请存储空间。
+		 */
+		furud_inline void Allocate(const TSize& inCapacity)
+		{
+			if (inCapacity <= InlineCapacity)
+			{
+				sizeAndFlag = 0;
+			}
+			else
+			{
+				ICharAllocator::Alloc(inCapacity, &heap.data, &heap.capacity);
+				sizeAndFlag = HeapFlag;
+			}
+		}
+
+		/**
+		 * @brief    Moves to the storage of `inCapacity` characters, the first `keepSize` characters are kept.
+		 * @details  重新申请存储空间。
+		 */
+		furud_inline void Reallocate(const TSize& inCapacity, const TSize& keepSize)
+		{
+			const bool bOldInline = IsInline();
+			if (inCapacity <= InlineCapacity)
+			{
+				if (!bOldInline)
+				{
+					// The heap pointer is overwritten by the copy.
+					TChar* oldData = heap.data;
+					IStringBuilder::Copy(inlineData, InlineCapacity, oldData, keepSize);
+					ICharAllocator::Free(oldData);
+					sizeAndFlag &= ~HeapFlag;
+				}
+				return;
+			}
+
+			// Allocates aside first, the inline characters would be overwritten by the heap pointer.
+			TChar* newData;
+			TSize newCapacity;
+			ICharAllocator::Alloc(inCapacity, &newData, &newCapacity);
+			if (keepSize != 0)
+			{
+				IStringBuilder::Copy(newData, newCapacity, Data(), keepSize);
+			}
+
+			if (!bOldInline)
+			{
+				ICharAllocator::Free(heap.data);
+			}
+			heap.data = newData;
+			heap.capacity = newCapacity;
+			sizeAndFlag |= HeapFlag;
+		}
+
+		/**
+		 * @brief    Takes the storage of `inArr`, which is left empty.
+		 *           The array must not own any heap storage.
+		 * @details  接管另一个数组的存储空间。
+		 */
+		furud_inline void Steal(TCharArray& inArr) noexcept
+		{
+			if (inArr.IsInline())
+			{
+				IStringBuilder::Copy(inlineData, InlineCapacity, inArr.inlineData, inArr.Size() + 1);
+			}
+			else
+			{
+				heap = inArr.heap;
+			}
+			sizeAndFlag = inArr.sizeAndFlag;
+
+			inArr.sizeAndFlag = 0;
+			inArr.inlineData[0] = TChar(0);
+		}
 
 
 	public:
@@ -973,77 +1448,77 @@ namespace Furud::Internal
 		void* operator new (size_t) { return ::new TCharArray; }
 
 		constexpr TCharArray() noexcept
-			: data(nullptr)
-			, size(0)
-			, capacity(0)
+			: inlineData{}
+			, sizeAndFlag(0)
 		{}
 
 		virtual ~TCharArray()
 		{
-			ICharAllocator::Free(data);
-			data = nullptr;
-			size = capacity = 0;
+			if (!IsInline())
+			{
+				ICharAllocator::Free(heap.data);
+			}
+			sizeAndFlag = 0;
+			inlineData[0] = TChar(0);
 		}
 
 		furud_inline TCharArray(const TChar* inData)
 		{
-			size = (TSize)IStringBuilder::Length(inData);
-			ICharAllocator::Alloc(size + 1, &data, &capacity);
-			IStringBuilder::Assign(data, size + 1, inData, size);
+			const TSize length = (TSize)IStringBuilder::Length(inData);
+			Allocate(length + 1);
+			IStringBuilder::Assign(Data(), length + 1, inData, length);
+			SetSize(length);
 		}
 
 		furud_inline TCharArray(const TSize& inSize)
 		{
-			size = inSize;
-			ICharAllocator::Alloc(size + 1, &data, &capacity);
-			data[0] = TSize(0);
+			Allocate(inSize + 1);
+			Data()[0] = TChar(0);
+			SetSize(inSize);
 		}
 
 		furud_inline TCharArray(const TCharArrayView<TChar, TSize>& inData)
 		{
-			size = inData.Size();
-			ICharAllocator::Alloc(size + 1, &data, &capacity);
-			IStringBuilder::Assign(data, size + 1, inData, size);
+			const TSize length = inData.Size();
+			Allocate(length + 1);
+			IStringBuilder::Assign(Data(), length + 1, inData.Data(), length);
+			SetSize(length);
 		}
 
 		furud_inline TCharArray(const TSize& inSize, const TChar& ch)
 		{
-			size = inSize;
-			ICharAllocator::Alloc(size + 1, &data, &capacity);
-			IStringBuilder::Assign(data, ch, size);
-			data[size] = TSize(0);
+			Allocate(inSize + 1);
+			TChar* data = Data();
+			IStringBuilder::Assign(data, ch, inSize);
+			data[inSize] = TChar(0);
+			SetSize(inSize);
 		}
 
 		furud_inline TCharArray(TCharArray&& inArr) noexcept
 		{
-			std::swap(data, inArr.data);
-			std::swap(size, inArr.size);
-			std::swap(capacity, inArr.capacity);
-			inArr.~TCharArray();
+			Steal(inArr);
 		}
 
 		furud_inline TCharArray& operator = (TCharArray&& inArr) noexcept
 		{
-			Swap(inArr);
-			inArr.~TCharArray();
+			if (this != &inArr)
+			{
+				if (!IsInline())
+				{
+					ICharAllocator::Free(heap.data);
+				}
+				Steal(inArr);
+			}
 			return *this;
 		}
 
-		furud_inline TCharArray Clone() noexcept
-		{
-			TCharArray arr;
-			arr.size = size;
-			ICharAllocator::Alloc(arr.size + 1, &arr.data, &arr.capacity);
-			IStringBuilder::Assign(arr.data, arr.size + 1, data, size);
-			return arr;
-		}
-
 		furud_inline TCharArray Clone() const noexcept
 		{
+			const TSize size = Size();
 			TCharArray arr;
-			arr.size = size;
-			ICharAllocator::Alloc(arr.size + 1, &arr.data, &arr.capacity);
-			IStringBuilder::Assign(arr.data, arr.size + 1, data, size);
+			arr.Allocate(size + 1);
+			IStringBuilder::Assign(arr.Data(), size + 1, Data(), size);
+			arr.SetSize(size);
 			return arr;
 		}
 
@@ -1051,37 +1526,46 @@ namespace Furud::Internal
 	public:
 		furud_nodiscard constexpr TChar* Data() noexcept
 		{
-			return data;
+			return IsInline() ? inlineData : heap.data;
 		}
 
 		furud_nodiscard constexpr const TChar* Data() const noexcept
 		{
-			return data;
+			return IsInline() ? inlineData : heap.data;
 		}
 
 		furud_nodiscard constexpr TSize Size() const noexcept
 		{
-			return size;
+			return sizeAndFlag & ~HeapFlag;
 		}
 
 		furud_nodiscard constexpr TSize Capacity() const noexcept
 		{
-			return capacity;
+			return IsInline() ? InlineCapacity : heap.capacity;
 		}
 
 		furud_nodiscard constexpr bool IsEmpty() const noexcept
 		{
-			return size == 0;
+			return Size() == 0;
+		}
+
+		/**
+		 * @brief    Tests whether the characters are stored inline.
+		 * @details  是否内联存储。
+		 */
+		furud_nodiscard constexpr bool IsInline() const noexcept
+		{
+			return (sizeAndFlag & HeapFlag) == 0;
 		}
 
 		constexpr TChar& operator[] (const TSize& index) noexcept
 		{
-			return data[index];
+			return Data()[index];
 		}
 
 		constexpr const TChar& operator[] (const TSize& index) const noexcept
 		{
-			return data[index];
+			return Data()[index];
 		}
 
 
@@ -1092,12 +1576,8 @@ namespace Furud::Internal
 		 */
 		furud_inline void Clear()
 		{
-			size = 0;
-
-			if (capacity)
-			{
-				data[size] = TChar(0);
-			}
+			SetSize(0);
+			Data()[0] = TChar(0);
 		}
 
 		/**
@@ -1106,17 +1586,14 @@ namespace Furud::Internal
 		 */
 		furud_inline void Empty(const TSize& inCapacity = 0)
 		{
-			size = 0;
+			SetSize(0);
 
-			if (capacity < inCapacity)
+			if (Capacity() < inCapacity)
 			{
-				ICharAllocator::Realloc(&data, &capacity, inCapacity, 0);
+				Reallocate(inCapacity, 0);
 			}
 
-			if (capacity)
-			{
-				data[size] = TChar(0);
-			}
+			Data()[0] = TChar(0);
 		}
 
 		/**
@@ -1126,35 +1603,39 @@ namespace Furud::Internal
 		furud_inline void Reserve(const TSize& inCapacity)
 		{
 			// Requested the new capacity is not larger than current capacity, ignore.
-			if (capacity >= inCapacity)
+			if (Capacity() >= inCapacity)
 			{
 				return;
 			}
 
-			ICharAllocator::Realloc(&data, &capacity, inCapacity, size);
+			Reallocate(inCapacity, Size() + 1);
 		}
 
 		/**
 		 * @brief    Shrinks the array. Then it only uses smallest memory storage as possible.
+		 *           The array goes back to the inline storage if it fits.
 		 * @details  缩紧数组内存。
 		 */
 		furud_inline void Shrink()
 		{
-			if (size + 1 != capacity)
+			const TSize size = Size();
+			if (IsInline() || size + 1 == heap.capacity)
 			{
-				ICharAllocator::Realloc(&data, &capacity, size + 1, size);
+				return;
 			}
+
+			Reallocate(size + 1, size + 1);
 		}
 
 		/**
 		 * @brief    Swap the array's used memory.
 		 * @details  互换内存。
 		 */
-		constexpr void Swap(TCharArray& rhs) noexcept
+		furud_inline void Swap(TCharArray& rhs) noexcept
 		{
-			std::swap(data, rhs.data);
-			std::swap(size, rhs.size);
-			std::swap(capacity, rhs.capacity);
+			TCharArray temp(std::move(rhs));
+			rhs.Steal(*this);
+			Steal(temp);
 		}
 
 		/**
@@ -1164,17 +1645,16 @@ namespace Furud::Internal
 		 */
 		furud_inline void Push(const TChar& ch)
 		{
-			if (size + 1 >= capacity)
+			const TSize size = Size();
+			if (size + 1 >= Capacity())
 			{
-				ICharAllocator::Realloc
-					( &data
-					, &capacity
-					, ICharAllocator::CalculateCapacityGrowth(capacity)
-					, size
-				);
+				Reallocate(ICharAllocator::CalculateCapacityGrowth(Capacity()), size);
 			}
 
-			data[size++] = ch;
+			TChar* data = Data();
+			data[size] = ch;
+			data[size + 1] = TChar(0);
+			SetSize(size + 1);
 		}
 
 		/**
@@ -1184,7 +1664,8 @@ namespace Furud::Internal
 		 */
 		constexpr void PushUnsafe(const TChar& ch) noexcept
 		{
-			data[size++] = ch;
+			Data()[Size()] = ch;
+			++sizeAndFlag;
 		}
 
 		/**
@@ -1194,12 +1675,9 @@ namespace Furud::Internal
 		 */
 		furud_inline TChar Pop() noexcept
 		{
-			if (size > 0)
+			if (Size() > 0)
 			{
-				--size;
-				TChar ch = data[size];
-				data[size] = TChar(0);
-				return ch;
+				return PopUnsafe();
 			}
 
 			return TChar(0);
@@ -1212,7 +1690,9 @@ namespace Furud::Internal
 		 */
 		furud_inline TChar PopUnsafe() noexcept
 		{
-			--size;
+			--sizeAndFlag;
+			TChar* data = Data();
+			const TSize size = Size();
 			TChar ch = data[size];
 			data[size] = TChar(0);
 			return ch;
@@ -1230,26 +1710,32 @@ namespace Furud::Internal
 				return;
 			}
 
-			TSize newSize = size + inArr.Size();
-			if (newSize >= capacity)
+			const TSize size = Size();
+			const TSize newSize = size + inArr.Size();
+			if (newSize >= Capacity())
 			{
-				TSize newCapacity = 0;
-				TChar* newData = nullptr;
+				// The old storage is released after copy, `inArr` may point into it.
+				const bool bOldInline = IsInline();
+				TChar* newData;
+				TSize newCapacity;
 				ICharAllocator::Alloc(ICharAllocator::CalculateCapacityGrowth(newSize), &newData, &newCapacity);
-				IStringBuilder::Copy(newData, newCapacity, data, size);
+				IStringBuilder::Copy(newData, newCapacity, Data(), size);
 				IStringBuilder::Copy(newData + size, newCapacity - size, inArr.Data(), inArr.Size());
-				ICharAllocator::Free(data);
-				newData[newSize] = TChar(0);
-				data = newData;
-				size = newSize;
-				capacity = newCapacity;
+				if (!bOldInline)
+				{
+					ICharAllocator::Free(heap.data);
+				}
+				heap.data = newData;
+				heap.capacity = newCapacity;
+				sizeAndFlag = HeapFlag;
 			}
 			else
 			{
-				IStringBuilder::Copy(data + size, capacity - size, inArr.Data(), inArr.Size());
-				data[newSize] = TChar(0);
-				size = newSize;
+				IStringBuilder::Copy(Data() + size, Capacity() - size, inArr.Data(), inArr.Size());
 			}
+
+			Data()[newSize] = TChar(0);
+			SetSize(newSize);
 		}
 
 		/**
@@ -1259,7 +1745,7 @@ namespace Furud::Internal
 		 */
 		constexpr TSize IndexOf(const TChar& ch) noexcept
 		{
-			return (TSize)IStringBuilder::Find(data, ch, size, 0);
+			return (TSize)IStringBuilder::Find(Data(), ch, Size(), 0);
 		}
 
 		/**
@@ -1268,6 +1754,8 @@ namespace Furud::Internal
 		 */
 		furud_inline void ToUpper() noexcept
 		{
+			TChar* data = Data();
+			const TSize size = Size();
 			for (TSize i = 0; i != size; ++i)
 			{
 				data[i] = IStringBuilder::ToUpper(data[i]);
@@ -1280,6 +1768,8 @@ namespace Furud::Internal
 		 */
 		furud_inline void ToLower() noexcept
 		{
+			TChar* data = Data();
+			const TSize size = Size();
 			for (TSize i = 0; i != size; ++i)
 			{
 				data[i] = IStringBuilder::ToLower(data[i]);
@@ -1292,7 +1782,7 @@ namespace Furud::Internal
 		 */
 		furud_nodiscard constexpr bool StartWith(const TChar& prefix) const noexcept
 		{
-			return size >= 1 && data[0] == prefix;
+			return Size() >= 1 && Data()[0] == prefix;
 		}
 
 		/**
@@ -1301,7 +1791,7 @@ namespace Furud::Internal
 		 */
 		furud_nodiscard constexpr bool EndWith(const TChar& suffix) const noexcept
 		{
-			return size >= 1 && data[size - 1] = suffix;
+			return Size() >= 1 && Data()[Size() - 1] == suffix;
 		}
 
 		/**
@@ -1328,9 +1818,10 @@ namespace Furud::Internal
 		 */
 		furud_nodiscard constexpr TCharArrayView<TChar, TSize> Sub(const TSize& from, const TSize& count) const noexcept
 		{
+			const TSize size = Size();
 			return TCharArrayView<TChar, TSize>
 			{
-				from < size ? data + from : nullptr,
+				from < size ? Data() + from : nullptr,
 					std::min(size - from, count)
 			};
 		}
@@ -1343,7 +1834,7 @@ namespace Furud::Internal
 		{
 			if (search.Size() == replacement.Size())
 			{
-				IStringBuilder::Replace(data, search.Data(), replacement, Data(), size, search.Size());
+				IStringBuilder::Replace(Data(), search.Data(), replacement, Data(), Size(), search.Size());
 			}
 		}
 	};
@@ -1351,7 +1842,8 @@ namespace Furud::Internal
 
 
 	template <typename C, typename S>
-	constexpr TCharArrayView<C, S>::TCharArrayView(const TCharArray<C, S>& inArr) noexcept
+	template <typename A>
+	constexpr TCharArrayView<C, S>::TCharArrayView(const TCharArray<C, S, A>& inArr) noexcept
 		: data(inArr.Data())
 		, size(inArr.Size())
 	{}
@@ -1365,4 +1857,8 @@ export namespace Furud
 	using WidecharArrayView  = Internal::TCharArrayView<wchar_t, size_t>;
 	using AnsicharArray      = Internal::TCharArray<char, size_t>;
 	using WidecharArray      = Internal::TCharArray<wchar_t, size_t>;
+
+	/** Char arrays with custom allocator. */
+	template <typename A> using TAnsicharArray = Internal::TCharArray<char, size_t, A>;
+	template <typename A> using TWidecharArray = Internal::TCharArray<wchar_t, size_t, A>;
 }
\ No newline at end of file
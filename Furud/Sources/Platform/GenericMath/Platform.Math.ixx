@@ -10,7 +10,9 @@ module;
 
 #include <Furud.hpp>
 #include <cmath>
+#if !FURUD_SIMD_PORTABLE
 #include <immintrin.h>
+#endif
 #include <concepts>
 
 
@@ -49,16 +51,16 @@ export namespace Furud
 		furud_nodiscard furud_inline decltype(auto) Abs(is_signed auto value) { return value > 0 ? value : -value; }
 
 
-		furud_nodiscard furud_inline float Copysign(float value, float sign) noexcept { return __copysignf(value, sign); }
-		furud_nodiscard furud_inline double Copysign(double value, double sign) noexcept { return __copysign(value, sign); }
+		furud_nodiscard furud_inline float Copysign(float value, float sign) noexcept { return std::copysign(value, sign); }
+		furud_nodiscard furud_inline double Copysign(double value, double sign) noexcept { return std::copysign(value, sign); }
 
 
-		furud_nodiscard furud_inline bool IsNaN(float value) noexcept { return _isnanf(value) != 0; }
-		furud_nodiscard furud_inline bool IsNaN(double value) noexcept { return _isnan(value) != 0; }
+		furud_nodiscard furud_inline bool IsNaN(float value) noexcept { return std::isnan(value); }
+		furud_nodiscard furud_inline bool IsNaN(double value) noexcept { return std::isnan(value); }
 
 
-		furud_nodiscard furud_inline bool IsFinite(float value) noexcept { return _finitef(value) != 0; }
-		furud_nodiscard furud_inline bool IsFinite(double value) noexcept { return _finite(value) != 0; }
+		furud_nodiscard furud_inline bool IsFinite(float value) noexcept { return std::isfinite(value); }
+		furud_nodiscard furud_inline bool IsFinite(double value) noexcept { return std::isfinite(value); }
 
 
 		furud_nodiscard furud_inline bool IsInfinite(float value) noexcept { return std::isinf(value) != 0; }
@@ -142,6 +144,9 @@ export namespace Furud
 
 		furud_nodiscard furud_inline float RecipSqrt(float value) noexcept
 		{
+#if FURUD_SIMD_PORTABLE || FURUD_SIMD_STRICT_IEEE
+			return 1.f / sqrtf(value);
+#else
 			const __m128 HALF = _mm_set_ss(0.5f);
 			__m128 x0, y0, x1, x2, fOver2;
 
@@ -162,10 +167,14 @@ export namespace Furud
 			x2 = _mm_fmadd_ss(x1, x2, x1);
 
 			return _mm_cvtss_f32(x2);
+#endif
 		}
 
 		furud_nodiscard furud_inline double RecipSqrt(double value) noexcept
 		{
+#if FURUD_SIMD_PORTABLE
+			return 1.0 / sqrt(value);
+#else
 			const __m128d ONE = _mm_set_sd(1.0);
 			__m128d v;
 
@@ -174,6 +183,7 @@ export namespace Furud
 			v = _mm_div_sd(ONE, v);
 
 			return _mm_cvtsd_f64(v);
+#endif
 		}
 	};
 }
@@ -21,21 +21,21 @@ export namespace Furud
 {
 	namespace IInteger
 	{
-		constexpr  int8_t I8_MIN = 0x80i8;  // -128
-		constexpr  int8_t I8_MAX = 0x7fi8;  //  127
-		constexpr uint8_t U8_MAX = 0xffui8; //  255
+		constexpr  int8_t I8_MIN = static_cast<int8_t>(0x80u);  // -128
+		constexpr  int8_t I8_MAX = static_cast<int8_t>(0x7fu);  //  127
+		constexpr uint8_t U8_MAX = static_cast<uint8_t>(0xffu); //  255
 
-		constexpr  int16_t I16_MIN = 0x8000i16;  // -32768
-		constexpr  int16_t I16_MAX = 0x7fffi16;  //  32767
-		constexpr uint16_t U16_MAX = 0xffffui16; //  65535
+		constexpr  int16_t I16_MIN = static_cast<int16_t>(0x8000u);  // -32768
+		constexpr  int16_t I16_MAX = static_cast<int16_t>(0x7fffu);  //  32767
+		constexpr uint16_t U16_MAX = static_cast<uint16_t>(0xffffu); //  65535
 
-		constexpr  int32_t I32_MIN = 0x80000000i32;  // -2147483648
-		constexpr  int32_t I32_MAX = 0x7fffffffi32;  //  2147483647
-		constexpr uint32_t U32_MAX = 0xffffffffui32; //  4294967295
+		constexpr  int32_t I32_MIN = static_cast<int32_t>(0x80000000u);  // -2147483648
+		constexpr  int32_t I32_MAX = static_cast<int32_t>(0x7fffffffu);  //  2147483647
+		constexpr uint32_t U32_MAX = static_cast<uint32_t>(0xffffffffu); //  4294967295
 
-		constexpr  int64_t I64_MIN = 0x8000000000000000i64;  // -9223372036854775808
-		constexpr  int64_t I64_MAX = 0x7fffffffffffffffi64;  //  9223372036854775807
-		constexpr uint64_t U64_MAX = 0xffffffffffffffffui64; // 18446744073709551615
+		constexpr  int64_t I64_MIN = static_cast<int64_t>(0x8000000000000000ull);  // -9223372036854775808
+		constexpr  int64_t I64_MAX = static_cast<int64_t>(0x7fffffffffffffffull);  //  9223372036854775807
+		constexpr uint64_t U64_MAX = static_cast<uint64_t>(0xffffffffffffffffull); // 18446744073709551615
 	};
 
 
@@ -0,0 +1,1075 @@
+//
+// Platform.Memory.AsyncIO.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Asynchronous file IO.
+//
+module;
+
+#include <Furud.hpp>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#if FURUD_OS_WIN
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#if FURUD_OS_LINUX
+#include <linux/io_uring.h>
+#endif
+#endif
+
+
+
+export module Furud.Platform.Memory.AsyncIO;
+
+export import Furud.Platform.API.CharArray;
+import Furud.Platform.Memory.FileStream;
+import Furud.Platform.Thread;
+import Furud.Platform.Thread.SpinLock;
+
+
+
+/** Async request. */
+export namespace Furud
+{
+	/**
+	 * @brief    Native file handle opened for asynchronous reading.
+	 * @details  异步文件句柄。
+	 */
+	struct AsyncFileHandle
+	{
+		intptr_t native = -1;
+
+		furud_nodiscard constexpr bool IsValid() const noexcept
+		{
+			return native != -1;
+		}
+	};
+
+
+	/**
+	 * @brief    The result of a read request.
+	 * @details  异步读取结果。
+	 */
+	struct AsyncReadResult
+	{
+		/** Less than the requested size if the file ends. */
+		int64_t bytesRead = 0;
+
+		bool bSuccess = false;
+	};
+
+
+	/**
+	 * @brief    Completion callback, invoked on the thread which polls the queue.
+	 * @details  异步读取完成回调。
+	 */
+	using AsyncReadCallback = void (*)(void* userData, const AsyncReadResult& result);
+
+
+	/**
+	 * @brief    Reads `size` bytes at `offset` of `file` into `destination`.
+	 * @details  异步读取请求。
+	 */
+	struct AsyncReadRequest
+	{
+		AsyncFileHandle file;
+		int64_t offset = 0;
+		int64_t size = 0;
+		void* destination = nullptr;
+		AsyncReadCallback callback = nullptr;
+		void* userData = nullptr;
+	};
+}
+
+
+
+/** Backend interface. */
+namespace Furud::Internal
+{
+	/** A request in flight, it is split into operations no larger than `MaxOperationSize`. */
+	struct AsyncPending
+	{
+		AsyncReadRequest request;
+		int64_t bytesRead;
+		uint32_t numRemaining;
+		bool bFailed;
+	};
+
+
+	/** A single read operation submitted to the backend. */
+	struct AsyncOperation
+	{
+#if FURUD_OS_WIN
+		/** Must be the first member, the completion port returns its address. */
+		OVERLAPPED overlapped;
+#else
+		struct iovec vector;
+
+		/** Bytes read by the previous parts of a short read. */
+		int64_t bytesDone;
+#endif
+		AsyncPending* pending;
+		intptr_t file;
+		int64_t offset;
+		uint8_t* destination;
+		uint32_t size;
+
+		/** Bytes read if non-negative, otherwise the error. */
+		int64_t result;
+
+		AsyncOperation* next;
+	};
+
+
+	/** The size limitation of a single native read. */
+	constexpr int64_t MaxOperationSize = int64_t(1) << 30;
+
+
+
+	class furud_interface IAsyncIOBackend
+	{
+	public:
+		constexpr IAsyncIOBackend() = default;
+
+		/** Noncopyable. */
+		IAsyncIOBackend(const IAsyncIOBackend&) = delete;
+
+		/** Noncopyable. */
+		IAsyncIOBackend& operator = (const IAsyncIOBackend&) = delete;
+
+		virtual ~IAsyncIOBackend() = default;
+
+
+	public:
+		virtual intptr_t Open(WidecharArrayView filename) = 0;
+
+		virtual void Close(intptr_t file) = 0;
+
+		/**
+		 * @brief    Submits operations in one batch.
+		 * @returns  The number of operations accepted, the rest should be submitted later.
+		 */
+		virtual uint32_t Submit(AsyncOperation** operations, uint32_t num) = 0;
+
+		/**
+		 * @brief    Reaps finished operations.
+		 * @param    bWait  -  Blocks until at least one operation finished.
+		 * @returns  The number of operations reaped.
+		 */
+		virtual uint32_t Reap(AsyncOperation** operations, uint32_t capacity, bool bWait) = 0;
+	};
+}
+
+
+
+#if FURUD_OS_WIN
+/** IO completion port backend. */
+namespace Furud::Internal
+{
+	class IOCPBackend final : public IAsyncIOBackend
+	{
+	private:
+		/** Marks the packets posted for operations failed at submission. */
+		static constexpr ULONG_PTR FailedKey = 1;
+
+		HANDLE port { nullptr };
+
+
+	public:
+		IOCPBackend() = default;
+
+		virtual ~IOCPBackend()
+		{
+			if (port)
+			{
+				::CloseHandle(port);
+			}
+		}
+
+		bool Init()
+		{
+			// see https://learn.microsoft.com/en-us/windows/win32/fileio/createiocompletionport
+			port = ::CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+			return port != nullptr;
+		}
+
+
+	public:
+		virtual intptr_t Open(WidecharArrayView filename) override
+		{
+			HANDLE file = ::CreateFileW
+				( filename.Data()
+				, GENERIC_READ /* desired access. */
+				, FILE_SHARE_READ /* sharing mode. */
+				, nullptr
+				, OPEN_EXISTING /* Open only if exists. */
+				, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED
+				, nullptr
+				);
+
+			if (file == INVALID_HANDLE_VALUE)
+			{
+				return -1;
+			}
+
+			// Associates the file with the port, all completions of this file go to the port.
+			if (!::CreateIoCompletionPort(file, port, 0, 0))
+			{
+				::CloseHandle(file);
+				return -1;
+			}
+
+			return (intptr_t)file;
+		}
+
+		virtual void Close(intptr_t file) override
+		{
+			::CloseHandle((HANDLE)file);
+		}
+
+		virtual uint32_t Submit(AsyncOperation** operations, uint32_t num) override
+		{
+			for (uint32_t index = 0; index < num; ++index)
+			{
+				AsyncOperation* operation = operations[index];
+				::memset(&operation->overlapped, 0, sizeof(OVERLAPPED));
+
+				ULARGE_INTEGER li;
+				li.QuadPart = (ULONGLONG)operation->offset;
+				operation->overlapped.Offset = li.LowPart;
+				operation->overlapped.OffsetHigh = li.HighPart;
+
+				// see https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-readfile
+				if (!::ReadFile((HANDLE)operation->file, operation->destination, operation->size, nullptr, &operation->overlapped))
+				{
+					const DWORD code = ::GetLastError();
+					if (code != ERROR_IO_PENDING)
+					{
+						// No packet is queued for a failed read, posts one so that it completes as usual.
+						operation->result = (code == ERROR_HANDLE_EOF) ? 0 : -int64_t(code);
+						::PostQueuedCompletionStatus(port, 0, FailedKey, &operation->overlapped);
+					}
+				}
+			}
+			return num;
+		}
+
+		virtual uint32_t Reap(AsyncOperation** operations, uint32_t capacity, bool bWait) override
+		{
+			OVERLAPPED_ENTRY entries[64];
+			ULONG numRemoved = 0;
+
+			// see https://learn.microsoft.com/en-us/windows/win32/fileio/getqueuedcompletionstatusex-func
+			if (!::GetQueuedCompletionStatusEx(port, entries, std::min<ULONG>(capacity, 64), &numRemoved, bWait ? INFINITE : 0, FALSE))
+			{
+				return 0;
+			}
+
+			for (ULONG index = 0; index < numRemoved; ++index)
+			{
+				AsyncOperation* operation = reinterpret_cast<AsyncOperation*>(entries[index].lpOverlapped);
+				if (entries[index].lpCompletionKey != FailedKey)
+				{
+					DWORD bytesRead = 0;
+					if (::GetOverlappedResult((HANDLE)operation->file, &operation->overlapped, &bytesRead, FALSE))
+					{
+						operation->result = bytesRead;
+					}
+					else
+					{
+						const DWORD code = ::GetLastError();
+						operation->result = (code == ERROR_HANDLE_EOF) ? 0 : -int64_t(code);
+					}
+				}
+				operations[index] = operation;
+			}
+			return numRemoved;
+		}
+	};
+}
+#endif
+
+
+
+#if FURUD_OS_LINUX
+/** io_uring backend. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Talks to io_uring by system calls directly, no liburing required.
+	 * @see      https://kernel.dk/io_uring.pdf
+	 * @details  io_uring 后端。
+	 */
+	class IOUringBackend final : public IAsyncIOBackend
+	{
+	private:
+		int ring { -1 };
+
+		uint8_t* sqRing { nullptr };
+		uint8_t* cqRing { nullptr };
+		size_t sqRingSize { 0 };
+		size_t cqRingSize { 0 };
+
+		io_uring_sqe* sqes { nullptr };
+		size_t sqesSize { 0 };
+
+		uint32_t* sqHead { nullptr };
+		uint32_t* sqTail { nullptr };
+		uint32_t* sqArray { nullptr };
+		uint32_t sqMask { 0 };
+		uint32_t sqEntries { 0 };
+
+		uint32_t* cqHead { nullptr };
+		uint32_t* cqTail { nullptr };
+		io_uring_cqe* cqes { nullptr };
+		uint32_t cqMask { 0 };
+
+		/** Remainders of short reads, waiting for a free submission entry. */
+		AsyncOperation* retryHead { nullptr };
+
+
+	public:
+		IOUringBackend() = default;
+
+		virtual ~IOUringBackend()
+		{
+			if (sqes)
+			{
+				::munmap(sqes, sqesSize);
+			}
+			if (cqRing && cqRing != sqRing)
+			{
+				::munmap(cqRing, cqRingSize);
+			}
+			if (sqRing)
+			{
+				::munmap(sqRing, sqRingSize);
+			}
+			if (ring >= 0)
+			{
+				::close(ring);
+			}
+		}
+
+		/**
+		 * @brief    Creates the ring.
+		 * @returns  False if io_uring is unavailable, e.g. old kernel or forbidden by seccomp.
+		 */
+		bool Init(uint32_t queueDepth)
+		{
+			io_uring_params params;
+			::memset(&params, 0, sizeof(params));
+
+			ring = (int)::syscall(__NR_io_uring_setup, queueDepth, &params);
+			if (ring < 0)
+			{
+				return false;
+			}
+
+			sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+			cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+			// Both rings share one mapping since linux 5.4.
+			const bool bSingleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+			if (bSingleMap)
+			{
+				sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+			}
+
+			void* sq = ::mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+			if (sq == MAP_FAILED)
+			{
+				return false;
+			}
+			sqRing = (uint8_t*)sq;
+
+			if (bSingleMap)
+			{
+				cqRing = sqRing;
+			}
+			else
+			{
+				void* cq = ::mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+				if (cq == MAP_FAILED)
+				{
+					return false;
+				}
+				cqRing = (uint8_t*)cq;
+			}
+
+			sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+			void* entries = ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES);
+			if (entries == MAP_FAILED)
+			{
+				return false;
+			}
+			sqes = (io_uring_sqe*)entries;
+
+			sqHead    = (uint32_t*)(sqRing + params.sq_off.head);
+			sqTail    = (uint32_t*)(sqRing + params.sq_off.tail);
+			sqArray   = (uint32_t*)(sqRing + params.sq_off.array);
+			sqMask    = *(uint32_t*)(sqRing + params.sq_off.ring_mask);
+			sqEntries = params.sq_entries;
+
+			cqHead = (uint32_t*)(cqRing + params.cq_off.head);
+			cqTail = (uint32_t*)(cqRing + params.cq_off.tail);
+			cqes   = (io_uring_cqe*)(cqRing + params.cq_off.cqes);
+			cqMask = *(uint32_t*)(cqRing + params.cq_off.ring_mask);
+
+			return true;
+		}
+
+		furud_nodiscard uint32_t NumEntries() const noexcept
+		{
+			return sqEntries;
+		}
+
+
+	public:
+		virtual intptr_t Open(WidecharArrayView filename) override
+		{
+			const std::string nativeFilename = ToNativeFilename(filename);
+			return (intptr_t)::open(nativeFilename.c_str(), O_RDONLY | O_CLOEXEC);
+		}
+
+		virtual void Close(intptr_t file) override
+		{
+			::close((int)file);
+		}
+
+		virtual uint32_t Submit(AsyncOperation** operations, uint32_t num) override
+		{
+			for (uint32_t index = 0; index < num; ++index)
+			{
+				operations[index]->bytesDone = 0;
+			}
+
+			PushRetries();
+			const uint32_t count = Push(operations, num);
+			Enter(0, 0);
+			return count;
+		}
+
+		virtual uint32_t Reap(AsyncOperation** operations, uint32_t capacity, bool bWait) override
+		{
+			uint32_t head = *cqHead;
+			if (bWait && head == std::atomic_ref<uint32_t>(*cqTail).load(std::memory_order_acquire))
+			{
+				Enter(1, IORING_ENTER_GETEVENTS);
+			}
+
+			const uint32_t tail = std::atomic_ref<uint32_t>(*cqTail).load(std::memory_order_acquire);
+			uint32_t count = 0;
+			for (; head != tail && count < capacity; ++head)
+			{
+				const io_uring_cqe& entry = cqes[head & cqMask];
+				AsyncOperation* operation = (AsyncOperation*)(uintptr_t)entry.user_data;
+
+				// A read may return fewer bytes than requested before the end of file,
+				// the remainder is read again as ThreadPoolBackend does.
+				if (entry.res > 0 && uint32_t(entry.res) < operation->size)
+				{
+					operation->bytesDone   += entry.res;
+					operation->offset      += entry.res;
+					operation->destination += entry.res;
+					operation->size        -= uint32_t(entry.res);
+					operation->next = retryHead;
+					retryHead = operation;
+					continue;
+				}
+
+				operation->result = entry.res < 0 ? int64_t(entry.res) : operation->bytesDone + entry.res;
+				operations[count++] = operation;
+			}
+
+			std::atomic_ref<uint32_t>(*cqHead).store(head, std::memory_order_release);
+
+			if (retryHead)
+			{
+				PushRetries();
+				Enter(0, 0);
+			}
+			return count;
+		}
+
+
+	private:
+		/** Fills submission entries, only this thread produces submissions, the kernel consumes them. */
+		uint32_t Push(AsyncOperation** operations, uint32_t num)
+		{
+			uint32_t tail = *sqTail;
+			const uint32_t head = std::atomic_ref<uint32_t>(*sqHead).load(std::memory_order_acquire);
+
+			uint32_t count = 0;
+			for (; count < num && tail - head < sqEntries; ++count, ++tail)
+			{
+				AsyncOperation* operation = operations[count];
+				operation->vector.iov_base = operation->destination;
+				operation->vector.iov_len = operation->size;
+
+				const uint32_t index = tail & sqMask;
+				io_uring_sqe* entry = &sqes[index];
+				::memset(entry, 0, sizeof(io_uring_sqe));
+				entry->opcode    = IORING_OP_READV;
+				entry->fd        = (int)operation->file;
+				entry->off       = (uint64_t)operation->offset;
+				entry->addr      = (uint64_t)(uintptr_t)&operation->vector;
+				entry->len       = 1;
+				entry->user_data = (uint64_t)(uintptr_t)operation;
+				sqArray[index] = index;
+			}
+
+			std::atomic_ref<uint32_t>(*sqTail).store(tail, std::memory_order_release);
+			return count;
+		}
+
+		/** Pushes the remainders of short reads, before any new operation. */
+		void PushRetries()
+		{
+			while (retryHead)
+			{
+				AsyncOperation* operation = retryHead;
+				if (Push(&operation, 1) == 0)
+				{
+					return;
+				}
+				retryHead = operation->next;
+			}
+		}
+
+		/** Submits all entries not consumed by the kernel yet, and waits for completions optionally. */
+		void Enter(uint32_t minComplete, uint32_t flags)
+		{
+			while (true)
+			{
+				const uint32_t toSubmit = *sqTail - std::atomic_ref<uint32_t>(*sqHead).load(std::memory_order_acquire);
+				if (toSubmit == 0 && minComplete == 0)
+				{
+					return;
+				}
+
+				// see https://man7.org/linux/man-pages/man2/io_uring_enter.2.html
+				const int result = (int)::syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, nullptr, 0);
+				if (result >= 0 || errno != EINTR)
+				{
+					return;
+				}
+			}
+		}
+	};
+}
+#endif
+
+
+
+#if !FURUD_OS_WIN
+/** Thread pool backend. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Blocking reads on a few threads, used when io_uring is unavailable.
+	 * @details  线程池后端。
+	 */
+	class ThreadPoolBackend final : public IAsyncIOBackend
+	{
+	private:
+		class Worker : public Thread
+		{
+		public:
+			ThreadPoolBackend* owner = nullptr;
+
+		protected:
+			virtual void Run() override
+			{
+				owner->WorkerLoop();
+			}
+		};
+
+
+		std::unique_ptr<Worker[]> workers;
+		uint32_t numWorkers { 0 };
+
+		AtomicSpinLock submitMutex;
+		AsyncOperation* submitHead { nullptr };
+		AsyncOperation* submitTail { nullptr };
+
+		AtomicSpinLock completeMutex;
+		AsyncOperation* completeHead { nullptr };
+
+		alignas(64) std::atomic<uint32_t> submitEpoch { 0 };
+		alignas(64) std::atomic<uint32_t> completeEpoch { 0 };
+		std::atomic<bool> bQuit { false };
+
+
+	public:
+		ThreadPoolBackend() = default;
+
+		virtual ~ThreadPoolBackend()
+		{
+			bQuit.store(true, std::memory_order_seq_cst);
+			submitEpoch.fetch_add(1, std::memory_order_seq_cst);
+			submitEpoch.notify_all();
+
+			for (uint32_t index = 0; index < numWorkers; ++index)
+			{
+				workers[index].Kill(true);
+			}
+		}
+
+		bool Init(uint32_t inNumWorkers)
+		{
+			numWorkers = std::max<uint32_t>(inNumWorkers, 1);
+			workers.reset(new Worker[numWorkers]);
+
+			for (uint32_t index = 0; index < numWorkers; ++index)
+			{
+				workers[index].owner = this;
+				if (!workers[index].Init({ "Furud AsyncIO", Thread::Priority::Normal, Thread::InitFlag::CreateRunnable }))
+				{
+					numWorkers = index;
+					return index > 0;
+				}
+			}
+			return true;
+		}
+
+
+	public:
+		virtual intptr_t Open(WidecharArrayView filename) override
+		{
+			const std::string nativeFilename = ToNativeFilename(filename);
+			return (intptr_t)::open(nativeFilename.c_str(), O_RDONLY | O_CLOEXEC);
+		}
+
+		virtual void Close(intptr_t file) override
+		{
+			::close((int)file);
+		}
+
+		virtual uint32_t Submit(AsyncOperation** operations, uint32_t num) override
+		{
+			if (num == 0)
+			{
+				return 0;
+			}
+
+			{
+				AtomicScopeLock lock(submitMutex);
+				for (uint32_t index = 0; index < num; ++index)
+				{
+					operations[index]->next = nullptr;
+					submitTail ? (submitTail->next = operations[index]) : (submitHead = operations[index]);
+					submitTail = operations[index];
+				}
+			}
+
+			submitEpoch.fetch_add(1, std::memory_order_seq_cst);
+			submitEpoch.notify_all();
+			return num;
+		}
+
+		virtual uint32_t Reap(AsyncOperation** operations, uint32_t capacity, bool bWait) override
+		{
+			while (true)
+			{
+				const uint32_t epoch = completeEpoch.load(std::memory_order_seq_cst);
+
+				uint32_t count = 0;
+				{
+					AtomicScopeLock lock(completeMutex);
+					while (completeHead && count < capacity)
+					{
+						operations[count++] = completeHead;
+						completeHead = completeHead->next;
+					}
+				}
+
+				if (count > 0 || !bWait)
+				{
+					return count;
+				}
+
+				completeEpoch.wait(epoch, std::memory_order_seq_cst);
+			}
+		}
+
+
+	private:
+		AsyncOperation* PopSubmitted()
+		{
+			AtomicScopeLock lock(submitMutex);
+			AsyncOperation* operation = submitHead;
+			if (operation)
+			{
+				submitHead = operation->next;
+				if (!submitHead)
+				{
+					submitTail = nullptr;
+				}
+			}
+			return operation;
+		}
+
+		void WorkerLoop()
+		{
+			while (!bQuit.load(std::memory_order_acquire))
+			{
+				const uint32_t epoch = submitEpoch.load(std::memory_order_seq_cst);
+				AsyncOperation* operation = PopSubmitted();
+				if (!operation)
+				{
+					submitEpoch.wait(epoch, std::memory_order_seq_cst);
+					continue;
+				}
+
+				// Reads until the end of file or done.
+				int64_t bytesRead = 0;
+				while (bytesRead < operation->size)
+				{
+					const ssize_t result = ::pread((int)operation->file, operation->destination + bytesRead, size_t(operation->size - bytesRead), off_t(operation->offset + bytesRead));
+					if (result > 0)
+					{
+						bytesRead += result;
+					}
+					else if (result == 0)
+					{
+						break;
+					}
+					else if (errno != EINTR)
+					{
+						bytesRead = -int64_t(errno);
+						break;
+					}
+				}
+				operation->result = bytesRead;
+
+				{
+					AtomicScopeLock lock(completeMutex);
+					operation->next = completeHead;
+					completeHead = operation;
+				}
+
+				completeEpoch.fetch_add(1, std::memory_order_seq_cst);
+				completeEpoch.notify_all();
+			}
+		}
+	};
+}
+#endif
+
+
+
+/** Async IO queue. */
+export namespace Furud
+{
+	/**
+	 * @brief    Accepts many reads and submits them in batches, completions are delivered
+	 *           by `Poll()` and `WaitAll()` on the calling thread.
+	 *           Uses IOCP on Windows, io_uring on Linux, and a thread pool otherwise.
+	 * @note     Not thread-safe, a single thread drives a queue.
+	 * @details  异步文件读取队列。
+	 */
+	class AsyncIOQueue
+	{
+	private:
+		std::unique_ptr<Internal::IAsyncIOBackend> backend;
+
+		/** Operations enqueued but not submitted yet. */
+		std::vector<Internal::AsyncOperation*> queued;
+		size_t queuedHead { 0 };
+
+		/** Scratch for reaped operations. */
+		std::vector<Internal::AsyncOperation*> reaped;
+
+		uint32_t queueDepth { 0 };
+		uint32_t numInFlight { 0 };
+
+
+	public:
+		AsyncIOQueue() = default;
+
+		/** Noncopyable. */
+		AsyncIOQueue(const AsyncIOQueue&) = delete;
+
+		/** Noncopyable. */
+		AsyncIOQueue& operator = (const AsyncIOQueue&) = delete;
+
+		~AsyncIOQueue()
+		{
+			Shutdown();
+		}
+
+
+	public:
+		/**
+		 * @brief    Initializes the backend.
+		 * @param    inQueueDepth        -  The maximum number of reads in flight.
+		 * @param    numFallbackThreads  -  The number of threads if the thread pool backend is used.
+		 * @details  初始化异步队列。
+		 */
+		bool Init(uint32_t inQueueDepth = 256, uint32_t numFallbackThreads = 4)
+		{
+			if (backend)
+			{
+				return false;
+			}
+
+			queueDepth = std::max<uint32_t>(inQueueDepth, 1);
+			reaped.resize(std::min<uint32_t>(queueDepth, 64));
+
+#if FURUD_OS_WIN
+			auto iocp = std::make_unique<Internal::IOCPBackend>();
+			if (iocp->Init())
+			{
+				backend = std::move(iocp);
+			}
+#else
+#if FURUD_OS_LINUX
+			auto uring = std::make_unique<Internal::IOUringBackend>();
+			if (uring->Init(queueDepth))
+			{
+				queueDepth = std::min(queueDepth, uring->NumEntries());
+				backend = std::move(uring);
+				return true;
+			}
+#endif
+			auto pool = std::make_unique<Internal::ThreadPoolBackend>();
+			if (pool->Init(numFallbackThreads))
+			{
+				backend = std::move(pool);
+			}
+#endif
+			return backend != nullptr;
+		}
+
+		/**
+		 * @brief    Waits all reads, then releases the backend.
+		 * @details  关闭异步队列。
+		 */
+		void Shutdown()
+		{
+			if (backend)
+			{
+				WaitAll();
+				backend.reset();
+			}
+		}
+
+		/**
+		 * @brief    Opens a file for asynchronous reading.
+		 * @param    filename  -  Null-terminated filename.
+		 * @details  打开文件。
+		 */
+		furud_nodiscard AsyncFileHandle OpenFile(WidecharArrayView filename)
+		{
+			return { backend ? backend->Open(filename) : -1 };
+		}
+
+		/**
+		 * @brief    Closes the file, please make sure there is no read of it in flight.
+		 * @details  关闭文件。
+		 */
+		void CloseFile(AsyncFileHandle& file)
+		{
+			if (backend && file.IsValid())
+			{
+				backend->Close(file.native);
+			}
+			file.native = -1;
+		}
+
+		furud_nodiscard uint32_t NumPending() const noexcept
+		{
+			return numInFlight + uint32_t(queued.size() - queuedHead);
+		}
+
+
+	public:
+		/**
+		 * @brief    Enqueues a read, it is submitted by the next `Submit()`, `Poll()` or `WaitAll()`.
+		 * @note     The destination must be valid until the callback is invoked.
+		 * @details  添加读取请求。
+		 */
+		bool Enqueue(const AsyncReadRequest& request)
+		{
+			if (!backend || !request.file.IsValid() || request.size < 0 || request.offset < 0)
+			{
+				return false;
+			}
+
+			const uint32_t numOperations = uint32_t((request.size + Internal::MaxOperationSize - 1) / Internal::MaxOperationSize);
+			Internal::AsyncPending* pending = new Internal::AsyncPending{ request, 0, std::max<uint32_t>(numOperations, 1), false };
+
+			// An empty read still submits one operation, so its callback is invoked by `Poll()` or `WaitAll()`
+			// like any other request, never inside `Enqueue()`.
+			int64_t offset = 0;
+			do
+			{
+				const int64_t size = std::min(request.size - offset, Internal::MaxOperationSize);
+
+				Internal::AsyncOperation* operation = new Internal::AsyncOperation{};
+				operation->pending     = pending;
+				operation->file        = request.file.native;
+				operation->offset      = request.offset + offset;
+				operation->destination = (uint8_t*)request.destination + offset;
+				operation->size        = uint32_t(size);
+				queued.push_back(operation);
+
+				offset += size;
+			}
+			while (offset < request.size);
+
+			return true;
+		}
+
+		/**
+		 * @brief    Enqueues a read, and gets a future of it.
+		 * @note     The future is fulfilled by `Poll()` or `WaitAll()`, do not block on it before that.
+		 * @details  添加读取请求，返回 future。
+		 */
+		furud_nodiscard std::future<AsyncReadResult> Enqueue(AsyncFileHandle file, int64_t offset, int64_t size, void* destination)
+		{
+			using TPromise = std::promise<AsyncReadResult>;
+
+			TPromise* promise = new TPromise();
+			std::future<AsyncReadResult> future = promise->get_future();
+
+			AsyncReadRequest request;
+			request.file        = file;
+			request.offset      = offset;
+			request.size        = size;
+			request.destination = destination;
+			request.userData    = promise;
+			request.callback    = [](void* userData, const AsyncReadResult& result)
+			{
+				TPromise* target = static_cast<TPromise*>(userData);
+				target->set_value(result);
+				delete target;
+			};
+
+			if (!Enqueue(request))
+			{
+				promise->set_value({});
+				delete promise;
+			}
+
+			return future;
+		}
+
+		/**
+		 * @brief    Submits the enqueued reads in one batch, as many as the queue depth allows.
+		 * @returns  The number of operations submitted.
+		 * @details  批量提交读取请求。
+		 */
+		uint32_t Submit()
+		{
+			const uint32_t numQueued = uint32_t(queued.size() - queuedHead);
+			const uint32_t numAvailable = queueDepth > numInFlight ? queueDepth - numInFlight : 0;
+			const uint32_t num = std::min(numQueued, numAvailable);
+			if (!backend || num == 0)
+			{
+				return 0;
+			}
+
+			const uint32_t numSubmitted = backend->Submit(queued.data() + queuedHead, num);
+			numInFlight += numSubmitted;
+			queuedHead += numSubmitted;
+
+			if (queuedHead == queued.size())
+			{
+				queued.clear();
+				queuedHead = 0;
+			}
+			return numSubmitted;
+		}
+
+		/**
+		 * @brief    Submits, then invokes the callbacks of finished reads without blocking.
+		 * @returns  The number of requests completed.
+		 * @details  处理已完成的读取请求。
+		 */
+		uint32_t Poll()
+		{
+			Submit();
+
+			uint32_t numCompleted = 0;
+			while (numInFlight > 0)
+			{
+				const uint32_t numReaped = backend->Reap(reaped.data(), uint32_t(reaped.size()), false);
+				if (numReaped == 0)
+				{
+					break;
+				}
+				numCompleted += Complete(numReaped);
+				Submit();
+			}
+			return numCompleted;
+		}
+
+		/**
+		 * @brief    Blocks until all enqueued reads are completed.
+		 * @details  等待全部读取请求完成。
+		 */
+		void WaitAll()
+		{
+			while (NumPending() > 0)
+			{
+				Submit();
+				const uint32_t numReaped = backend->Reap(reaped.data(), uint32_t(reaped.size()), true);
+				Complete(numReaped);
+			}
+		}
+
+
+	private:
+		uint32_t Complete(uint32_t numReaped)
+		{
+			uint32_t numCompleted = 0;
+			for (uint32_t index = 0; index < numReaped; ++index)
+			{
+				Internal::AsyncOperation* operation = reaped[index];
+				Internal::AsyncPending* pending = operation->pending;
+
+				if (operation->result < 0)
+				{
+					pending->bFailed = true;
+				}
+				else
+				{
+					pending->bytesRead += operation->result;
+				}
+
+				delete operation;
+				--numInFlight;
+
+				if (--pending->numRemaining == 0)
+				{
+					if (pending->request.callback)
+					{
+						pending->request.callback(pending->request.userData, { pending->bytesRead, !pending->bFailed });
+					}
+					delete pending;
+					++numCompleted;
+				}
+			}
+			return numCompleted;
+		}
+	};
+}
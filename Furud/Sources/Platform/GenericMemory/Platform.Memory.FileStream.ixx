@@ -8,18 +8,36 @@
 //
 module;
 
-#define WIN32_LEAN_AND_MEAN
-#define NOMINMAX
-#include <Windows.h>
 #include <Furud.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <immintrin.h>
+#include <memory>
+#include <span>
 #include <stdint.h>
+#include <string.h>
+#include <string>
 #include <utility>
 
+#if FURUD_OS_WIN
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 
 
 export module Furud.Platform.Memory.FileStream;
 
 export import Furud.Platform.API.CharArray;
+import Furud.Platform.Thread;
 
 
 
@@ -86,10 +104,99 @@ export namespace Furud
 			return value;
 		}
 	};
+
+
+
+	class MappingHint final
+	{
+	private:
+		using TEnum = char;
+		TEnum value;
+
+
+	public:
+		static constexpr TEnum Normal     = TEnum('n');
+		static constexpr TEnum Sequential = TEnum('s');
+		static constexpr TEnum Random     = TEnum('r');
+
+
+	public:
+		constexpr MappingHint(const TEnum& flag) noexcept
+			: value(flag)
+		{}
+
+		constexpr MappingHint& operator = (const TEnum& flag) noexcept
+		{
+			value = flag;
+			return *this;
+		}
+
+		constexpr TEnum ToEnum() const noexcept
+		{
+			return value;
+		}
+	};
+}
+
+
+
+/** Native path. */
+export namespace Furud::Internal
+{
+	/**
+	 * @brief    Converts the wide char filename to the utf-8 filename used by posix.
+	 * @details  转换为 posix 文件名。
+	 */
+	std::string ToNativeFilename(WidecharArrayView filename)
+	{
+		std::string result;
+		result.reserve(filename.Size());
+
+		for (size_t index = 0; index < filename.Size(); ++index)
+		{
+			uint32_t code = (uint32_t)filename[index];
+
+			// Surrogate pair, only if wchar_t is 16-bit.
+			if (code >= 0xd800 && code < 0xdc00 && index + 1 < filename.Size())
+			{
+				const uint32_t low = (uint32_t)filename[index + 1];
+				if (low >= 0xdc00 && low < 0xe000)
+				{
+					code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+					++index;
+				}
+			}
+
+			if (code < 0x80)
+			{
+				result.push_back(char(code));
+			}
+			else if (code < 0x800)
+			{
+				result.push_back(char(0xc0 | (code >> 6)));
+				result.push_back(char(0x80 | (code & 0x3f)));
+			}
+			else if (code < 0x10000)
+			{
+				result.push_back(char(0xe0 | (code >> 12)));
+				result.push_back(char(0x80 | ((code >> 6) & 0x3f)));
+				result.push_back(char(0x80 | (code & 0x3f)));
+			}
+			else
+			{
+				result.push_back(char(0xf0 | (code >> 18)));
+				result.push_back(char(0x80 | ((code >> 12) & 0x3f)));
+				result.push_back(char(0x80 | ((code >> 6) & 0x3f)));
+				result.push_back(char(0x80 | (code & 0x3f)));
+			}
+		}
+		return result;
+	}
 }
 
 
 
+#if FURUD_OS_WIN
 /** Windows file position. */
 namespace Furud::Internal
 {
@@ -138,6 +245,7 @@ namespace Furud::Internal
 		}
 	};
 }
+#endif
 
 
 
@@ -208,11 +316,14 @@ namespace Furud::Internal
 
 	public:
 		virtual bool Write(const void* data, int64_t size) = 0;
+
+		virtual bool Flush() = 0;
 	};
 }
 
 
 
+#if FURUD_OS_WIN
 /** Input file stream. */
 export namespace Furud
 {
@@ -541,6 +652,12 @@ export namespace Furud
 			return true;
 		}
 
+		virtual bool Flush() override
+		{
+			// Every write goes to the system directly, nothing to flush.
+			return handle != INVALID_HANDLE_VALUE;
+		}
+
 
 	private:
 		furud_inline bool WriteFileInternal(uint8_t*& data, DWORD bytesToWrite)
@@ -578,132 +695,1088 @@ export namespace Furud
 		}
 	};
 }
-
-
-
-/** Text stream. */
+#else
+/** Input file stream. */
 export namespace Furud
 {
 	/**
-	 * @brief    Text file input stream implementation.
-	 * @details  文本输入流。
+	 * @brief    Posix file input stream implementation.
+	 * @details  文件输入流。
 	 */
-	class AnsicharStream : private InputFileStream
+	class InputFileStream : public Internal::IInputFileStream
 	{
 	private:
-		AnsicharArray buffer;
+		int handle { -1 };
+		int64_t fileSize { 0 };
+		int64_t filePos { 0 };
 
 
 	public:
-		AnsicharStream()
-			: InputFileStream()
-			, buffer(255)
-		{}
+		constexpr InputFileStream() = default;
 
-		void ResizeBuffer(uint32_t inSize)
+		virtual ~InputFileStream()
 		{
-			buffer = AnsicharArray(inSize);
+			Close();
 		}
 
+
+	public:
 		virtual bool Open(WidecharArrayView filename, InputMode mode = InputMode::ReadOnly) override
 		{
-			bool bFileValid = InputFileStream::Open(filename, mode);
-
-			if (bFileValid)
+			if (handle < 0)
 			{
-				uint8_t bom[3] = { 0 };
-				Read(bom, 3);
+				// Posix has no sharing mode, both modes open the file as read-only.
+				// see https://man7.org/linux/man-pages/man2/open.2.html
+				switch (mode.ToEnum())
+				{
+				case InputMode::ReadOnly:
+				case InputMode::ShareWrite:
+					handle = ::open(Internal::ToNativeFilename(filename).c_str(), O_RDONLY | O_CLOEXEC);
+					break;
 
-				// utf-8 with bom.
-				if (bom[0] == 0xef && bom[1] == 0xbb && bom[2] == 0xbf)
+				default:
+					return false;
+				}
+			}
+
+			if (handle >= 0)
+			{
+				struct stat status;
+				if (::fstat(handle, &status) == 0)
 				{
-					// ignore bom, do nothing.
+					fileSize = (int64_t)status.st_size;
 				}
 				else
 				{
-					Seek(0);
+					// Same as windows, the file handle is invalid if the size is unknown.
+					Close();
 				}
 			}
 
-			return bFileValid;
+			return handle >= 0;
 		}
 
+		virtual bool IsOpen() override
+		{
+			return handle >= 0;
+		}
 
-	public:
-		using InputFileStream::Close;
-		using InputFileStream::IsEOF;
-		using InputFileStream::Read;
-		using InputFileStream::Size;
-		using InputFileStream::Tell;
+		virtual void Close() override
+		{
+			if (handle >= 0)
+			{
+				::close(handle);
+				handle = -1;
+				fileSize = 0;
+				filePos = 0;
+			}
+		}
+
+		virtual int64_t Size() override
+		{
+			return fileSize;
+		}
+
+		virtual int64_t Tell() override
+		{
+			return filePos;
+		}
+
+		virtual bool IsEOF() override
+		{
+			return filePos >= fileSize;
+		}
 
 
 	public:
-		bool GetLine(AnsicharArray& line)
+		virtual void Seek(int64_t position) override
 		{
-			// Reserve at least 32 bytes of memory.
-			const size_t numLeastCapacity = line.Capacity() >= 32 ? 0 : 32;
-			line.Empty(numLeastCapacity);
+			filePos = position;
+		}
 
-			bool success = false;
-			bool finished = false;
-			do
+		virtual bool Read(void* data, int64_t bytes) override
+		{
+			uint8_t* furud_restrict p = (uint8_t*)data;
+			while (bytes > 0)
 			{
-				GetlineInternal(finished);
-
-				// Overflow?
-				if (line.Size() >= AnsicharArray::npos - buffer.Size())
-				{
-					break;
-				}
-				else
+				// see https://man7.org/linux/man-pages/man2/pread.2.html
+				const ssize_t bytesRead = ::pread(handle, p, size_t(bytes), off_t(filePos));
+				if (bytesRead < 0 && errno == EINTR)
 				{
-					line.Append(AnsicharArrayView { buffer });
+					continue;
 				}
 
-				if (finished)
+				// Error or unexpected end of file.
+				if (bytesRead <= 0)
 				{
-					break;
+					return false;
 				}
-			}
-			while (true);
 
+				p += bytesRead;
+				bytes -= bytesRead;
+				filePos += bytesRead;
+			}
 
-			return success;
+			return true;
 		}
+	};
+}
+
 
 
+/** Output file stream. */
+export namespace Furud
+{
+	/**
+	 * @brief    Posix file output stream implementation.
+	 * @details  文件输出流。
+	 */
+	class OutputFileStream : public Internal::IOutputFileStream
+	{
 	private:
-		furud_inline void GetlineInternal(bool& finished)
+		int handle { -1 };
+		int64_t filePos { 0 };
+		int64_t fileSize { 0 };
+
+
+	public:
+		constexpr OutputFileStream() = default;
+
+		virtual ~OutputFileStream()
 		{
-			AnsicharArray::TSize counter = buffer.Capacity() - 1;
+			Close();
+		}
 
-			finished = false;
-			buffer.Clear();
 
-			while (counter--)
+	public:
+		virtual bool Open(WidecharArrayView filename, OutputMode mode = OutputMode::WriteOnly) override
+		{
+			if (handle < 0)
 			{
-				char ch;
+				fileSize = 0;
+				filePos = 0;
 
-				if (!Read(&ch, 1))
+				// Posix has no sharing mode, `WriteOnly` and `ShareRead` are the same.
+				// see https://man7.org/linux/man-pages/man2/open.2.html
+				const std::string nativeFilename = Internal::ToNativeFilename(filename);
+				switch (mode.ToEnum())
 				{
-					// EOF or other error.
-					finished = true;
+				case OutputMode::WriteOnly:
+				case OutputMode::ShareRead:
+					handle = ::open(nativeFilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+					break;
+
+				case OutputMode::Append:
+					handle = ::open(nativeFilename.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+					if (handle >= 0)
+					{
+						struct stat status;
+						if (::fstat(handle, &status) == 0)
+						{
+							fileSize = (int64_t)status.st_size;
+							filePos = fileSize;
+						}
+						else
+						{
+							// Same as windows, the file handle is invalid if the size is unknown.
+							Close();
+							return false;
+						}
+					}
 					break;
+
+				default:
+					return false;
 				}
-				// Ignores carriage return character.
-				else if (ch == 0x0d /* \r */)
+			}
+
+			return handle >= 0;
+		}
+
+		virtual bool IsOpen() override
+		{
+			return handle >= 0;
+		}
+
+		virtual void Close() override
+		{
+			if (handle >= 0)
+			{
+				::close(handle);
+				handle = -1;
+				fileSize = 0;
+			}
+		}
+
+
+	public:
+		virtual bool Write(const void* data, int64_t bytes) override
+		{
+			const uint8_t* furud_restrict p = (const uint8_t*)data;
+			while (bytes > 0)
+			{
+				// see https://man7.org/linux/man-pages/man2/pwrite.2.html
+				const ssize_t bytesWritten = ::pwrite(handle, p, size_t(bytes), off_t(filePos));
+				if (bytesWritten < 0 && errno == EINTR)
 				{
 					continue;
 				}
-				// Meets line feed.
-				else if (ch == 0x0a /* \n */)
+
+				if (bytesWritten <= 0)
 				{
-					finished = true;
-					break;
+					return false;
 				}
 
-				buffer.PushUnsafe(ch);
+				p += bytesWritten;
+				bytes -= bytesWritten;
+				filePos += bytesWritten;
+				fileSize = std::max(fileSize, filePos);
+			}
+
+			return true;
+		}
+
+		virtual bool Flush() override
+		{
+			// Every write goes to the system directly, nothing to flush.
+			return handle >= 0;
+		}
+	};
+}
+#endif
+
+
+
+/** Buffered output file stream. */
+export namespace Furud
+{
+	/**
+	 * @brief    Output file stream which coalesces small writes in memory.
+	 *           With the background flusher, the buffer is doubled: the producer fills the front buffer
+	 *           while the flusher thread writes the back one, the producer blocks only if both are full.
+	 * @details  带缓冲的文件输出流。
+	 */
+	class BufferedOutputFileStream : public OutputFileStream
+	{
+	private:
+		/** Writes the back buffer on its own thread. */
+		class Flusher : public Thread
+		{
+		public:
+			BufferedOutputFileStream* owner = nullptr;
+
+		protected:
+			virtual void Run() override
+			{
+				owner->FlusherLoop();
+			}
+		};
+
+
+		/** Default size of each buffer. */
+		static constexpr size_t DefaultBufferSize = 64 * 1024;
+
+		std::unique_ptr<uint8_t[]> frontBuffer;
+		std::unique_ptr<uint8_t[]> backBuffer;
+		size_t bufferSize;
+		size_t frontSize { 0 };
+
+		/** Tells the flusher to exit, stored in place of the back buffer size. */
+		static constexpr size_t QuitSignal = SIZE_MAX;
+
+		/** The bytes of the back buffer waiting for write, 0 if the flusher is idle. */
+		alignas(64) std::atomic<size_t> backSize { 0 };
+
+		std::unique_ptr<Flusher> flusher;
+		std::atomic<bool> bFailed { false };
+		bool bBackground;
+
+
+	public:
+		/**
+		 * @param    inBufferSize   -  Size of each buffer.
+		 * @param    inBackground  -  Whether to write the file on a background thread.
+		 */
+		explicit BufferedOutputFileStream(size_t inBufferSize = DefaultBufferSize, bool inBackground = false)
+			: OutputFileStream()
+			, frontBuffer(new uint8_t[std::max<size_t>(inBufferSize, 1)])
+			, backBuffer(inBackground ? new uint8_t[std::max<size_t>(inBufferSize, 1)] : nullptr)
+			, bufferSize(std::max<size_t>(inBufferSize, 1))
+			, bBackground(inBackground)
+		{}
+
+		virtual ~BufferedOutputFileStream()
+		{
+			Close();
+		}
+
+
+	public:
+		virtual bool Open(WidecharArrayView filename, OutputMode mode = OutputMode::WriteOnly) override
+		{
+			if (IsOpen() || !OutputFileStream::Open(filename, mode))
+			{
+				return false;
+			}
+
+			frontSize = 0;
+			backSize.store(0, std::memory_order_relaxed);
+			bFailed.store(false, std::memory_order_relaxed);
+
+			if (bBackground)
+			{
+				flusher = std::make_unique<Flusher>();
+				flusher->owner = this;
+				if (!flusher->Init({ "Furud FileFlusher", Thread::Priority::Normal, Thread::InitFlag::CreateRunnable }))
+				{
+					// Falls back to flush on the producer thread.
+					flusher.reset();
+				}
+			}
+
+			return true;
+		}
+
+		/**
+		 * @brief    Flushes the buffered data, then closes the file.
+		 * @details  写入缓冲数据并关闭文件。
+		 */
+		virtual void Close() override
+		{
+			if (!IsOpen())
+			{
+				return;
+			}
+
+			Flush();
+
+			if (flusher)
+			{
+				backSize.store(QuitSignal, std::memory_order_release);
+				backSize.notify_all();
+				flusher->Kill(true);
+				flusher.reset();
+			}
+
+			OutputFileStream::Close();
+		}
+
+
+	public:
+		/**
+		 * @brief    Appends data to the buffer, the full buffer is handed over to the flusher.
+		 * @returns  False if any previous write failed.
+		 * @details  写入数据。
+		 */
+		virtual bool Write(const void* data, int64_t bytes) override
+		{
+			const uint8_t* p = (const uint8_t*)data;
+			while (bytes > 0)
+			{
+				const size_t count = std::min<size_t>(size_t(bytes), bufferSize - frontSize);
+				::memcpy(frontBuffer.get() + frontSize, p, count);
+				frontSize += count;
+				p += count;
+				bytes -= int64_t(count);
+
+				if (frontSize == bufferSize && !Submit())
+				{
+					return false;
+				}
+			}
+
+			return !bFailed.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * @brief    Writes all buffered data to the system, blocks until done.
+		 * @returns  False if any write failed.
+		 * @details  写入全部缓冲数据。
+		 */
+		virtual bool Flush() override
+		{
+			if (!IsOpen())
+			{
+				return false;
+			}
+
+			if (frontSize > 0)
+			{
+				Submit();
+			}
+
+			WaitForFlusher();
+			return !bFailed.load(std::memory_order_acquire);
+		}
+
+
+	private:
+		/**
+		 * @brief    Hands the front buffer over, or writes it directly without flusher.
+		 * @details  提交前台缓冲。
+		 */
+		bool Submit()
+		{
+			if (!flusher)
+			{
+				if (!OutputFileStream::Write(frontBuffer.get(), int64_t(frontSize)))
+				{
+					bFailed.store(true, std::memory_order_release);
+				}
+				frontSize = 0;
+				return !bFailed.load(std::memory_order_acquire);
+			}
+
+			// Both buffers are full, the only case the producer blocks.
+			WaitForFlusher();
+
+			std::swap(frontBuffer, backBuffer);
+			backSize.store(frontSize, std::memory_order_release);
+			backSize.notify_one();
+			frontSize = 0;
+			return !bFailed.load(std::memory_order_acquire);
+		}
+
+		void WaitForFlusher()
+		{
+			if (!flusher)
+			{
+				return;
+			}
+
+			size_t pending = backSize.load(std::memory_order_acquire);
+			while (pending != 0)
+			{
+				backSize.wait(pending, std::memory_order_acquire);
+				pending = backSize.load(std::memory_order_acquire);
+			}
+		}
+
+		void FlusherLoop()
+		{
+			while (true)
+			{
+				backSize.wait(0, std::memory_order_acquire);
+
+				const size_t pending = backSize.load(std::memory_order_acquire);
+				if (pending == QuitSignal)
+				{
+					break;
+				}
+
+				if (!OutputFileStream::Write(backBuffer.get(), int64_t(pending)))
+				{
+					bFailed.store(true, std::memory_order_release);
+				}
+
+				backSize.store(0, std::memory_order_release);
+				backSize.notify_all();
+			}
+		}
+	};
+}
+
+
+
+/** Memory mapped file. */
+export namespace Furud
+{
+	/**
+	 * @brief    A read-only view of a mapped file, it does not own the mapping.
+	 * @details  内存映射文件视图。
+	 */
+	class MappedFileView
+	{
+	private:
+		const uint8_t* data { nullptr };
+		int64_t size { 0 };
+
+
+	public:
+		constexpr MappedFileView() = default;
+
+		constexpr MappedFileView(const uint8_t* inData, int64_t inSize) noexcept
+			: data(inData)
+			, size(inSize)
+		{}
+
+
+	public:
+		furud_nodiscard constexpr const uint8_t* Data() const noexcept
+		{
+			return data;
+		}
+
+		furud_nodiscard constexpr int64_t Size() const noexcept
+		{
+			return size;
+		}
+
+		furud_nodiscard constexpr bool IsEmpty() const noexcept
+		{
+			return size == 0;
+		}
+
+		furud_nodiscard constexpr std::span<const uint8_t> Span() const noexcept
+		{
+			return { data, size_t(size) };
+		}
+
+		/**
+		 * @brief    Reinterprets the view as an array of `T`, the trailing bytes are ignored.
+		 * @note     Please make sure the data is aligned for `T`.
+		 * @details  将视图解释为 `T` 数组。
+		 */
+		template <typename T> requires std::is_trivially_copyable_v<T>
+		furud_nodiscard std::span<const T> AsSpan() const noexcept
+		{
+			return { reinterpret_cast<const T*>(data), size_t(size) / sizeof(T) };
+		}
+
+		/**
+		 * @brief    Gets a sub view, clamped to this view.
+		 * @details  获取子视图。
+		 */
+		furud_nodiscard constexpr MappedFileView SubView(int64_t offset, int64_t bytes = INT64_MAX) const noexcept
+		{
+			offset = std::clamp<int64_t>(offset, 0, size);
+			return { data + offset, std::min(bytes, size - offset) };
+		}
+
+
+	public:
+		/**
+		 * @brief    Tells the kernel how this view is going to be accessed.
+		 * @details  设置访问模式提示。
+		 */
+		void Advise(MappingHint hint) const noexcept
+		{
+#if FURUD_OS_WIN
+			// Windows only supports prefetch on mapped memory, sequential access benefits most.
+			if (hint.ToEnum() == MappingHint::Sequential)
+			{
+				Prefault();
+			}
+#else
+			int advice = MADV_NORMAL;
+			switch (hint.ToEnum())
+			{
+			case MappingHint::Sequential: advice = MADV_SEQUENTIAL; break;
+			case MappingHint::Random:     advice = MADV_RANDOM;     break;
+			default: break;
+			}
+			AdviseInternal(advice);
+#endif
+		}
+
+		/**
+		 * @brief    Asks the kernel to read the pages of this view ahead, it does not block.
+		 * @details  预读页面。
+		 */
+		void Prefault() const noexcept
+		{
+			if (size <= 0)
+			{
+				return;
+			}
+#if FURUD_OS_WIN
+			// see https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-prefetchvirtualmemory
+			WIN32_MEMORY_RANGE_ENTRY range{ (void*)data, size_t(size) };
+			::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+#else
+			AdviseInternal(MADV_WILLNEED);
+#endif
+		}
+
+
+	private:
+#if !FURUD_OS_WIN
+		void AdviseInternal(int advice) const noexcept
+		{
+			if (size <= 0)
+			{
+				return;
+			}
+
+			// madvise requires page aligned address.
+			// see https://man7.org/linux/man-pages/man2/madvise.2.html
+			const uintptr_t pageSize = (uintptr_t)::sysconf(_SC_PAGESIZE);
+			const uintptr_t first = (uintptr_t)data & ~(pageSize - 1);
+			const uintptr_t last = (uintptr_t)data + (uintptr_t)size;
+			::madvise((void*)first, last - first, advice);
+		}
+#endif
+	};
+
+
+
+	/**
+	 * @brief    Maps a whole file into memory as read-only.
+	 * @details  只读内存映射文件。
+	 */
+	class MappedFileStream
+	{
+	private:
+#if FURUD_OS_WIN
+		HANDLE handle { INVALID_HANDLE_VALUE };
+		HANDLE mapping { nullptr };
+#else
+		int handle { -1 };
+#endif
+		const uint8_t* address { nullptr };
+		int64_t fileSize { 0 };
+
+
+	public:
+		constexpr MappedFileStream() = default;
+
+		/** Noncopyable. */
+		MappedFileStream(const MappedFileStream&) = delete;
+
+		/** Noncopyable. */
+		MappedFileStream& operator = (const MappedFileStream&) = delete;
+
+		~MappedFileStream()
+		{
+			Close();
+		}
+
+
+	public:
+		/**
+		 * @brief    Opens and maps the file.
+		 * @param    filename   -  Null-terminated filename.
+		 * @param    hint       -  Access pattern of the whole file.
+		 * @param    bPrefault  -  Whether to read the file ahead.
+		 * @returns  False if the file can not be opened or mapped.
+		 * @details  打开并映射文件。
+		 */
+		bool Open(WidecharArrayView filename, MappingHint hint = MappingHint::Normal, bool bPrefault = false)
+		{
+			if (IsOpen())
+			{
+				return false;
+			}
+
+#if FURUD_OS_WIN
+			DWORD flags = FILE_ATTRIBUTE_NORMAL;
+			switch (hint.ToEnum())
+			{
+			case MappingHint::Sequential: flags |= FILE_FLAG_SEQUENTIAL_SCAN; break;
+			case MappingHint::Random:     flags |= FILE_FLAG_RANDOM_ACCESS;   break;
+			default: break;
+			}
+
+			// Open a file.
+			// see https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+			handle = ::CreateFileW(filename.Data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+			if (handle == INVALID_HANDLE_VALUE)
+			{
+				return false;
+			}
+
+			LARGE_INTEGER li;
+			if (!::GetFileSizeEx(handle, &li))
+			{
+				Close();
+				return false;
+			}
+			fileSize = li.QuadPart;
+
+			// An empty file can not be mapped, but it is still a valid file.
+			if (fileSize > 0)
+			{
+				// see https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-createfilemappingw
+				mapping = ::CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (mapping)
+				{
+					// see https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffile
+					address = (const uint8_t*)::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+				}
+
+				if (!address)
+				{
+					Close();
+					return false;
+				}
+			}
+#else
+			const std::string nativeFilename = Internal::ToNativeFilename(filename);
+			handle = ::open(nativeFilename.c_str(), O_RDONLY | O_CLOEXEC);
+			if (handle < 0)
+			{
+				return false;
+			}
+
+			struct stat status;
+			if (::fstat(handle, &status) != 0)
+			{
+				Close();
+				return false;
+			}
+			fileSize = (int64_t)status.st_size;
+
+			// An empty file can not be mapped, but it is still a valid file.
+			if (fileSize > 0)
+			{
+				int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+				flags |= bPrefault ? MAP_POPULATE : 0;
+#endif
+				// see https://man7.org/linux/man-pages/man2/mmap.2.html
+				void* result = ::mmap(nullptr, size_t(fileSize), PROT_READ, flags, handle, 0);
+				if (result == MAP_FAILED)
+				{
+					Close();
+					return false;
+				}
+				address = (const uint8_t*)result;
+			}
+#endif
+
+			MappedFileView view = View();
+			view.Advise(hint);
+			if (bPrefault)
+			{
+				view.Prefault();
+			}
+
+			return true;
+		}
+
+		bool IsOpen() const noexcept
+		{
+#if FURUD_OS_WIN
+			return handle != INVALID_HANDLE_VALUE;
+#else
+			return handle >= 0;
+#endif
+		}
+
+		void Close() noexcept
+		{
+#if FURUD_OS_WIN
+			if (address)
+			{
+				::UnmapViewOfFile(address);
+			}
+			if (mapping)
+			{
+				::CloseHandle(mapping);
+				mapping = nullptr;
+			}
+			if (handle != INVALID_HANDLE_VALUE)
+			{
+				::CloseHandle(handle);
+				handle = INVALID_HANDLE_VALUE;
+			}
+#else
+			if (address)
+			{
+				::munmap((void*)address, size_t(fileSize));
+			}
+			if (handle >= 0)
+			{
+				::close(handle);
+				handle = -1;
+			}
+#endif
+			address = nullptr;
+			fileSize = 0;
+		}
+
+		furud_nodiscard int64_t Size() const noexcept
+		{
+			return fileSize;
+		}
+
+
+	public:
+		/**
+		 * @brief    Views the whole mapped file.
+		 * @details  获取整个文件的视图。
+		 */
+		furud_nodiscard MappedFileView View() const noexcept
+		{
+			return { address, fileSize };
+		}
+
+		/**
+		 * @brief    Views a part of the mapped file, clamped to the file.
+		 * @details  获取部分文件的视图。
+		 */
+		furud_nodiscard MappedFileView View(int64_t offset, int64_t bytes) const noexcept
+		{
+			return View().SubView(offset, bytes);
+		}
+
+		furud_nodiscard std::span<const uint8_t> Span() const noexcept
+		{
+			return View().Span();
+		}
+	};
+}
+
+
+
+/** Line break scanner. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Finds the first `\n` or `\r` in [first, last), 32/16 bytes per compare.
+	 * @returns  `last` if not found.
+	 * @details  查找换行符。
+	 */
+	furud_inline const char* FindLineBreak(const char* first, const char* last) noexcept
+	{
+#if defined(__AVX2__)
+		const __m256i lf32 = _mm256_set1_epi8('\n');
+		const __m256i cr32 = _mm256_set1_epi8('\r');
+		for (; last - first >= 32; first += 32)
+		{
+			const __m256i chunk = _mm256_loadu_si256((const __m256i*)first);
+			const uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, lf32), _mm256_cmpeq_epi8(chunk, cr32)));
+			if (mask)
+			{
+				return first + std::countr_zero(mask);
+			}
+		}
+#endif
+
+		const __m128i lf16 = _mm_set1_epi8('\n');
+		const __m128i cr16 = _mm_set1_epi8('\r');
+		for (; last - first >= 16; first += 16)
+		{
+			const __m128i chunk = _mm_loadu_si128((const __m128i*)first);
+			const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, lf16), _mm_cmpeq_epi8(chunk, cr16)));
+			if (mask)
+			{
+				return first + std::countr_zero(mask);
+			}
+		}
+
+		for (; first < last; ++first)
+		{
+			if (*first == '\n' || *first == '\r')
+			{
+				return first;
+			}
+		}
+		return last;
+	}
+}
+
+
+
+/** Text stream. */
+export namespace Furud
+{
+	/**
+	 * @brief    Text file input stream implementation.
+	 *           The file is read block by block, lines are scanned within the block buffer.
+	 * @details  文本输入流。
+	 */
+	class AnsicharStream : private InputFileStream
+	{
+	private:
+		/** Default size of the block buffer. */
+		static constexpr size_t DefaultBufferSize = 64 * 1024;
+
+		std::unique_ptr<char[]> buffer;
+		size_t capacity;
+
+		/** The unread data is [head, tail) of the buffer. */
+		size_t head;
+		size_t tail;
+
+
+	public:
+		AnsicharStream()
+			: InputFileStream()
+			, buffer(new char[DefaultBufferSize])
+			, capacity(DefaultBufferSize)
+			, head(0)
+			, tail(0)
+		{}
+
+		/**
+		 * @brief    Resizes the block buffer, the buffered data is kept.
+		 * @note     The buffer still grows if a line is longer than it.
+		 * @details  设置缓冲区大小。
+		 */
+		void ResizeBuffer(uint32_t inSize)
+		{
+			const size_t newCapacity = std::max<size_t>(std::max<size_t>(inSize, 16), tail - head);
+			std::unique_ptr<char[]> newBuffer(new char[newCapacity]);
+			::memcpy(newBuffer.get(), buffer.get() + head, tail - head);
+			buffer = std::move(newBuffer);
+			capacity = newCapacity;
+			tail -= head;
+			head = 0;
+		}
+
+		virtual bool Open(WidecharArrayView filename, InputMode mode = InputMode::ReadOnly) override
+		{
+			bool bFileValid = InputFileStream::Open(filename, mode);
+			head = tail = 0;
+
+			if (bFileValid)
+			{
+				Refill();
+
+				// utf-8 with bom.
+				if (tail >= 3 && uint8_t(buffer[0]) == 0xef && uint8_t(buffer[1]) == 0xbb && uint8_t(buffer[2]) == 0xbf)
+				{
+					// ignore bom.
+					head = 3;
+				}
+			}
+
+			return bFileValid;
+		}
+
+
+	public:
+		using InputFileStream::Size;
+
+		virtual void Close() override
+		{
+			InputFileStream::Close();
+			head = tail = 0;
+		}
+
+		virtual int64_t Tell() override
+		{
+			return InputFileStream::Tell() - int64_t(tail - head);
+		}
+
+		virtual bool IsEOF() override
+		{
+			return head == tail && InputFileStream::IsEOF();
+		}
+
+		virtual bool Read(void* data, int64_t bytes) override
+		{
+			// Consumes the buffered data first.
+			const int64_t buffered = std::min<int64_t>(bytes, int64_t(tail - head));
+			::memcpy(data, buffer.get() + head, size_t(buffered));
+			head += size_t(buffered);
+
+			const int64_t remainder = bytes - buffered;
+			return remainder == 0 || InputFileStream::Read((uint8_t*)data + buffered, remainder);
+		}
+
+
+	public:
+		/**
+		 * @brief    Gets next line without copy, `\n`, `\r\n` and `\r` are all treated as line break.
+		 * @param    line  -  Views the line in the block buffer, without line break.
+		 *                    It is valid until the next call to any function of this stream.
+		 * @returns  False if there is no more line.
+		 * @details  读取一行（零拷贝）。
+		 */
+		bool GetLine(AnsicharArrayView& line)
+		{
+			size_t scanned = 0;
+			while (true)
+			{
+				const char* first = buffer.get() + head;
+				const char* last = buffer.get() + tail;
+				const char* found = Internal::FindLineBreak(first + scanned, last);
+
+				if (found != last)
+				{
+					// A trailing `\r` may be the first half of `\r\n`, looks ahead.
+					if (*found == '\r' && found + 1 == last)
+					{
+						scanned = size_t(found - first);
+						if (Refill())
+						{
+							continue;
+						}
+						first = buffer.get() + head;
+						found = first + scanned;
+					}
+
+					line = AnsicharArrayView(first, found);
+					head += size_t(found - first) + 1;
+					if (*found == '\r' && head < tail && buffer[head] == '\n')
+					{
+						++head;
+					}
+					return true;
+				}
+
+				scanned = size_t(last - first);
+				if (Refill())
+				{
+					continue;
+				}
+
+				// The last line without line break.
+				if (head == tail)
+				{
+					return false;
+				}
+
+				line = AnsicharArrayView(buffer.get() + head, buffer.get() + tail);
+				head = tail;
+				return true;
+			}
+		}
+
+
+		/**
+		 * @brief    Gets next line, `\n`, `\r\n` and `\r` are all treated as line break.
+		 * @param    line  -  Receives the line without line break.
+		 * @returns  False if there is no more line.
+		 * @details  读取一行。
+		 */
+		bool GetLine(AnsicharArray& line)
+		{
+			// Reserve at least 32 bytes of memory.
+			const size_t numLeastCapacity = line.Capacity() >= 32 ? 0 : 32;
+			line.Empty(numLeastCapacity);
+
+			AnsicharArrayView view;
+			if (!GetLine(view))
+			{
+				return false;
+			}
+
+			line.Append(view);
+			return true;
+		}
+
+
+	private:
+		/**
+		 * @brief    Moves the unread data to the front, then fills the rest of buffer from file.
+		 *           The buffer is doubled if it is full of unread data.
+		 * @returns  False if nothing is read, the file reaches the end or fails.
+		 * @details  填充缓冲区。
+		 */
+		bool Refill()
+		{
+			if (head > 0)
+			{
+				::memmove(buffer.get(), buffer.get() + head, tail - head);
+				tail -= head;
+				head = 0;
+			}
+
+			if (tail == capacity)
+			{
+				ResizeBuffer(uint32_t(std::min<size_t>(capacity * 2, UINT32_MAX)));
+			}
+
+			const int64_t bytes = std::min<int64_t>(int64_t(capacity - tail), InputFileStream::Size() - InputFileStream::Tell());
+			if (bytes > 0 && InputFileStream::Read(buffer.get() + tail, bytes))
+			{
+				tail += size_t(bytes);
+				return true;
 			}
+			return false;
 		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,510 @@
+//
+// Platform.Memory.FrameArena.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Frame-scoped linear allocator.
+//
+module;
+
+#include <Furud.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+
+export module Furud.Platform.Memory.FrameArena;
+
+import Furud.Platform.Thread.SpinLock;
+
+namespace Furud::Internal
+{
+	/** The maximum number of frames in flight. */
+	constexpr uint32_t MaxBufferedFrames = 4;
+
+	/** Alignment of chunks, also the maximum alignment served by the arena without padding. */
+	constexpr size_t FrameChunkAlignment = 64;
+
+
+
+	/**
+	 * @brief    A block of memory, the header is followed by the payload.
+	 * @details  帧分配器内存块。
+	 */
+	struct alignas(FrameChunkAlignment) FrameArenaChunk
+	{
+		FrameArenaChunk* next;
+		size_t capacity;
+		size_t offset;
+
+		furud_inline uint8_t* Data() noexcept
+		{
+			return reinterpret_cast<uint8_t*>(this + 1);
+		}
+
+		furud_inline static FrameArenaChunk* Create(size_t capacity)
+		{
+			void* memory = ::operator new(sizeof(FrameArenaChunk) + capacity, std::align_val_t(FrameChunkAlignment));
+			return ::new (memory) FrameArenaChunk{ nullptr, capacity, 0 };
+		}
+
+		furud_inline static void Destroy(FrameArenaChunk* chunk) noexcept
+		{
+			::operator delete(chunk, std::align_val_t(FrameChunkAlignment));
+		}
+	};
+
+
+
+	/**
+	 * @brief    The chunks owned by a thread, one chunk list for each buffered frame.
+	 *           Only the owner thread touches the lists, so the allocation is lock free.
+	 * @details  线程局部帧分配器。
+	 */
+	struct ThreadFrameArena
+	{
+		FrameArenaChunk* chunks[MaxBufferedFrames] {};
+		uint64_t frames[MaxBufferedFrames] {};
+		ThreadFrameArena* next { nullptr };
+		std::atomic<bool> bOwned { false };
+	};
+
+
+
+	/**
+	 * @brief    The arena cached by current thread, released on thread exit so that it can be adopted by another thread.
+	 * @details  当前线程的帧分配器。
+	 */
+	struct LocalFrameArena
+	{
+		const void* owner = nullptr;
+		const std::atomic<uint64_t>* ownerGeneration = nullptr;
+		ThreadFrameArena* arena = nullptr;
+		uint64_t generation = 0;
+
+		~LocalFrameArena()
+		{
+			// The arena has been freed if the owner has shut down since.
+			if (arena && ownerGeneration->load(std::memory_order_acquire) == generation)
+			{
+				arena->bOwned.store(false, std::memory_order_release);
+			}
+		}
+	};
+
+
+	thread_local LocalFrameArena localFrameArena;
+
+
+
+	/**
+	 * @brief    Shared state of the frame arena.
+	 *           The chunks of a buffered slot are recycled lazily by their owner thread when the slot is reused,
+	 *           so `BeginFrame` is only an atomic increment and never races with the allocations.
+	 * @details  帧分配器。
+	 */
+	class FrameArenaContext
+	{
+	private:
+		alignas(64) std::atomic<uint64_t> frameNumber { 0 };
+
+		uint32_t numBufferedFrames = 3;
+		size_t chunkSize = 256 * 1024;
+
+		/** Increased on shutdown, invalidates the cached local arenas. */
+		std::atomic<uint64_t> generation { 1 };
+
+		AtomicSpinLock mutex;
+		ThreadFrameArena* arenas = nullptr;
+		FrameArenaChunk* freeChunks = nullptr;
+
+
+	public:
+		FrameArenaContext() = default;
+		FrameArenaContext(const FrameArenaContext&) = delete;
+		FrameArenaContext& operator = (const FrameArenaContext&) = delete;
+
+		~FrameArenaContext()
+		{
+			Shutdown();
+		}
+
+
+	public:
+		bool Init(size_t inChunkSize, uint32_t inNumBufferedFrames)
+		{
+			AtomicScopeLock lock(mutex);
+			if (arenas)
+			{
+				return false;
+			}
+
+			chunkSize = std::max<size_t>(inChunkSize, 4096);
+			numBufferedFrames = std::clamp<uint32_t>(inNumBufferedFrames, 1, MaxBufferedFrames);
+			return true;
+		}
+
+
+		/**
+		 * @brief    Frees all memory, no allocation must be alive or in progress.
+		 */
+		void Shutdown()
+		{
+			AtomicScopeLock lock(mutex);
+			generation.fetch_add(1, std::memory_order_acq_rel);
+
+			while (ThreadFrameArena* arena = arenas)
+			{
+				arenas = arena->next;
+				for (uint32_t slot = 0; slot < MaxBufferedFrames; ++slot)
+				{
+					FreeChunks(arena->chunks[slot]);
+				}
+				delete arena;
+			}
+
+			FreeChunks(freeChunks);
+			freeChunks = nullptr;
+		}
+
+
+		furud_inline void BeginFrame() noexcept
+		{
+			frameNumber.fetch_add(1, std::memory_order_release);
+		}
+
+
+		furud_inline uint64_t GetFrameNumber() const noexcept
+		{
+			return frameNumber.load(std::memory_order_acquire);
+		}
+
+
+		furud_inline uint32_t NumBufferedFrames() const noexcept
+		{
+			return numBufferedFrames;
+		}
+
+
+		furud_inline void* Allocate(size_t bytes, size_t alignment)
+		{
+			ThreadFrameArena* arena = GetLocalArena();
+
+			const uint64_t frame = frameNumber.load(std::memory_order_acquire);
+			const uint32_t slot = uint32_t(frame % numBufferedFrames);
+			if (arena->frames[slot] != frame) furud_unlikely
+			{
+				// The slot holds the data of `numBufferedFrames` frames ago, which is retired now.
+				Recycle(arena->chunks[slot]);
+				arena->chunks[slot] = nullptr;
+				arena->frames[slot] = frame;
+			}
+
+			if (FrameArenaChunk* chunk = arena->chunks[slot]) furud_likely
+			{
+				const uintptr_t base = uintptr_t(chunk->Data());
+				const size_t offset = ((base + chunk->offset + alignment - 1) & ~uintptr_t(alignment - 1)) - base;
+				if (offset + bytes <= chunk->capacity)
+				{
+					chunk->offset = offset + bytes;
+					return chunk->Data() + offset;
+				}
+			}
+
+			return AllocateSlow(arena->chunks[slot], bytes, alignment);
+		}
+
+
+	private:
+		void* AllocateSlow(FrameArenaChunk*& head, size_t bytes, size_t alignment)
+		{
+			// The payload is aligned to the chunk alignment, larger alignments need the padding.
+			const size_t padding = alignment > FrameChunkAlignment ? alignment - FrameChunkAlignment : 0;
+			FrameArenaChunk* chunk = AcquireChunk(bytes + padding);
+			chunk->next = head;
+			head = chunk;
+
+			const uintptr_t base = uintptr_t(chunk->Data());
+			const size_t offset = ((base + alignment - 1) & ~uintptr_t(alignment - 1)) - base;
+			chunk->offset = offset + bytes;
+			return chunk->Data() + offset;
+		}
+
+
+		ThreadFrameArena* GetLocalArena()
+		{
+			const uint64_t currentGeneration = generation.load(std::memory_order_acquire);
+			if (localFrameArena.owner == this && localFrameArena.generation == currentGeneration) furud_likely
+			{
+				return localFrameArena.arena;
+			}
+
+			AtomicScopeLock lock(mutex);
+
+			// Adopts the arena of an exited thread first, its chunks are recycled as usual.
+			ThreadFrameArena* arena = arenas;
+			while (arena && arena->bOwned.exchange(true, std::memory_order_acquire))
+			{
+				arena = arena->next;
+			}
+
+			if (!arena)
+			{
+				arena = new ThreadFrameArena;
+				arena->bOwned.store(true, std::memory_order_relaxed);
+				arena->next = arenas;
+				arenas = arena;
+			}
+
+			localFrameArena.owner = this;
+			localFrameArena.ownerGeneration = &generation;
+			localFrameArena.arena = arena;
+			localFrameArena.generation = currentGeneration;
+			return arena;
+		}
+
+
+		FrameArenaChunk* AcquireChunk(size_t bytes)
+		{
+			if (bytes > chunkSize)
+			{
+				// Oversized chunk, freed on recycle.
+				return FrameArenaChunk::Create(bytes);
+			}
+
+			{
+				AtomicScopeLock lock(mutex);
+				if (FrameArenaChunk* chunk = freeChunks)
+				{
+					freeChunks = chunk->next;
+					chunk->offset = 0;
+					return chunk;
+				}
+			}
+
+			return FrameArenaChunk::Create(chunkSize);
+		}
+
+
+		void Recycle(FrameArenaChunk* chunks)
+		{
+			if (!chunks)
+			{
+				return;
+			}
+
+			FrameArenaChunk* reuse = nullptr;
+			while (FrameArenaChunk* chunk = chunks)
+			{
+				chunks = chunk->next;
+				if (chunk->capacity == chunkSize)
+				{
+					chunk->next = reuse;
+					reuse = chunk;
+				}
+				else
+				{
+					FrameArenaChunk::Destroy(chunk);
+				}
+			}
+
+			if (reuse)
+			{
+				FrameArenaChunk* tail = reuse;
+				while (tail->next)
+				{
+					tail = tail->next;
+				}
+
+				AtomicScopeLock lock(mutex);
+				tail->next = freeChunks;
+				freeChunks = reuse;
+			}
+		}
+
+
+		furud_inline static void FreeChunks(FrameArenaChunk* chunks) noexcept
+		{
+			while (FrameArenaChunk* chunk = chunks)
+			{
+				chunks = chunk->next;
+				FrameArenaChunk::Destroy(chunk);
+			}
+		}
+	};
+
+
+
+	/** The global frame arena. */
+	FrameArenaContext globalFrameArena;
+}
+
+
+
+export namespace Furud
+{
+	/**
+	 * @brief    Frame-scoped linear allocator.
+	 *           The memory allocated in a frame lives for `NumBufferedFrames` frames, so that it can be read
+	 *           until the GPU fence of that frame retires. There is no free, all memory of a frame is reclaimed at once.
+	 * @note     Destructors are never called, only trivially destructible data or containers with `TFrameAllocator`.
+	 * @details  帧分配器。
+	 */
+	namespace IFrameArena
+	{
+		/**
+		 * @brief    Configures the arena, must be called before the first allocation.
+		 * @param    chunkSize          -  Size of each chunk, larger allocations get a dedicated chunk.
+		 * @param    numBufferedFrames  -  The number of frames in flight, `2` for double buffer and `3` for triple buffer.
+		 * @returns  False if the arena is in use.
+		 * @details  初始化帧分配器。
+		 */
+		bool Init(size_t chunkSize = 256 * 1024, uint32_t numBufferedFrames = 3)
+		{
+			return Internal::globalFrameArena.Init(chunkSize, numBufferedFrames);
+		}
+
+
+		/**
+		 * @brief    Frees all memory, no frame allocation must be alive.
+		 * @details  释放帧分配器。
+		 */
+		void Shutdown()
+		{
+			Internal::globalFrameArena.Shutdown();
+		}
+
+
+		/**
+		 * @brief    Starts a new frame, the memory of `NumBufferedFrames` frames ago is reclaimed.
+		 * @note     Call it after the GPU fence of that frame has been waited, along with `FrameTimer::BeginFrame`.
+		 * @details  开始新的一帧。
+		 */
+		furud_inline void BeginFrame() noexcept
+		{
+			Internal::globalFrameArena.BeginFrame();
+		}
+
+
+		/**
+		 * @brief    Gets the number of the current frame.
+		 * @details  获取当前帧序号。
+		 */
+		furud_nodiscard furud_inline uint64_t GetFrameNumber() noexcept
+		{
+			return Internal::globalFrameArena.GetFrameNumber();
+		}
+
+
+		/**
+		 * @brief    Gets the number of frames in flight.
+		 * @details  获取缓冲帧数量。
+		 */
+		furud_nodiscard furud_inline uint32_t NumBufferedFrames() noexcept
+		{
+			return Internal::globalFrameArena.NumBufferedFrames();
+		}
+
+
+		/**
+		 * @brief    Allocates memory for current frame.
+		 * @param    bytes      -  Size in bytes.
+		 * @param    alignment  -  Must be a power of two.
+		 * @details  分配当前帧内存。
+		 */
+		furud_nodiscard furud_inline void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+		{
+			return Internal::globalFrameArena.Allocate(bytes, alignment);
+		}
+
+
+		/**
+		 * @brief    Allocates an uninitialized array for current frame.
+		 * @details  分配当前帧数组。
+		 */
+		template <typename T>
+		furud_nodiscard furud_inline T* AllocateArray(size_t num)
+		{
+			return static_cast<T*>(Allocate(sizeof(T) * num, alignof(T)));
+		}
+
+
+		/**
+		 * @brief    Constructs an object for current frame.
+		 * @details  构造当前帧对象。
+		 */
+		template <typename T, typename... Args> requires std::is_trivially_destructible_v<T>
+		furud_nodiscard furud_inline T* New(Args&&... args)
+		{
+			return ::new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+	}
+
+
+
+	/**
+	 * @brief    Standard allocator adapter of the frame arena, for the scratch containers.
+	 *           The deallocation does nothing, the memory is reclaimed with the frame.
+	 * @details  帧分配器的标准库适配器。
+	 */
+	template <typename T>
+	struct TFrameAllocator
+	{
+		using value_type = T;
+
+		constexpr TFrameAllocator() noexcept = default;
+
+		template <typename U>
+		constexpr TFrameAllocator(const TFrameAllocator<U>&) noexcept {}
+
+		furud_nodiscard T* allocate(size_t num)
+		{
+			return IFrameArena::AllocateArray<T>(num);
+		}
+
+		constexpr void deallocate(T*, size_t) noexcept {}
+
+		template <typename U>
+		constexpr bool operator == (const TFrameAllocator<U>&) const noexcept
+		{
+			return true;
+		}
+	};
+
+
+	/** Scratch vector whose memory lives in current frame. */
+	template <typename T>
+	using TFrameVector = std::vector<T, TFrameAllocator<T>>;
+
+
+
+	/**
+	 * @brief    String allocator of the frame arena, for the char arrays built and dropped within a frame.
+	 *           Use it as `TAnsicharArray<TFrameStringAllocator<char, size_t>>`.
+	 * @details  帧分配器的字符串适配器。
+	 */
+	template <typename TChar, typename TSize>
+	struct TFrameStringAllocator
+	{
+		static constexpr TSize CalculateCapacityGrowth(TSize capacity) noexcept
+		{
+			const TSize growth = 4 + capacity + ((capacity + 1) >> 1);
+			return growth > capacity ? growth : capacity;
+		}
+
+		furud_inline static void Free(TChar*) noexcept {}
+
+		furud_inline static void Alloc(const TSize& inStorageSize, TChar** furud_restrict outData, TSize* furud_restrict outCapacity)
+		{
+			*outData = IFrameArena::AllocateArray<TChar>(size_t(inStorageSize));
+			*outCapacity = inStorageSize;
+		}
+	};
+}
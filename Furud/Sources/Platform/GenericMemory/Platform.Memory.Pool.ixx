@@ -0,0 +1,539 @@
+//
+// Platform.Memory.Pool.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Fixed-size object pool.
+//
+module;
+
+#include <Furud.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdint.h>
+#include <utility>
+
+
+
+export module Furud.Platform.Memory.Pool;
+
+import Furud.Platform.Thread.SpinLock;
+
+namespace Furud::Internal
+{
+	/** The maximum number of allocators which have the thread caches, the others always go to the global list. */
+	constexpr uint32_t MaxCachedAllocators = 128;
+
+	/** The number of blocks moved between the thread cache and the global list at once. */
+	constexpr uint32_t PoolBatchSize = 32;
+
+	/** Alignment of slabs. */
+	constexpr size_t PoolSlabAlignment = 64;
+
+
+
+	/**
+	 * @brief    A free block. The head block of a batch links the next batch as well.
+	 * @details  空闲内存块。
+	 */
+	struct PoolFreeBlock
+	{
+		std::atomic<PoolFreeBlock*> next;
+		std::atomic<PoolFreeBlock*> nextBatch;
+	};
+
+
+	/** The slabs are linked through this header. */
+	struct alignas(PoolSlabAlignment) PoolSlab
+	{
+		PoolSlab* next;
+	};
+
+
+
+	/**
+	 * @brief    Free blocks of an allocator cached by a thread.
+	 * @details  线程缓存。
+	 */
+	struct PoolThreadCache
+	{
+		PoolFreeBlock* head = nullptr;
+		uint32_t count = 0;
+
+		/** Tag of the allocator the blocks belong to, a cache index may be reused by a later allocator. */
+		uint32_t tag = 0;
+	};
+
+
+	class PoolRegistry;
+
+
+	/**
+	 * @brief    The caches of current thread, returned to their allocators on thread exit.
+	 * @details  当前线程的缓存表。
+	 */
+	struct PoolThreadCaches
+	{
+		PoolThreadCache caches[MaxCachedAllocators];
+
+		~PoolThreadCaches();
+	};
+
+
+	thread_local PoolThreadCaches poolThreadCaches;
+}
+
+
+
+export namespace Furud
+{
+	/**
+	 * @brief    Allocator of fixed-size blocks carved from cache-line aligned slabs.
+	 *           The freed blocks go to a per-thread cache first, and move between the cache and
+	 *           the lock-free global list in batches, so most allocations touch no shared state.
+	 * @note     The slabs are only released when the allocator is destroyed.
+	 * @details  定长内存块分配器。
+	 */
+	class FixedBlockAllocator
+	{
+	private:
+		friend class Internal::PoolRegistry;
+
+		/** The low 48 bits hold the pointer, the high 16 bits hold the tag against ABA. */
+		static constexpr uint64_t PointerMask = (uint64_t(1) << 48) - 1;
+
+		alignas(64) std::atomic<uint64_t> globalBatches { 0 };
+
+		alignas(64) AtomicSpinLock slabMutex;
+		Internal::PoolSlab* slabs = nullptr;
+		uint32_t numSlabs = 0;
+
+		size_t blockSize;
+		uint32_t blocksPerSlab;
+		uint32_t cacheIndex;
+		uint32_t cacheTag;
+
+
+	public:
+		/**
+		 * @param    inBlockSize      -  Size of each block.
+		 * @param    inBlockAlign     -  Alignment of each block, up to the cache line size.
+		 * @param    inBlocksPerSlab  -  The number of blocks allocated from the system at once.
+		 */
+		explicit FixedBlockAllocator(size_t inBlockSize, size_t inBlockAlign = alignof(std::max_align_t), uint32_t inBlocksPerSlab = 256);
+
+		~FixedBlockAllocator();
+
+		FixedBlockAllocator(const FixedBlockAllocator&) = delete;
+		FixedBlockAllocator& operator = (const FixedBlockAllocator&) = delete;
+
+
+	public:
+		furud_nodiscard furud_inline size_t BlockSize() const noexcept
+		{
+			return blockSize;
+		}
+
+		furud_nodiscard furud_inline uint32_t NumSlabs() const noexcept
+		{
+			return numSlabs;
+		}
+
+		/**
+		 * @brief    Allocates a block.
+		 * @details  分配内存块。
+		 */
+		furud_nodiscard furud_inline void* Allocate()
+		{
+			if (Internal::PoolThreadCache* cache = GetCache()) furud_likely
+			{
+				if (!cache->head) furud_unlikely
+				{
+					cache->head = PopBatch();
+					cache->count = CountBlocks(cache->head);
+				}
+
+				Internal::PoolFreeBlock* block = cache->head;
+				cache->head = block->next.load(std::memory_order_relaxed);
+				cache->count--;
+				return block;
+			}
+
+			// Without the cache, a batch is taken and the rest is given back.
+			Internal::PoolFreeBlock* batch = PopBatch();
+			if (Internal::PoolFreeBlock* rest = batch->next.load(std::memory_order_relaxed))
+			{
+				PushBatch(rest, rest);
+			}
+			return batch;
+		}
+
+		/**
+		 * @brief    Returns a block to the allocator, it may come from any thread.
+		 * @details  释放内存块。
+		 */
+		furud_inline void Free(void* memory)
+		{
+			if (!memory)
+			{
+				return;
+			}
+
+			// Not constructed on purpose, a stale reader of the global list may still load the links.
+			Internal::PoolFreeBlock* block = static_cast<Internal::PoolFreeBlock*>(memory);
+			if (Internal::PoolThreadCache* cache = GetCache()) furud_likely
+			{
+				block->next.store(cache->head, std::memory_order_relaxed);
+				cache->head = block;
+
+				// Spills a batch to the global list, the other batch stays for the next allocations.
+				if (++cache->count == Internal::PoolBatchSize * 2) furud_unlikely
+				{
+					Internal::PoolFreeBlock* tail = cache->head;
+					for (uint32_t index = 1; index < Internal::PoolBatchSize; ++index)
+					{
+						tail = tail->next.load(std::memory_order_relaxed);
+					}
+
+					Internal::PoolFreeBlock* batch = cache->head;
+					cache->head = tail->next.load(std::memory_order_relaxed);
+					cache->count -= Internal::PoolBatchSize;
+					tail->next.store(nullptr, std::memory_order_relaxed);
+					PushBatch(batch, batch);
+				}
+				return;
+			}
+
+			block->next.store(nullptr, std::memory_order_relaxed);
+			PushBatch(block, block);
+		}
+
+
+	private:
+		/** Gets the cache of current thread, null if this allocator has no cache. */
+		furud_inline Internal::PoolThreadCache* GetCache() noexcept
+		{
+			if (cacheIndex >= Internal::MaxCachedAllocators) furud_unlikely
+			{
+				return nullptr;
+			}
+
+			Internal::PoolThreadCache& cache = Internal::poolThreadCaches.caches[cacheIndex];
+			if (cache.tag != cacheTag) furud_unlikely
+			{
+				// Left by a destroyed allocator.
+				cache = { nullptr, 0, cacheTag };
+			}
+			return &cache;
+		}
+
+		furud_inline static uint32_t CountBlocks(Internal::PoolFreeBlock* blocks) noexcept
+		{
+			uint32_t count = 0;
+			for (; blocks; blocks = blocks->next.load(std::memory_order_relaxed))
+			{
+				count++;
+			}
+			return count;
+		}
+
+		furud_inline static uint64_t Pack(Internal::PoolFreeBlock* block, uint64_t tag) noexcept
+		{
+			return (uint64_t(uintptr_t(block)) & PointerMask) | (tag << 48);
+		}
+
+		furud_inline static Internal::PoolFreeBlock* Unpack(uint64_t value) noexcept
+		{
+			return reinterpret_cast<Internal::PoolFreeBlock*>(uintptr_t(value & PointerMask));
+		}
+
+		/** Pushes a chain of batches linked by `nextBatch`. */
+		void PushBatch(Internal::PoolFreeBlock* first, Internal::PoolFreeBlock* last) noexcept
+		{
+			uint64_t head = globalBatches.load(std::memory_order_relaxed);
+			do
+			{
+				last->nextBatch.store(Unpack(head), std::memory_order_relaxed);
+			}
+			while (!globalBatches.compare_exchange_weak(head, Pack(first, (head >> 48) + 1), std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		/** Pops a batch, allocates a new slab if the global list is empty. */
+		Internal::PoolFreeBlock* PopBatch()
+		{
+			uint64_t head = globalBatches.load(std::memory_order_acquire);
+			while (Internal::PoolFreeBlock* batch = Unpack(head))
+			{
+				// The block may be popped and reused meanwhile, the memory is still readable and the tag fails the exchange.
+				Internal::PoolFreeBlock* next = batch->nextBatch.load(std::memory_order_relaxed);
+				if (globalBatches.compare_exchange_weak(head, Pack(next, (head >> 48) + 1), std::memory_order_acquire, std::memory_order_acquire))
+				{
+					return batch;
+				}
+			}
+
+			return AllocateSlab();
+		}
+
+		Internal::PoolFreeBlock* AllocateSlab();
+
+		void FlushCache(Internal::PoolThreadCache& cache) noexcept
+		{
+			if (cache.tag == cacheTag && cache.head)
+			{
+				PushBatch(cache.head, cache.head);
+			}
+			cache = {};
+		}
+	};
+
+
+
+	/**
+	 * @brief    Pool of objects of type `T`, shared by all threads.
+	 * @details  对象池。
+	 */
+	template <typename T>
+	class TPool
+	{
+	public:
+		/**
+		 * @brief    Gets the allocator of `T`, created on first use.
+		 *           The allocator is never destroyed, so objects owned by other statics,
+		 *           e.g. the jobs drained by the global job scheduler, can still be freed during exit.
+		 * @details  获取对象池的分配器。
+		 */
+		furud_nodiscard static FixedBlockAllocator& GetAllocator()
+		{
+			static FixedBlockAllocator* allocator = new FixedBlockAllocator(sizeof(T), alignof(T));
+			return *allocator;
+		}
+
+		furud_nodiscard furud_inline static void* Allocate()
+		{
+			return GetAllocator().Allocate();
+		}
+
+		furud_inline static void Free(void* memory)
+		{
+			GetAllocator().Free(memory);
+		}
+
+		/**
+		 * @brief    Constructs an object in the pool.
+		 * @details  构造对象。
+		 */
+		template <typename... Args>
+		furud_nodiscard static T* New(Args&&... args)
+		{
+			void* memory = Allocate();
+			try
+			{
+				return ::new (memory) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				Free(memory);
+				throw;
+			}
+		}
+
+		/**
+		 * @brief    Destroys an object constructed by `New`.
+		 * @details  析构对象。
+		 */
+		static void Delete(T* object)
+		{
+			if (object)
+			{
+				object->~T();
+				Free(object);
+			}
+		}
+	};
+
+
+
+	/**
+	 * @brief    Makes `new` and `delete` of `T` go through its pool.
+	 *           Derived classes of other size fall back to the global heap.
+	 * @details  使类型使用对象池分配。
+	 */
+	template <typename T>
+	class TPoolAllocated
+	{
+	public:
+		furud_nodiscard static void* operator new (size_t size)
+		{
+			return size == sizeof(T) ? TPool<T>::Allocate() : ::operator new(size);
+		}
+
+		static void operator delete (void* memory, size_t size) noexcept
+		{
+			if (size == sizeof(T))
+			{
+				TPool<T>::Free(memory);
+			}
+			else
+			{
+				::operator delete(memory);
+			}
+		}
+	};
+}
+
+
+
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Hands out the cache indices, and guards the allocators against the exiting threads.
+	 * @details  分配器注册表。
+	 */
+	class PoolRegistry
+	{
+	private:
+		AtomicSpinLock mutex;
+		FixedBlockAllocator* allocators[MaxCachedAllocators] {};
+		std::atomic<uint32_t> lastTag { 0 };
+
+
+	public:
+		uint32_t NextTag()
+		{
+			return ++lastTag;
+		}
+
+		uint32_t Register(FixedBlockAllocator* allocator)
+		{
+			AtomicScopeLock lock(mutex);
+			for (uint32_t index = 0; index < MaxCachedAllocators; ++index)
+			{
+				if (!allocators[index])
+				{
+					allocators[index] = allocator;
+					return index;
+				}
+			}
+			return MaxCachedAllocators;
+		}
+
+		void Unregister(uint32_t index)
+		{
+			if (index < MaxCachedAllocators)
+			{
+				AtomicScopeLock lock(mutex);
+				allocators[index] = nullptr;
+			}
+		}
+
+		/** Returns the cached blocks of an exiting thread. */
+		void Flush(PoolThreadCaches& caches)
+		{
+			AtomicScopeLock lock(mutex);
+			for (uint32_t index = 0; index < MaxCachedAllocators; ++index)
+			{
+				if (allocators[index])
+				{
+					allocators[index]->FlushCache(caches.caches[index]);
+				}
+			}
+		}
+	};
+
+
+	/** The global registry. */
+	PoolRegistry globalPoolRegistry;
+
+
+	PoolThreadCaches::~PoolThreadCaches()
+	{
+		globalPoolRegistry.Flush(*this);
+	}
+}
+
+
+
+namespace Furud
+{
+	FixedBlockAllocator::FixedBlockAllocator(size_t inBlockSize, size_t inBlockAlign, uint32_t inBlocksPerSlab)
+	{
+		// A block must hold the free list links, and is rounded up to keep every block aligned.
+		const size_t alignment = std::clamp<size_t>(inBlockAlign, alignof(Internal::PoolFreeBlock), Internal::PoolSlabAlignment);
+		blockSize = std::max(inBlockSize, sizeof(Internal::PoolFreeBlock));
+		blockSize = (blockSize + alignment - 1) & ~(alignment - 1);
+
+		// Slabs are carved into whole batches.
+		blocksPerSlab = std::max(inBlocksPerSlab, Internal::PoolBatchSize);
+		blocksPerSlab = (blocksPerSlab + Internal::PoolBatchSize - 1) / Internal::PoolBatchSize * Internal::PoolBatchSize;
+
+		cacheTag = Internal::globalPoolRegistry.NextTag();
+		cacheIndex = Internal::globalPoolRegistry.Register(this);
+	}
+
+
+	FixedBlockAllocator::~FixedBlockAllocator()
+	{
+		Internal::globalPoolRegistry.Unregister(cacheIndex);
+
+		// The blocks cached by the living threads are dropped lazily by the tag.
+
+		while (Internal::PoolSlab* slab = slabs)
+		{
+			slabs = slab->next;
+			::operator delete(slab, std::align_val_t(Internal::PoolSlabAlignment));
+		}
+	}
+
+
+	Internal::PoolFreeBlock* FixedBlockAllocator::AllocateSlab()
+	{
+		const size_t headerSize = sizeof(Internal::PoolSlab);
+		void* memory = ::operator new(headerSize + blockSize * blocksPerSlab, std::align_val_t(Internal::PoolSlabAlignment));
+
+		Internal::PoolSlab* slab = ::new (memory) Internal::PoolSlab{ nullptr };
+		{
+			AtomicScopeLock lock(slabMutex);
+			slab->next = slabs;
+			slabs = slab;
+			numSlabs++;
+		}
+
+		// Links the blocks into batches, and the batches into a chain.
+		uint8_t* base = static_cast<uint8_t*>(memory) + headerSize;
+		Internal::PoolFreeBlock* firstBatch = nullptr;
+		Internal::PoolFreeBlock* prevBatch = nullptr;
+		for (uint32_t batchIndex = 0; batchIndex < blocksPerSlab; batchIndex += Internal::PoolBatchSize)
+		{
+			Internal::PoolFreeBlock* batch = nullptr;
+			for (uint32_t index = Internal::PoolBatchSize; index-- > 0;)
+			{
+				Internal::PoolFreeBlock* block = ::new (base + (batchIndex + index) * blockSize) Internal::PoolFreeBlock;
+				block->next.store(batch, std::memory_order_relaxed);
+				block->nextBatch.store(nullptr, std::memory_order_relaxed);
+				batch = block;
+			}
+
+			if (prevBatch)
+			{
+				prevBatch->nextBatch.store(batch, std::memory_order_relaxed);
+			}
+			else
+			{
+				firstBatch = batch;
+			}
+			prevBatch = batch;
+		}
+
+		// Keeps the first batch, publishes the others.
+		Internal::PoolFreeBlock* rest = firstBatch->nextBatch.load(std::memory_order_relaxed);
+		if (rest)
+		{
+			PushBatch(rest, prevBatch);
+		}
+		return firstBatch;
+	}
+}
@@ -14,6 +14,7 @@ module;
 export module Furud.Platform.RHI.Resource:Buffer;
 import :Common;
 import Furud.Platform.RHI.Verification;
+import Furud.Platform.Memory.Pool;
 
 export namespace Furud
 {
@@ -41,7 +42,7 @@ export namespace Furud
 
 
 
-	class RHIBuffer : public IRHIResource
+	class RHIBuffer : public IRHIResource, public TPoolAllocated<RHIBuffer>
 	{
 	private:
 		ERHIBufferFlag flag;
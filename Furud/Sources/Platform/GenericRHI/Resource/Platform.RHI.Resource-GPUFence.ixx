@@ -14,10 +14,11 @@ module;
 export module Furud.Platform.RHI.Resource:GPUFence;
 import :Common;
 import Furud.Platform.RHI.Verification;
+import Furud.Platform.Memory.Pool;
 
 export namespace Furud
 {
-	class RHIGPUFence : public IRHIResource
+	class RHIGPUFence : public IRHIResource, public TPoolAllocated<RHIGPUFence>
 	{
 	private:
 		Microsoft::WRL::ComPtr<ID3D12Fence> fence;
@@ -0,0 +1,422 @@
+//
+// Platform.SIMD-Dispatch.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Runtime cpu feature detection and kernel dispatch.
+//
+module;
+
+#include <Furud.hpp>
+#include <atomic>
+#include <initializer_list>
+#include <stdint.h>
+#include <string.h>
+#if FURUD_SIMD_PORTABLE
+// No cpuid, the portable backend reports the Scalar level.
+#elif FURUD_OS_WIN
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+
+
+export module Furud.Platform.SIMD:Dispatch;
+
+
+
+/** Instruction set levels. */
+export namespace Furud
+{
+	/**
+	 * @brief    Instruction set tiers, ordered so that every level implies the ones below it.
+	 * @details  指令集等级。
+	 *
+	 * - SSE41   SSE2 ~ SSE4.1 and SSSE3, required by blendv / dpps / ptest.
+	 * - AVX     256-bit float lanes, with the operating system saving the ymm state.
+	 * - AVX2    256-bit integer lanes, FMA3 and F16C (Haswell or later).
+	 * - AVX512  AVX-512 F/DQ/BW/VL, with the operating system saving the zmm state.
+	 */
+	enum class ESimdLevel : uint8_t
+	{
+		Scalar = 0,
+		SSE2,
+		SSE41,
+		AVX,
+		AVX2,
+		AVX512,
+
+		Num
+	};
+
+
+	/**
+	 * @brief    The instruction set level the current binary is compiled for.
+	 * @details  编译期指令集等级。Vec4/Vec8/Mat44 are inlined against this level, so the host must
+	 *           support it. Batch kernels that want to use higher levels go through TSimdDispatch.
+	 */
+	inline constexpr ESimdLevel CompiledSimdLevel =
+#if FURUD_SIMD_PORTABLE
+		ESimdLevel::Scalar;
+#elif defined(__AVX512F__) && defined(__AVX512DQ__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+		ESimdLevel::AVX512;
+#elif defined(__AVX2__)
+		ESimdLevel::AVX2;
+#elif defined(__AVX__)
+		ESimdLevel::AVX;
+#elif defined(__SSE4_1__)
+		ESimdLevel::SSE41;
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		ESimdLevel::SSE2;
+#else
+		ESimdLevel::Scalar;
+#endif
+
+	// Vec8f, FMA3 and F16C are used without dispatch ( SoA entries, Packing, Color ), so the native backend
+	// must be built for AVX2 at least, otherwise IsSimdBaselineSupported() would accept hosts that crash.
+#if !FURUD_SIMD_PORTABLE
+	static_assert(CompiledSimdLevel >= ESimdLevel::AVX2, "[Furud] build with /arch:AVX2 ( or -mavx2 -mfma -mf16c )!");
+#endif
+
+
+	/**
+	 * @brief    Cpu features reported by cpuid, masked by the register state the os has enabled.
+	 * @details  处理器特性。
+	 */
+	struct SimdFeatures
+	{
+		bool bSSE2     = false;
+		bool bSSE3     = false;
+		bool bSSSE3    = false;
+		bool bSSE41    = false;
+		bool bSSE42    = false;
+		bool bPOPCNT   = false;
+		bool bAVX      = false;
+		bool bF16C     = false;
+		bool bFMA      = false;
+		bool bAVX2     = false;
+		bool bBMI1     = false;
+		bool bBMI2     = false;
+		bool bAVX512F  = false;
+		bool bAVX512DQ = false;
+		bool bAVX512BW = false;
+		bool bAVX512VL = false;
+
+		/** The highest level whose features are all present. */
+		ESimdLevel level = ESimdLevel::Scalar;
+
+		/** E.g. "GenuineIntel", "AuthenticAMD". */
+		char vendor[13] = {};
+
+		/** E.g. "AMD Ryzen 9 5950X 16-Core Processor". */
+		char brand[49] = {};
+	};
+}
+
+
+
+namespace Furud::Internal
+{
+#if !FURUD_SIMD_PORTABLE
+	furud_inline void QueryCpuid(uint32_t leaf, uint32_t subleaf, uint32_t(&regs)[4]) noexcept
+	{
+#if FURUD_OS_WIN
+		int values[4];
+		__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+		memcpy(regs, values, sizeof(values));
+#else
+		__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+	}
+
+
+	furud_inline uint64_t QueryEnabledStateMask() noexcept
+	{
+#if FURUD_OS_WIN
+		return _xgetbv(0);
+#else
+		uint32_t lo, hi;
+		__asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+		return (static_cast<uint64_t>(hi) << 32) | lo;
+#endif
+	}
+#endif
+
+
+	furud_noinline SimdFeatures DetectSimdFeatures() noexcept
+	{
+		SimdFeatures features;
+#if FURUD_SIMD_PORTABLE
+		return features;
+#else
+		uint32_t regs[4] = {};
+
+		QueryCpuid(0, 0, regs);
+		const uint32_t maxLeaf = regs[0];
+		memcpy(features.vendor + 0, &regs[1], 4);
+		memcpy(features.vendor + 4, &regs[3], 4);
+		memcpy(features.vendor + 8, &regs[2], 4);
+
+		QueryCpuid(0x80000000u, 0, regs);
+		if (regs[0] >= 0x80000004u)
+		{
+			for (uint32_t i = 0; i < 3; ++i)
+			{
+				QueryCpuid(0x80000002u + i, 0, regs);
+				memcpy(features.brand + i * 16, regs, 16);
+			}
+		}
+
+		if (maxLeaf < 1)
+		{
+			return features;
+		}
+
+		QueryCpuid(1, 0, regs);
+		const uint32_t ecx1 = regs[2];
+		const uint32_t edx1 = regs[3];
+		features.bSSE2   = (edx1 & (1u << 26)) != 0;
+		features.bSSE3   = (ecx1 & (1u << 0)) != 0;
+		features.bSSSE3  = (ecx1 & (1u << 9)) != 0;
+		features.bSSE41  = (ecx1 & (1u << 19)) != 0;
+		features.bSSE42  = (ecx1 & (1u << 20)) != 0;
+		features.bPOPCNT = (ecx1 & (1u << 23)) != 0;
+
+		// AVX registers are only usable when the os saves them on context switch (OSXSAVE + XCR0).
+		const bool bOSXSave = (ecx1 & (1u << 27)) != 0;
+		const uint64_t stateMask = bOSXSave ? QueryEnabledStateMask() : 0;
+		const bool bYmmState = (stateMask & 0x06) == 0x06;
+		const bool bZmmState = (stateMask & 0xE6) == 0xE6;
+
+		features.bAVX  = bYmmState && (ecx1 & (1u << 28)) != 0;
+		features.bF16C = features.bAVX && (ecx1 & (1u << 29)) != 0;
+		features.bFMA  = features.bAVX && (ecx1 & (1u << 12)) != 0;
+
+		if (maxLeaf >= 7)
+		{
+			QueryCpuid(7, 0, regs);
+			const uint32_t ebx7 = regs[1];
+			features.bBMI1     = (ebx7 & (1u << 3)) != 0;
+			features.bBMI2     = (ebx7 & (1u << 8)) != 0;
+			features.bAVX2     = features.bAVX && (ebx7 & (1u << 5)) != 0;
+			features.bAVX512F  = bZmmState && (ebx7 & (1u << 16)) != 0;
+			features.bAVX512DQ = features.bAVX512F && (ebx7 & (1u << 17)) != 0;
+			features.bAVX512BW = features.bAVX512F && (ebx7 & (1u << 30)) != 0;
+			features.bAVX512VL = features.bAVX512F && (ebx7 & (1u << 31)) != 0;
+		}
+
+		if (features.bSSE2)
+		{
+			features.level = ESimdLevel::SSE2;
+		}
+		if (features.level == ESimdLevel::SSE2 && features.bSSE3 && features.bSSSE3 && features.bSSE41)
+		{
+			features.level = ESimdLevel::SSE41;
+		}
+		if (features.level == ESimdLevel::SSE41 && features.bAVX)
+		{
+			features.level = ESimdLevel::AVX;
+		}
+		if (features.level == ESimdLevel::AVX && features.bAVX2 && features.bFMA && features.bF16C)
+		{
+			features.level = ESimdLevel::AVX2;
+		}
+		if (features.level == ESimdLevel::AVX2 && features.bAVX512F && features.bAVX512DQ && features.bAVX512BW && features.bAVX512VL)
+		{
+			features.level = ESimdLevel::AVX512;
+		}
+		return features;
+#endif
+	}
+
+
+	inline std::atomic<uint8_t> SimdLevelLimit{ static_cast<uint8_t>(ESimdLevel::Num) };
+}
+
+
+
+/** Query API. */
+export namespace Furud
+{
+	/**
+	 * @brief    Returns the features of the host cpu, detected once on first use.
+	 * @details  获取处理器特性。
+	 */
+	furud_nodiscard inline const SimdFeatures& GetSimdFeatures() noexcept
+	{
+		static const SimdFeatures features = Internal::DetectSimdFeatures();
+		return features;
+	}
+
+
+	/**
+	 * @brief    Returns the level used by TSimdDispatch: the host level, capped by SetSimdLevelLimit().
+	 *           Under FURUD_SIMD_STRICT_IEEE it is also capped by CompiledSimdLevel: kernels of other levels
+	 *           only promise the same results within their tolerance, not the same bits.
+	 * @details  获取当前生效的指令集等级。
+	 */
+	furud_nodiscard inline ESimdLevel GetSimdLevel() noexcept
+	{
+		const uint8_t host = static_cast<uint8_t>(GetSimdFeatures().level);
+		uint8_t limit = Internal::SimdLevelLimit.load(std::memory_order_relaxed);
+#if FURUD_SIMD_STRICT_IEEE
+		limit = limit < static_cast<uint8_t>(CompiledSimdLevel) ? limit : static_cast<uint8_t>(CompiledSimdLevel);
+#endif
+		return static_cast<ESimdLevel>(host < limit ? host : limit);
+	}
+
+
+	/**
+	 * @brief    Caps the level TSimdDispatch may select, e.g. to compare paths or work around a bad driver.
+	 * @details  限制指令集等级。Must be called at startup before the first dispatch; dispatchers that have
+	 *           already resolved keep their kernel until TSimdDispatch::Reset().
+	 */
+	inline void SetSimdLevelLimit(ESimdLevel limit) noexcept
+	{
+		Internal::SimdLevelLimit.store(static_cast<uint8_t>(limit), std::memory_order_relaxed);
+	}
+
+
+	/**
+	 * @brief    Returns whether the host can run code compiled for CompiledSimdLevel.
+	 * @details  检查处理器是否支持编译期指令集。Check this before touching any Vec type, otherwise older
+	 *           hosts fault with an illegal instruction instead of a readable error.
+	 */
+	furud_nodiscard inline bool IsSimdBaselineSupported() noexcept
+	{
+		return GetSimdFeatures().level >= CompiledSimdLevel;
+	}
+
+
+	/**
+	 * @brief    Returns the display name of a level.
+	 * @details  获取指令集名称。
+	 */
+	furud_nodiscard constexpr const char* GetSimdLevelName(ESimdLevel level) noexcept
+	{
+		switch (level)
+		{
+		case ESimdLevel::Scalar: return "Scalar";
+		case ESimdLevel::SSE2:   return "SSE2";
+		case ESimdLevel::SSE41:  return "SSE4.1";
+		case ESimdLevel::AVX:    return "AVX";
+		case ESimdLevel::AVX2:   return "AVX2";
+		case ESimdLevel::AVX512: return "AVX-512";
+		default:                 return "Unknown";
+		}
+	}
+}
+
+
+
+/** Kernel dispatch. */
+export namespace Furud
+{
+	template <typename TFunction>
+	class TSimdDispatch;
+
+
+	/**
+	 * @brief    A function-pointer table holding one kernel per instruction set level.
+	 * @details  多指令集函数分发表。The first call picks the highest registered kernel the host supports
+	 *           and caches it, so steady-state calls cost one indirect call. Kernels for levels above
+	 *           CompiledSimdLevel must be compiled with furud_target(...) on gcc/clang.
+	 *
+	 * @example
+	 *   furud_target("avx2,fma") void ScaleAVX2(float* data, size_t n, float s);
+	 *   void ScaleSSE2(float* data, size_t n, float s);
+	 *
+	 *   inline TSimdDispatch<void(float*, size_t, float)> Scale
+	 *   {
+	 *       { ESimdLevel::SSE2, &ScaleSSE2 },
+	 *       { ESimdLevel::AVX2, &ScaleAVX2 },
+	 *   };
+	 *
+	 *   Scale(data, n, 2.0f);
+	 */
+	template <typename TReturn, typename... TArgs>
+	class TSimdDispatch<TReturn(TArgs...)>
+	{
+	public:
+		using FunctionType = TReturn(*)(TArgs...);
+
+
+		struct Candidate
+		{
+			ESimdLevel level;
+			FunctionType function;
+		};
+
+
+	private:
+		FunctionType candidates[static_cast<size_t>(ESimdLevel::Num)] = {};
+		mutable std::atomic<FunctionType> resolved{ nullptr };
+		mutable std::atomic<uint8_t> resolvedLevel{ static_cast<uint8_t>(ESimdLevel::Num) };
+
+
+	public:
+		constexpr TSimdDispatch(std::initializer_list<Candidate> list) noexcept
+		{
+			for (const Candidate& candidate : list)
+			{
+				candidates[static_cast<size_t>(candidate.level)] = candidate.function;
+			}
+		}
+
+		TSimdDispatch(const TSimdDispatch&) = delete;
+
+		TSimdDispatch& operator = (const TSimdDispatch&) = delete;
+
+
+	public:
+		furud_inline TReturn operator () (TArgs... args) const
+		{
+			FunctionType function = resolved.load(std::memory_order_acquire);
+			if (function == nullptr) furud_unlikely
+			{
+				function = Resolve();
+			}
+			return function(static_cast<TArgs&&>(args)...);
+		}
+
+
+		/** Returns the level of the selected kernel, resolving it if necessary. */
+		furud_nodiscard ESimdLevel GetResolvedLevel() const noexcept
+		{
+			if (resolved.load(std::memory_order_acquire) == nullptr)
+			{
+				Resolve();
+			}
+			return static_cast<ESimdLevel>(resolvedLevel.load(std::memory_order_relaxed));
+		}
+
+
+		/** Drops the cached kernel so that the next call re-selects it, e.g. after SetSimdLevelLimit(). */
+		void Reset() noexcept
+		{
+			resolved.store(nullptr, std::memory_order_release);
+		}
+
+
+	private:
+		furud_noinline FunctionType Resolve() const noexcept
+		{
+			const size_t top = static_cast<size_t>(GetSimdLevel());
+			for (size_t i = top + 1; i-- > 0;)
+			{
+				if (candidates[i] != nullptr)
+				{
+					resolvedLevel.store(static_cast<uint8_t>(i), std::memory_order_relaxed);
+					resolved.store(candidates[i], std::memory_order_release);
+					return candidates[i];
+				}
+			}
+
+			// No kernel is runnable on this host: the table must register a Scalar or SSE2 fallback.
+			furud_softbreak;
+			return nullptr;
+		}
+	};
+}
@@ -10,7 +10,7 @@ module;
 
 #include <Furud.hpp>
 #include <cstdint>
-#include <immintrin.h>
+#include "SIMDBackend.hpp"
 
 
 
@@ -294,6 +294,40 @@ export namespace Furud
 			return temp;
 		}
 
+		/**
+		 * @brief    Multiplies two aligned matrices in memory, ( dst = lhs * rhs ).
+		 * @details  矩阵乘法（内存）。
+		 *           每条 AVX 指令同时处理两行，dst 可与 lhs 或 rhs 重叠。
+		 */
+		furud_inline static void furud_vectorapi Multiply(const void* lhs, const void* rhs, void* dst) noexcept
+		{
+			const float* m1 = static_cast<const float*>(lhs);
+			const float* m2 = static_cast<const float*>(rhs);
+			float* m = static_cast<float*>(dst);
+
+			// Rows of rhs, replicated into both halves.
+			const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2));
+			const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2 + 4));
+			const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2 + 8));
+			const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2 + 12));
+
+			// Rows 0-1 and rows 2-3 of lhs.
+			const __m256 a01 = _mm256_load_ps(m1);
+			const __m256 a23 = _mm256_load_ps(m1 + 8);
+
+			__m256 r01 = _mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0), b0);
+			__m256 r23 = _mm256_mul_ps(_mm256_shuffle_ps(a23, a23, 0), b0);
+			r01 = _mm256_fmadd_ps(_mm256_shuffle_ps(a01, a01, 85u), b1, r01);
+			r23 = _mm256_fmadd_ps(_mm256_shuffle_ps(a23, a23, 85u), b1, r23);
+			r01 = _mm256_fmadd_ps(_mm256_shuffle_ps(a01, a01, 170u), b2, r01);
+			r23 = _mm256_fmadd_ps(_mm256_shuffle_ps(a23, a23, 170u), b2, r23);
+			r01 = _mm256_fmadd_ps(_mm256_shuffle_ps(a01, a01, 255u), b3, r01);
+			r23 = _mm256_fmadd_ps(_mm256_shuffle_ps(a23, a23, 255u), b3, r23);
+
+			_mm256_store_ps(m, r01);
+			_mm256_store_ps(m + 8, r23);
+		}
+
 
 	public:
 		//****************************************************************
@@ -394,5 +428,47 @@ export namespace Furud
 
 			return m;
 		}
+
+		furud_inline Mat44f furud_vectorapi InverseAffine() const noexcept
+		{
+			// For an affine matrix | R  0 |, the inverse is | i(R)      0 |
+			//                      | t  1 |                 | -t*i(R)   1 |
+			// and i(R) is built from cross products of the rows of R.
+			const Vec4f r0 = r[0];
+			const Vec4f r1 = r[1];
+			const Vec4f r2 = r[2];
+
+			// Columns of adj(R) as (r1 x r2, r2 x r0, r0 x r1), w is 0.
+			__m128 c0 = r1.Swizzle<1, 2, 0, 3>() * r2.Swizzle<2, 0, 1, 3>() - r1.Swizzle<2, 0, 1, 3>() * r2.Swizzle<1, 2, 0, 3>();
+			__m128 c1 = r2.Swizzle<1, 2, 0, 3>() * r0.Swizzle<2, 0, 1, 3>() - r2.Swizzle<2, 0, 1, 3>() * r0.Swizzle<1, 2, 0, 3>();
+			__m128 c2 = r0.Swizzle<1, 2, 0, 3>() * r1.Swizzle<2, 0, 1, 3>() - r0.Swizzle<2, 0, 1, 3>() * r1.Swizzle<1, 2, 0, 3>();
+
+			const float detR = DotProduct(r0, Vec4f(c0));
+			if (detR == 0.0f)
+			{
+				return *this;
+			}
+
+			__m128 c3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+			const Vec4f invDetR = 1.0f / detR;
+			const Vec4f i0 = Vec4f(c0) * invDetR;
+			const Vec4f i1 = Vec4f(c1) * invDetR;
+			const Vec4f i2 = Vec4f(c2) * invDetR;
+
+			const Vec4f t = r[3];
+			Vec4f i3 = t.ReplicateX() * i0;
+			i3 = MultiplyAdd(t.ReplicateY(), i1, i3);
+			i3 = MultiplyAdd(t.ReplicateZ(), i2, i3);
+			i3 = Vec4f(0.f, 0.f, 0.f, 1.f) - i3;
+
+			Mat44f result;
+			result.SetRow0(i0);
+			result.SetRow1(i1);
+			result.SetRow2(i2);
+			result.SetRow3(i3);
+			return result;
+		}
 	};
 }
\ No newline at end of file
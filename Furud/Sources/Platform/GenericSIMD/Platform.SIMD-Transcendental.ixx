@@ -0,0 +1,782 @@
+//
+// Platform.SIMD-Transcendental.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Vectorized transcendental functions.
+//
+module;
+
+#include <Furud.hpp>
+#include <math.h>
+#include <stdint.h>
+#include "SIMDBackend.hpp"
+
+
+
+export module Furud.Platform.SIMD:Transcendental;
+
+
+
+/** Lane operations. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Uniform lane operations over the 128-bit and 256-bit float registers,
+	 *           so that one kernel serves both Vec4f and Vec8f.
+	 *           The 128-bit operations stay within SSE4.1, multiply-add is not fused there.
+	 * @details  SIMD 浮点寄存器的统一操作。
+	 */
+	template <typename TRegister>
+	struct TSimdFloat;
+
+
+	template <>
+	struct TSimdFloat<__m128>
+	{
+		using TInteger = __m128i;
+		static constexpr int32_t NumLanes = 4;
+		static constexpr bool bFused = false;
+
+		furud_inline static __m128 Set(float value) noexcept { return _mm_set1_ps(value); }
+		furud_inline static __m128 Add(__m128 lhs, __m128 rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+		furud_inline static __m128 Sub(__m128 lhs, __m128 rhs) noexcept { return _mm_sub_ps(lhs, rhs); }
+		furud_inline static __m128 Mul(__m128 lhs, __m128 rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+		furud_inline static __m128 Div(__m128 lhs, __m128 rhs) noexcept { return _mm_div_ps(lhs, rhs); }
+		furud_inline static __m128 MulAdd(__m128 lhs, __m128 mhs, __m128 rhs) noexcept { return _mm_add_ps(_mm_mul_ps(lhs, mhs), rhs); }
+		furud_inline static __m128 NegMulAdd(__m128 lhs, __m128 mhs, __m128 rhs) noexcept { return _mm_sub_ps(rhs, _mm_mul_ps(lhs, mhs)); }
+		furud_inline static __m128 Min(__m128 lhs, __m128 rhs) noexcept { return _mm_min_ps(lhs, rhs); }
+		furud_inline static __m128 Max(__m128 lhs, __m128 rhs) noexcept { return _mm_max_ps(lhs, rhs); }
+		furud_inline static __m128 Round(__m128 value) noexcept { return _mm_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+		furud_inline static __m128 And(__m128 lhs, __m128 rhs) noexcept { return _mm_and_ps(lhs, rhs); }
+		furud_inline static __m128 AndNot(__m128 lhs, __m128 rhs) noexcept { return _mm_andnot_ps(lhs, rhs); }
+		furud_inline static __m128 Or(__m128 lhs, __m128 rhs) noexcept { return _mm_or_ps(lhs, rhs); }
+		furud_inline static __m128 Xor(__m128 lhs, __m128 rhs) noexcept { return _mm_xor_ps(lhs, rhs); }
+		furud_inline static __m128 Select(__m128 mask, __m128 lhs, __m128 rhs) noexcept { return _mm_blendv_ps(rhs, lhs, mask); }
+		furud_inline static int32_t MaskBits(__m128 mask) noexcept { return _mm_movemask_ps(mask); }
+
+		furud_inline static __m128 Equal(__m128 lhs, __m128 rhs) noexcept { return _mm_cmpeq_ps(lhs, rhs); }
+		furud_inline static __m128 Less(__m128 lhs, __m128 rhs) noexcept { return _mm_cmplt_ps(lhs, rhs); }
+		furud_inline static __m128 Greater(__m128 lhs, __m128 rhs) noexcept { return _mm_cmpgt_ps(lhs, rhs); }
+		furud_inline static __m128 Unordered(__m128 lhs, __m128 rhs) noexcept { return _mm_cmpunord_ps(lhs, rhs); }
+
+		furud_inline static __m128i ToInteger(__m128 value) noexcept { return _mm_cvtps_epi32(value); }
+		furud_inline static __m128 ToFloat(__m128i value) noexcept { return _mm_cvtepi32_ps(value); }
+		furud_inline static __m128i AsInteger(__m128 value) noexcept { return _mm_castps_si128(value); }
+		furud_inline static __m128 AsFloat(__m128i value) noexcept { return _mm_castsi128_ps(value); }
+
+		furud_inline static __m128i SetInteger(int32_t value) noexcept { return _mm_set1_epi32(value); }
+		furud_inline static __m128i AddInteger(__m128i lhs, __m128i rhs) noexcept { return _mm_add_epi32(lhs, rhs); }
+		furud_inline static __m128i SubInteger(__m128i lhs, __m128i rhs) noexcept { return _mm_sub_epi32(lhs, rhs); }
+		furud_inline static __m128i AndInteger(__m128i lhs, __m128i rhs) noexcept { return _mm_and_si128(lhs, rhs); }
+		furud_inline static __m128i OrInteger(__m128i lhs, __m128i rhs) noexcept { return _mm_or_si128(lhs, rhs); }
+		template <int32_t Count> furud_inline static __m128i ShiftLeft(__m128i value) noexcept { return _mm_slli_epi32(value, Count); }
+		template <int32_t Count> furud_inline static __m128i ShiftRight(__m128i value) noexcept { return _mm_srai_epi32(value, Count); }
+		template <int32_t Count> furud_inline static __m128i ShiftRightLogical(__m128i value) noexcept { return _mm_srli_epi32(value, Count); }
+
+		furud_inline static void Store(float* data, __m128 value) noexcept { _mm_storeu_ps(data, value); }
+		furud_inline static __m128 Load(const float* data) noexcept { return _mm_loadu_ps(data); }
+	};
+
+
+	template <>
+	struct TSimdFloat<__m256>
+	{
+		using TInteger = __m256i;
+		static constexpr int32_t NumLanes = 8;
+		static constexpr bool bFused = true;
+
+		furud_inline static __m256 Set(float value) noexcept { return _mm256_set1_ps(value); }
+		furud_inline static __m256 Add(__m256 lhs, __m256 rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+		furud_inline static __m256 Sub(__m256 lhs, __m256 rhs) noexcept { return _mm256_sub_ps(lhs, rhs); }
+		furud_inline static __m256 Mul(__m256 lhs, __m256 rhs) noexcept { return _mm256_mul_ps(lhs, rhs); }
+		furud_inline static __m256 Div(__m256 lhs, __m256 rhs) noexcept { return _mm256_div_ps(lhs, rhs); }
+		furud_inline static __m256 MulAdd(__m256 lhs, __m256 mhs, __m256 rhs) noexcept { return _mm256_fmadd_ps(lhs, mhs, rhs); }
+		furud_inline static __m256 NegMulAdd(__m256 lhs, __m256 mhs, __m256 rhs) noexcept { return _mm256_fnmadd_ps(lhs, mhs, rhs); }
+		furud_inline static __m256 Min(__m256 lhs, __m256 rhs) noexcept { return _mm256_min_ps(lhs, rhs); }
+		furud_inline static __m256 Max(__m256 lhs, __m256 rhs) noexcept { return _mm256_max_ps(lhs, rhs); }
+		furud_inline static __m256 Round(__m256 value) noexcept { return _mm256_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+		furud_inline static __m256 And(__m256 lhs, __m256 rhs) noexcept { return _mm256_and_ps(lhs, rhs); }
+		furud_inline static __m256 AndNot(__m256 lhs, __m256 rhs) noexcept { return _mm256_andnot_ps(lhs, rhs); }
+		furud_inline static __m256 Or(__m256 lhs, __m256 rhs) noexcept { return _mm256_or_ps(lhs, rhs); }
+		furud_inline static __m256 Xor(__m256 lhs, __m256 rhs) noexcept { return _mm256_xor_ps(lhs, rhs); }
+		furud_inline static __m256 Select(__m256 mask, __m256 lhs, __m256 rhs) noexcept { return _mm256_blendv_ps(rhs, lhs, mask); }
+		furud_inline static int32_t MaskBits(__m256 mask) noexcept { return _mm256_movemask_ps(mask); }
+
+		furud_inline static __m256 Equal(__m256 lhs, __m256 rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ); }
+		furud_inline static __m256 Less(__m256 lhs, __m256 rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ); }
+		furud_inline static __m256 Greater(__m256 lhs, __m256 rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ); }
+		furud_inline static __m256 Unordered(__m256 lhs, __m256 rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_UNORD_Q); }
+
+		furud_inline static __m256i ToInteger(__m256 value) noexcept { return _mm256_cvtps_epi32(value); }
+		furud_inline static __m256 ToFloat(__m256i value) noexcept { return _mm256_cvtepi32_ps(value); }
+		furud_inline static __m256i AsInteger(__m256 value) noexcept { return _mm256_castps_si256(value); }
+		furud_inline static __m256 AsFloat(__m256i value) noexcept { return _mm256_castsi256_ps(value); }
+
+		furud_inline static __m256i SetInteger(int32_t value) noexcept { return _mm256_set1_epi32(value); }
+		furud_inline static __m256i AddInteger(__m256i lhs, __m256i rhs) noexcept { return _mm256_add_epi32(lhs, rhs); }
+		furud_inline static __m256i SubInteger(__m256i lhs, __m256i rhs) noexcept { return _mm256_sub_epi32(lhs, rhs); }
+		furud_inline static __m256i AndInteger(__m256i lhs, __m256i rhs) noexcept { return _mm256_and_si256(lhs, rhs); }
+		furud_inline static __m256i OrInteger(__m256i lhs, __m256i rhs) noexcept { return _mm256_or_si256(lhs, rhs); }
+		template <int32_t Count> furud_inline static __m256i ShiftLeft(__m256i value) noexcept { return _mm256_slli_epi32(value, Count); }
+		template <int32_t Count> furud_inline static __m256i ShiftRight(__m256i value) noexcept { return _mm256_srai_epi32(value, Count); }
+		template <int32_t Count> furud_inline static __m256i ShiftRightLogical(__m256i value) noexcept { return _mm256_srli_epi32(value, Count); }
+
+		furud_inline static void Store(float* data, __m256 value) noexcept { _mm256_storeu_ps(data, value); }
+		furud_inline static __m256 Load(const float* data) noexcept { return _mm256_loadu_ps(data); }
+	};
+
+
+	/**
+	 * @brief    Evaluates the polynomial c0 + c1 * x + c2 * x^2 + ... with Horner's method.
+	 */
+	template <typename TRegister, typename... TCoefficients>
+	furud_inline TRegister SimdPolynomial(TRegister x, float c0, TCoefficients... coefficients) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		if constexpr (sizeof...(TCoefficients) == 0)
+		{
+			return ISimd::Set(c0);
+		}
+		else
+		{
+			return ISimd::MulAdd(SimdPolynomial(x, coefficients...), x, ISimd::Set(c0));
+		}
+	}
+
+
+	/**
+	 * @brief    Multiplies by 2^n, with n in [-252, 254] so that subnormal results are still reachable.
+	 */
+	template <typename TRegister>
+	furud_inline TRegister SimdScaleByPowerOfTwo(TRegister value, typename TSimdFloat<TRegister>::TInteger n) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		const auto half = ISimd::template ShiftRight<1>(n);
+		const auto rest = ISimd::SubInteger(n, half);
+		const auto bias = ISimd::SetInteger(127);
+		value = ISimd::Mul(value, ISimd::AsFloat(ISimd::template ShiftLeft<23>(ISimd::AddInteger(half, bias))));
+		return ISimd::Mul(value, ISimd::AsFloat(ISimd::template ShiftLeft<23>(ISimd::AddInteger(rest, bias))));
+	}
+
+
+	/**
+	 * @brief    Recomputes the lanes selected by `mask` with the scalar function, for the rare inputs out of the kernel's range.
+	 */
+	template <typename TRegister, typename TFunction>
+	furud_noinline TRegister SimdScalarFallback(TRegister result, TRegister value, int32_t mask, TFunction&& function) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		float results[ISimd::NumLanes];
+		float values[ISimd::NumLanes];
+		ISimd::Store(results, result);
+		ISimd::Store(values, value);
+		for (int32_t index = 0; index < ISimd::NumLanes; ++index)
+		{
+			if (mask & (1 << index))
+			{
+				results[index] = function(values[index]);
+			}
+		}
+		return ISimd::Load(results);
+	}
+}
+
+
+
+/** Sine and cosine. */
+namespace Furud::Internal
+{
+	/** Cody-Waite split of pi/2, the high parts multiply by the quadrant index exactly with fma. */
+	constexpr float HalfPiHigh   = 1.57079637050628662109375f;
+	constexpr float HalfPiMiddle = -4.37113882867379289e-8f;
+	constexpr float HalfPiLow    = -1.71512451000588188e-15f;
+	constexpr float TwoOverPi    = 0.636619772367581343f;
+
+	/** Split of pi/2 without fma, the first three parts have at most 11 bits so that products by k < 2^13 are exact. */
+	constexpr float HalfPiShort1 = 1.5703125f;
+	constexpr float HalfPiShort2 = 4.837512969970703125e-4f;
+	constexpr float HalfPiShort3 = 7.54953362047672271728515625e-8f;
+	constexpr float HalfPiShort4 = 2.563344068257089603e-12f;
+
+	/** Beyond this magnitude the three-part reduction loses bits, the lanes fall back to the scalar library. */
+	constexpr float SinCosReductionLimit = 65536.f;
+	constexpr float SinCosShortReductionLimit = 8192.f;
+
+
+	/**
+	 * @brief    Computes sine and cosine of r in [-pi/4, pi/4], with minimax polynomials.
+	 */
+	template <typename TRegister, bool bPrecise>
+	furud_inline void SimdSinCosKernel(TRegister r, TRegister& outSin, TRegister& outCos) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		const TRegister z = ISimd::Mul(r, r);
+		if constexpr (bPrecise)
+		{
+			const TRegister s = SimdPolynomial(z, -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f);
+			const TRegister c = SimdPolynomial(z, 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f);
+			outSin = ISimd::MulAdd(ISimd::Mul(s, z), r, r);
+			outCos = ISimd::MulAdd(ISimd::Mul(c, z), z, ISimd::NegMulAdd(ISimd::Set(0.5f), z, ISimd::Set(1.f)));
+		}
+		else
+		{
+			const TRegister s = SimdPolynomial(z, -1.666339038e-1f, 8.163281924e-3f);
+			const TRegister c = SimdPolynomial(z, -4.999989478e-1f, 4.165629458e-2f, -1.359782312e-3f);
+			outSin = ISimd::MulAdd(ISimd::Mul(s, z), r, r);
+			outCos = ISimd::MulAdd(c, z, ISimd::Set(1.f));
+		}
+	}
+
+
+	/**
+	 * @brief    Reduces x to r in [-pi/4, pi/4] with x = r + k * pi/2.
+	 * @returns  The quadrant index k.
+	 */
+	template <typename TRegister, bool bPrecise>
+	furud_inline auto SimdReduceHalfPi(TRegister x, TRegister& outR) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		const TRegister k = ISimd::Round(ISimd::Mul(x, ISimd::Set(TwoOverPi)));
+		TRegister r;
+		if constexpr (ISimd::bFused)
+		{
+			r = ISimd::NegMulAdd(k, ISimd::Set(HalfPiHigh), x);
+			r = ISimd::NegMulAdd(k, ISimd::Set(HalfPiMiddle), r);
+			if constexpr (bPrecise)
+			{
+				r = ISimd::NegMulAdd(k, ISimd::Set(HalfPiLow), r);
+			}
+		}
+		else
+		{
+			r = ISimd::NegMulAdd(k, ISimd::Set(HalfPiShort1), x);
+			r = ISimd::NegMulAdd(k, ISimd::Set(HalfPiShort2), r);
+			r = ISimd::NegMulAdd(k, ISimd::Set(HalfPiShort3), r);
+			r = ISimd::NegMulAdd(k, ISimd::Set(HalfPiShort4), r);
+		}
+		outR = r;
+		return ISimd::ToInteger(k);
+	}
+
+
+	/**
+	 * @brief    Vectorized sine and cosine.
+	 *           Precise: max error 1.6 ulp over the full float range, lanes above 65536 use the scalar library.
+	 *           Without fma ( Vec4f ) the max error is 2.4 ulp, and lanes above 8192 use the scalar library.
+	 *           Fast: max absolute error 2e-6 for |x| <= 8192, no special handling of large inputs.
+	 * @details  正弦与余弦。
+	 */
+	template <typename TRegister, bool bPrecise>
+	furud_inline void SimdSinCos(TRegister x, TRegister& outSin, TRegister& outCos) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		const TRegister signBit = ISimd::Set(-0.f);
+		const TRegister ax = ISimd::AndNot(signBit, x);
+
+		TRegister r;
+		const auto k = SimdReduceHalfPi<TRegister, bPrecise>(ax, r);
+
+		TRegister s, c;
+		SimdSinCosKernel<TRegister, bPrecise>(r, s, c);
+
+		// Quadrant 1 and 3 swap sine and cosine, quadrant 2 and 3 negate sine, quadrant 1 and 2 negate cosine.
+		const TRegister swap = ISimd::AsFloat(ISimd::template ShiftLeft<31>(k));
+		const TRegister sinSign = ISimd::AsFloat(ISimd::template ShiftLeft<30>(ISimd::AndInteger(k, ISimd::SetInteger(2))));
+		const TRegister cosSign = ISimd::AsFloat(ISimd::template ShiftLeft<30>(ISimd::AndInteger(ISimd::AddInteger(k, ISimd::SetInteger(1)), ISimd::SetInteger(2))));
+
+		// Sine is odd, the sign of x is applied last so that sin(-0) = -0.
+		outSin = ISimd::Xor(ISimd::Xor(ISimd::Select(swap, c, s), sinSign), ISimd::And(x, signBit));
+		outCos = ISimd::Xor(ISimd::Select(swap, s, c), cosSign);
+
+		if constexpr (bPrecise)
+		{
+			const int32_t largeMask = ISimd::MaskBits(ISimd::Greater(ax, ISimd::Set(ISimd::bFused ? SinCosReductionLimit : SinCosShortReductionLimit)));
+			if (largeMask != 0) furud_unlikely
+			{
+				outSin = SimdScalarFallback(outSin, x, largeMask, [](float value) { return ::sinf(value); });
+				outCos = SimdScalarFallback(outCos, x, largeMask, [](float value) { return ::cosf(value); });
+			}
+		}
+	}
+
+
+	template <typename TRegister, bool bPrecise>
+	furud_inline TRegister SimdSin(TRegister x) noexcept
+	{
+		TRegister s, c;
+		SimdSinCos<TRegister, bPrecise>(x, s, c);
+		return s;
+	}
+
+
+	template <typename TRegister, bool bPrecise>
+	furud_inline TRegister SimdCos(TRegister x) noexcept
+	{
+		TRegister s, c;
+		SimdSinCos<TRegister, bPrecise>(x, s, c);
+		return c;
+	}
+}
+
+
+
+/** Exponential. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Vectorized 2^x.
+	 *           Precise: max error 1 ulp ( 1.3 ulp without fma ), overflows to +inf, underflows through subnormals to 0, NaN is preserved.
+	 *           Fast: max relative error 2e-7 for x in [-126, 127], out of range inputs are clamped.
+	 * @details  以 2 为底的指数。
+	 */
+	template <typename TRegister, bool bPrecise>
+	furud_inline TRegister SimdExp2(TRegister x) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+
+		// The comparison keeps NaN, the limits leave room for rounding up to +inf or down to 0.
+		x = ISimd::Max(ISimd::Set(bPrecise ? -151.f : -126.f), ISimd::Min(ISimd::Set(bPrecise ? 129.f : 127.f), x));
+
+		const TRegister n = ISimd::Round(x);
+		const TRegister r = ISimd::Sub(x, n);
+
+		TRegister y;
+		if constexpr (bPrecise)
+		{
+			y = SimdPolynomial(r, 6.931472028550421e-1f, 2.402264791363012e-1f, 5.550332471162809e-2f, 9.618437357674640e-3f, 1.339887440266574e-3f, 1.535336188319500e-4f);
+		}
+		else
+		{
+			y = SimdPolynomial(r, 6.931469776e-1f, 2.402224209e-1f, 5.550733743e-2f, 9.671512645e-3f, 1.326472712e-3f);
+		}
+		y = ISimd::MulAdd(y, r, ISimd::Set(1.f));
+		return SimdScaleByPowerOfTwo(y, ISimd::ToInteger(n));
+	}
+
+
+	/**
+	 * @brief    Vectorized e^x.
+	 *           Precise: max error 1.1 ulp, with a two-part ln(2) reduction.
+	 *           Fast: 2^(x * log2(e)), max relative error 2e-7 + |x| * 7.5e-8, the rounding of x * log2(e) grows with |x|.
+	 * @details  自然指数。
+	 */
+	template <typename TRegister, bool bPrecise>
+	furud_inline TRegister SimdExp(TRegister x) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		if constexpr (bPrecise)
+		{
+			x = ISimd::Max(ISimd::Set(-104.f), ISimd::Min(ISimd::Set(89.f), x));
+
+			const TRegister n = ISimd::Round(ISimd::Mul(x, ISimd::Set(1.44269504088896341f)));
+			TRegister r = ISimd::NegMulAdd(n, ISimd::Set(0.693359375f), x);
+			r = ISimd::NegMulAdd(n, ISimd::Set(-2.12194440e-4f), r);
+
+			const TRegister z = ISimd::Mul(r, r);
+			TRegister y = SimdPolynomial(r, 5.0000001201e-1f, 1.6666665459e-1f, 4.1665795894e-2f, 8.3334519073e-3f, 1.3981999507e-3f, 1.9875691500e-4f);
+			y = ISimd::Add(ISimd::MulAdd(y, z, r), ISimd::Set(1.f));
+			return SimdScaleByPowerOfTwo(y, ISimd::ToInteger(n));
+		}
+		else
+		{
+			return SimdExp2<TRegister, false>(ISimd::Mul(x, ISimd::Set(1.44269504088896341f)));
+		}
+	}
+}
+
+
+
+/** Logarithm. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Splits a positive x into m * 2^e with m in [sqrt(0.5), sqrt(2)), and returns m - 1.
+	 */
+	template <typename TRegister>
+	furud_inline TRegister SimdSplitMantissa(TRegister x, TRegister& outExponent) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+
+		// Subnormals are scaled into the normal range first.
+		const TRegister subnormal = ISimd::Less(x, ISimd::Set(1.17549435e-38f));
+		x = ISimd::Select(subnormal, ISimd::Mul(x, ISimd::Set(33554432.f)), x);
+		const TRegister bias = ISimd::Select(subnormal, ISimd::Set(151.f), ISimd::Set(126.f));
+
+		const auto bits = ISimd::AsInteger(x);
+		const TRegister exponent = ISimd::ToFloat(ISimd::template ShiftRightLogical<23>(bits));
+		const TRegister m = ISimd::AsFloat(ISimd::OrInteger(ISimd::AndInteger(bits, ISimd::SetInteger(0x007FFFFF)), ISimd::SetInteger(0x3F000000)));
+
+		// m is in [0.5, 1), the lower half is doubled to be centered at 1.
+		const TRegister lower = ISimd::Less(m, ISimd::Set(0.707106781186547524f));
+		outExponent = ISimd::Sub(ISimd::Sub(exponent, bias), ISimd::And(lower, ISimd::Set(1.f)));
+		return ISimd::Add(ISimd::Sub(m, ISimd::Set(1.f)), ISimd::And(lower, m));
+	}
+
+
+	/**
+	 * @brief    Applies the IEEE results of log(0), log(negative), log(+inf) and log(NaN).
+	 */
+	template <typename TRegister>
+	furud_inline TRegister SimdLogSpecialCases(TRegister x, TRegister result) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		const TRegister infinity = ISimd::Set(INFINITY);
+		result = ISimd::Select(ISimd::Equal(x, infinity), infinity, result);
+		result = ISimd::Select(ISimd::Equal(x, ISimd::Set(0.f)), ISimd::Set(-INFINITY), result);
+		return ISimd::Select(ISimd::Or(ISimd::Less(x, ISimd::Set(0.f)), ISimd::Unordered(x, x)), ISimd::Set(NAN), result);
+	}
+
+
+	/**
+	 * @brief    Vectorized base-2 logarithm.
+	 *           Precise: max error 1.2 ulp ( 1.5 ulp without fma ), log2(0) = -inf, log2(x < 0) = NaN.
+	 *           Fast: max relative error 4e-7 for normal positive x, other inputs are undefined.
+	 * @details  以 2 为底的对数。
+	 */
+	template <typename TRegister, bool bPrecise>
+	furud_inline TRegister SimdLog2(TRegister x) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		if constexpr (bPrecise)
+		{
+			TRegister exponent;
+			const TRegister t = SimdSplitMantissa(x, exponent);
+			const TRegister z = ISimd::Mul(t, t);
+
+			TRegister y = SimdPolynomial(t, 3.3333331174e-1f, -2.4999993993e-1f, 2.0000714765e-1f, -1.6668057665e-1f, 1.4249322787e-1f, -1.2420140846e-1f, 1.1676998740e-1f, -1.1514610310e-1f, 7.0376836292e-2f);
+			y = ISimd::Mul(ISimd::Mul(y, z), t);
+			y = ISimd::NegMulAdd(ISimd::Set(0.5f), z, y);
+
+			// log2(1 + t) = (t + y) * log2(e), with log2(e) - 1 split out to keep the low bits.
+			const TRegister log2eMinusOne = ISimd::Set(0.44269504088896340736f);
+			TRegister result = ISimd::Mul(y, log2eMinusOne);
+			result = ISimd::MulAdd(t, log2eMinusOne, result);
+			result = ISimd::Add(ISimd::Add(result, y), t);
+			result = ISimd::Add(result, exponent);
+			return SimdLogSpecialCases(x, result);
+		}
+		else
+		{
+			// m in [sqrt(0.5), sqrt(2)), log2(m) is odd in (m - 1) / (m + 1).
+			const auto bits = ISimd::AsInteger(x);
+			const auto offset = ISimd::SubInteger(bits, ISimd::SetInteger(0x3F3504F3));
+			const auto exponent = ISimd::template ShiftRight<23>(offset);
+			const TRegister m = ISimd::AsFloat(ISimd::SubInteger(bits, ISimd::template ShiftLeft<23>(exponent)));
+
+			const TRegister t = ISimd::Div(ISimd::Sub(m, ISimd::Set(1.f)), ISimd::Add(m, ISimd::Set(1.f)));
+			const TRegister y = SimdPolynomial(ISimd::Mul(t, t), 2.885390424e+0f, 9.615883152e-1f, 5.957816549e-1f);
+			return ISimd::MulAdd(y, t, ISimd::ToFloat(exponent));
+		}
+	}
+
+
+	/**
+	 * @brief    Vectorized natural logarithm.
+	 *           Precise: max error 1 ulp, log(0) = -inf, log(x < 0) = NaN.
+	 *           Fast: max relative error 4e-7 for normal positive x, other inputs are undefined.
+	 * @details  自然对数。
+	 */
+	template <typename TRegister, bool bPrecise>
+	furud_inline TRegister SimdLog(TRegister x) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		if constexpr (bPrecise)
+		{
+			TRegister exponent;
+			const TRegister t = SimdSplitMantissa(x, exponent);
+			const TRegister z = ISimd::Mul(t, t);
+
+			TRegister y = SimdPolynomial(t, 3.3333331174e-1f, -2.4999993993e-1f, 2.0000714765e-1f, -1.6668057665e-1f, 1.4249322787e-1f, -1.2420140846e-1f, 1.1676998740e-1f, -1.1514610310e-1f, 7.0376836292e-2f);
+			y = ISimd::Mul(ISimd::Mul(y, z), t);
+			y = ISimd::MulAdd(exponent, ISimd::Set(-2.12194440e-4f), y);
+			y = ISimd::NegMulAdd(ISimd::Set(0.5f), z, y);
+			const TRegister result = ISimd::MulAdd(exponent, ISimd::Set(0.693359375f), ISimd::Add(t, y));
+			return SimdLogSpecialCases(x, result);
+		}
+		else
+		{
+			return ISimd::Mul(SimdLog2<TRegister, false>(x), ISimd::Set(0.693147180559945309f));
+		}
+	}
+}
+
+
+
+/** Power. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Uniform lane operations over the 128-bit and 256-bit double registers, for the double precision power.
+	 * @details  SIMD 双精度寄存器的统一操作。
+	 */
+	template <typename TRegister>
+	struct TSimdDouble;
+
+
+	template <>
+	struct TSimdDouble<__m128d>
+	{
+		using TInteger = __m128i;
+
+		furud_inline static __m128d Set(double value) noexcept { return _mm_set1_pd(value); }
+		furud_inline static __m128d Add(__m128d lhs, __m128d rhs) noexcept { return _mm_add_pd(lhs, rhs); }
+		furud_inline static __m128d Sub(__m128d lhs, __m128d rhs) noexcept { return _mm_sub_pd(lhs, rhs); }
+		furud_inline static __m128d Mul(__m128d lhs, __m128d rhs) noexcept { return _mm_mul_pd(lhs, rhs); }
+		furud_inline static __m128d Div(__m128d lhs, __m128d rhs) noexcept { return _mm_div_pd(lhs, rhs); }
+		furud_inline static __m128d MulAdd(__m128d lhs, __m128d mhs, __m128d rhs) noexcept { return _mm_add_pd(_mm_mul_pd(lhs, mhs), rhs); }
+		furud_inline static __m128d Min(__m128d lhs, __m128d rhs) noexcept { return _mm_min_pd(lhs, rhs); }
+		furud_inline static __m128d Max(__m128d lhs, __m128d rhs) noexcept { return _mm_max_pd(lhs, rhs); }
+		furud_inline static __m128d Round(__m128d value) noexcept { return _mm_round_pd(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		furud_inline static __m128d And(__m128d lhs, __m128d rhs) noexcept { return _mm_and_pd(lhs, rhs); }
+		furud_inline static __m128d Select(__m128d mask, __m128d lhs, __m128d rhs) noexcept { return _mm_blendv_pd(rhs, lhs, mask); }
+		furud_inline static __m128d Equal(__m128d lhs, __m128d rhs) noexcept { return _mm_cmpeq_pd(lhs, rhs); }
+		furud_inline static __m128d Greater(__m128d lhs, __m128d rhs) noexcept { return _mm_cmpgt_pd(lhs, rhs); }
+		furud_inline static __m128d NotLess(__m128d lhs, __m128d rhs) noexcept { return _mm_cmpnlt_pd(lhs, rhs); }
+
+		furud_inline static __m128i AsInteger(__m128d value) noexcept { return _mm_castpd_si128(value); }
+		furud_inline static __m128d AsDouble(__m128i value) noexcept { return _mm_castsi128_pd(value); }
+		furud_inline static __m128i SetInteger(int64_t value) noexcept { return _mm_set1_epi64x(value); }
+		furud_inline static __m128i AddInteger(__m128i lhs, __m128i rhs) noexcept { return _mm_add_epi64(lhs, rhs); }
+		furud_inline static __m128i SubInteger(__m128i lhs, __m128i rhs) noexcept { return _mm_sub_epi64(lhs, rhs); }
+		furud_inline static __m128i AndInteger(__m128i lhs, __m128i rhs) noexcept { return _mm_and_si128(lhs, rhs); }
+		furud_inline static __m128i OrInteger(__m128i lhs, __m128i rhs) noexcept { return _mm_or_si128(lhs, rhs); }
+		template <int32_t Count> furud_inline static __m128i ShiftLeft(__m128i value) noexcept { return _mm_slli_epi64(value, Count); }
+		template <int32_t Count> furud_inline static __m128i ShiftRightLogical(__m128i value) noexcept { return _mm_srli_epi64(value, Count); }
+	};
+
+
+	template <>
+	struct TSimdDouble<__m256d>
+	{
+		using TInteger = __m256i;
+
+		furud_inline static __m256d Set(double value) noexcept { return _mm256_set1_pd(value); }
+		furud_inline static __m256d Add(__m256d lhs, __m256d rhs) noexcept { return _mm256_add_pd(lhs, rhs); }
+		furud_inline static __m256d Sub(__m256d lhs, __m256d rhs) noexcept { return _mm256_sub_pd(lhs, rhs); }
+		furud_inline static __m256d Mul(__m256d lhs, __m256d rhs) noexcept { return _mm256_mul_pd(lhs, rhs); }
+		furud_inline static __m256d Div(__m256d lhs, __m256d rhs) noexcept { return _mm256_div_pd(lhs, rhs); }
+		furud_inline static __m256d MulAdd(__m256d lhs, __m256d mhs, __m256d rhs) noexcept { return _mm256_fmadd_pd(lhs, mhs, rhs); }
+		furud_inline static __m256d Min(__m256d lhs, __m256d rhs) noexcept { return _mm256_min_pd(lhs, rhs); }
+		furud_inline static __m256d Max(__m256d lhs, __m256d rhs) noexcept { return _mm256_max_pd(lhs, rhs); }
+		furud_inline static __m256d Round(__m256d value) noexcept { return _mm256_round_pd(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		furud_inline static __m256d And(__m256d lhs, __m256d rhs) noexcept { return _mm256_and_pd(lhs, rhs); }
+		furud_inline static __m256d Select(__m256d mask, __m256d lhs, __m256d rhs) noexcept { return _mm256_blendv_pd(rhs, lhs, mask); }
+		furud_inline static __m256d Equal(__m256d lhs, __m256d rhs) noexcept { return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ); }
+		furud_inline static __m256d Greater(__m256d lhs, __m256d rhs) noexcept { return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ); }
+		furud_inline static __m256d NotLess(__m256d lhs, __m256d rhs) noexcept { return _mm256_cmp_pd(lhs, rhs, _CMP_NLT_UQ); }
+
+		furud_inline static __m256i AsInteger(__m256d value) noexcept { return _mm256_castpd_si256(value); }
+		furud_inline static __m256d AsDouble(__m256i value) noexcept { return _mm256_castsi256_pd(value); }
+		furud_inline static __m256i SetInteger(int64_t value) noexcept { return _mm256_set1_epi64x(value); }
+		furud_inline static __m256i AddInteger(__m256i lhs, __m256i rhs) noexcept { return _mm256_add_epi64(lhs, rhs); }
+		furud_inline static __m256i SubInteger(__m256i lhs, __m256i rhs) noexcept { return _mm256_sub_epi64(lhs, rhs); }
+		furud_inline static __m256i AndInteger(__m256i lhs, __m256i rhs) noexcept { return _mm256_and_si256(lhs, rhs); }
+		furud_inline static __m256i OrInteger(__m256i lhs, __m256i rhs) noexcept { return _mm256_or_si256(lhs, rhs); }
+		template <int32_t Count> furud_inline static __m256i ShiftLeft(__m256i value) noexcept { return _mm256_slli_epi64(value, Count); }
+		template <int32_t Count> furud_inline static __m256i ShiftRightLogical(__m256i value) noexcept { return _mm256_srli_epi64(value, Count); }
+	};
+
+
+	/**
+	 * @brief    Computes 2^(y * log2(x)) for x >= 0 in double precision, so that the product keeps enough bits.
+	 *           The error of the double result is below 2^-40, the float rounding dominates.
+	 */
+	template <typename TRegister>
+	furud_inline TRegister SimdPowPositive(TRegister x, TRegister y) noexcept
+	{
+		using ISimd = TSimdDouble<TRegister>;
+		const auto bits = ISimd::AsInteger(x);
+
+		// x = m * 2^e, with m in [sqrt(0.5), sqrt(2)).
+		const auto exponentBits = ISimd::template ShiftRightLogical<52>(bits);
+		TRegister exponent = ISimd::Sub(ISimd::AsDouble(ISimd::OrInteger(exponentBits, ISimd::SetInteger(0x4330000000000000))), ISimd::Set(4503599627370496.0 + 1023.0));
+		TRegister m = ISimd::AsDouble(ISimd::OrInteger(ISimd::AndInteger(bits, ISimd::SetInteger(0x000FFFFFFFFFFFFF)), ISimd::SetInteger(0x3FF0000000000000)));
+		const TRegister upper = ISimd::Greater(m, ISimd::Set(1.41421356237309505));
+		m = ISimd::Select(upper, ISimd::Mul(m, ISimd::Set(0.5)), m);
+		exponent = ISimd::Add(exponent, ISimd::And(upper, ISimd::Set(1.0)));
+
+		// ln(m) = 2 * atanh(t), t = (m - 1) / (m + 1), |t| <= 0.1716.
+		const TRegister t = ISimd::Div(ISimd::Sub(m, ISimd::Set(1.0)), ISimd::Add(m, ISimd::Set(1.0)));
+		const TRegister t2 = ISimd::Mul(t, t);
+		TRegister series = ISimd::Set(1.0 / 17.0);
+		series = ISimd::MulAdd(series, t2, ISimd::Set(1.0 / 15.0));
+		series = ISimd::MulAdd(series, t2, ISimd::Set(1.0 / 13.0));
+		series = ISimd::MulAdd(series, t2, ISimd::Set(1.0 / 11.0));
+		series = ISimd::MulAdd(series, t2, ISimd::Set(1.0 / 9.0));
+		series = ISimd::MulAdd(series, t2, ISimd::Set(1.0 / 7.0));
+		series = ISimd::MulAdd(series, t2, ISimd::Set(1.0 / 5.0));
+		series = ISimd::MulAdd(series, t2, ISimd::Set(1.0 / 3.0));
+		series = ISimd::MulAdd(series, t2, ISimd::Set(1.0));
+		TRegister log2x = ISimd::MulAdd(ISimd::Mul(series, t), ISimd::Set(2.0 * 1.44269504088896341), exponent);
+
+		// log2(0) = -inf, log2(+inf) = +inf, log2(NaN) = NaN.
+		log2x = ISimd::Select(ISimd::Equal(x, ISimd::Set(0.0)), ISimd::Set(-INFINITY), log2x);
+		log2x = ISimd::Select(ISimd::NotLess(x, ISimd::Set(INFINITY)), x, log2x);
+
+		// 2^p, p = n + f with f in [-0.5, 0.5], the limits already round to 0 or +inf in float.
+		TRegister p = ISimd::Mul(y, log2x);
+		p = ISimd::Max(ISimd::Set(-200.0), ISimd::Min(ISimd::Set(200.0), p));
+		const TRegister n = ISimd::Round(p);
+		const TRegister f = ISimd::Mul(ISimd::Sub(p, n), ISimd::Set(0.693147180559945309));
+
+		TRegister e = ISimd::Set(1.0 / 3628800.0);
+		e = ISimd::MulAdd(e, f, ISimd::Set(1.0 / 362880.0));
+		e = ISimd::MulAdd(e, f, ISimd::Set(1.0 / 40320.0));
+		e = ISimd::MulAdd(e, f, ISimd::Set(1.0 / 5040.0));
+		e = ISimd::MulAdd(e, f, ISimd::Set(1.0 / 720.0));
+		e = ISimd::MulAdd(e, f, ISimd::Set(1.0 / 120.0));
+		e = ISimd::MulAdd(e, f, ISimd::Set(1.0 / 24.0));
+		e = ISimd::MulAdd(e, f, ISimd::Set(1.0 / 6.0));
+		e = ISimd::MulAdd(e, f, ISimd::Set(0.5));
+		e = ISimd::MulAdd(e, f, ISimd::Set(1.0));
+		e = ISimd::MulAdd(e, f, ISimd::Set(1.0));
+
+		// The integer of n is read from the mantissa after adding 1.5 * 2^52.
+		const auto integer = ISimd::SubInteger(ISimd::AsInteger(ISimd::Add(n, ISimd::Set(6755399441055744.0))), ISimd::AsInteger(ISimd::Set(6755399441055744.0)));
+		const TRegister scale = ISimd::AsDouble(ISimd::template ShiftLeft<52>(ISimd::AddInteger(integer, ISimd::SetInteger(1023))));
+		return ISimd::Mul(e, scale);
+	}
+
+
+	/** Two halves of double lanes with SSE, Vec4f does not depend on AVX. */
+	furud_inline __m128 SimdPowPositive(__m128 x, __m128 y) noexcept
+	{
+		const __m128d low = SimdPowPositive(_mm_cvtps_pd(x), _mm_cvtps_pd(y));
+		const __m128d high = SimdPowPositive(_mm_cvtps_pd(_mm_movehl_ps(x, x)), _mm_cvtps_pd(_mm_movehl_ps(y, y)));
+		return _mm_movelh_ps(_mm_cvtpd_ps(low), _mm_cvtpd_ps(high));
+	}
+
+
+	furud_inline __m256 SimdPowPositive(__m256 x, __m256 y) noexcept
+	{
+		const __m256d low = SimdPowPositive(_mm256_cvtps_pd(_mm256_castps256_ps128(x)), _mm256_cvtps_pd(_mm256_castps256_ps128(y)));
+		const __m256d high = SimdPowPositive(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)), _mm256_cvtps_pd(_mm256_extractf128_ps(y, 1)));
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(low)), _mm256_cvtpd_ps(high), 1);
+	}
+
+
+	/**
+	 * @brief    Vectorized x^y.
+	 *           Precise: max error 1 ulp, evaluated in double precision, with the IEEE special cases of `pow`
+	 *           (negative x with integral y, zeros, infinities, pow(x, 0) = 1, pow(1, y) = 1).
+	 *           Fast: 2^(y * log2(x)) in single precision for positive normal x, max relative error 4e-7 * max(1, |y * log2(x)|).
+	 * @details  幂运算。
+	 */
+	template <typename TRegister, bool bPrecise>
+	furud_inline TRegister SimdPow(TRegister x, TRegister y) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		if constexpr (bPrecise)
+		{
+			const TRegister signBit = ISimd::Set(-0.f);
+			const TRegister one = ISimd::Set(1.f);
+			const TRegister ax = ISimd::AndNot(signBit, x);
+			const TRegister ay = ISimd::AndNot(signBit, y);
+
+			TRegister result = SimdPowPositive(ax, y);
+
+			// Negative base: odd integral exponents flip the sign, non-integral exponents give NaN.
+			const TRegister negative = ISimd::And(x, signBit);
+			const TRegister integral = ISimd::Equal(ISimd::Round(y), y);
+			const TRegister small = ISimd::Less(ay, ISimd::Set(16777216.f));
+			const TRegister odd = ISimd::And(ISimd::And(small, integral), ISimd::AsFloat(ISimd::template ShiftLeft<31>(ISimd::ToInteger(ISimd::And(small, y)))));
+			result = ISimd::Xor(result, ISimd::And(negative, odd));
+
+			const TRegister negativeFinite = ISimd::And(ISimd::Less(x, ISimd::Set(0.f)), ISimd::Less(ax, ISimd::Set(INFINITY)));
+			result = ISimd::Select(ISimd::AndNot(integral, negativeFinite), ISimd::Set(NAN), result);
+
+			// pow(x, 0) = 1, pow(1, y) = 1, pow(-1, +-inf) = 1, even for NaN.
+			const TRegister unit = ISimd::Or(ISimd::Or(ISimd::Equal(y, ISimd::Set(0.f)), ISimd::Equal(x, one)), ISimd::And(ISimd::Equal(ax, one), ISimd::Equal(ay, ISimd::Set(INFINITY))));
+			return ISimd::Select(unit, one, result);
+		}
+		else
+		{
+			return SimdExp2<TRegister, false>(ISimd::Mul(y, SimdLog2<TRegister, false>(x)));
+		}
+	}
+}
+
+
+
+/** Inverse tangent. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Vectorized atan2(y, x), in [-pi, pi].
+	 *           Precise: max error 2.5 ulp, with the IEEE results for zeros and infinities.
+	 *           Fast: max absolute error 2e-6, atan2(0, 0) and infinite inputs are undefined.
+	 * @details  反正切。
+	 */
+	template <typename TRegister, bool bPrecise>
+	furud_inline TRegister SimdAtan2(TRegister y, TRegister x) noexcept
+	{
+		using ISimd = TSimdFloat<TRegister>;
+		const TRegister signBit = ISimd::Set(-0.f);
+		const TRegister ax = ISimd::AndNot(signBit, x);
+		const TRegister ay = ISimd::AndNot(signBit, y);
+
+		// atan of a in [0, 1], then mirrored by the octant.
+		const TRegister numerator = ISimd::Min(ax, ay);
+		const TRegister denominator = ISimd::Max(ax, ay);
+		TRegister a = ISimd::Div(numerator, denominator);
+
+		TRegister result;
+		if constexpr (bPrecise)
+		{
+			const TRegister infinity = ISimd::Set(INFINITY);
+			a = ISimd::Select(ISimd::Equal(denominator, ISimd::Set(0.f)), ISimd::Set(0.f), a);
+			a = ISimd::Select(ISimd::Equal(numerator, infinity), ISimd::Set(1.f), a);
+
+			// Above tan(pi/8), atan(a) = pi/4 + atan((a - 1) / (a + 1)), taken from the operands to round once,
+			// unless their sum would overflow.
+			const TRegister upper = ISimd::Greater(a, ISimd::Set(0.414213562373095049f));
+			const TRegister huge = ISimd::Greater(denominator, ISimd::Set(1e38f));
+			const TRegister shifted = ISimd::Select(huge,
+				ISimd::Div(ISimd::Sub(a, ISimd::Set(1.f)), ISimd::Add(a, ISimd::Set(1.f))),
+				ISimd::Div(ISimd::Sub(numerator, denominator), ISimd::Add(numerator, denominator)));
+			const TRegister t = ISimd::Select(upper, shifted, a);
+			const TRegister z = ISimd::Mul(t, t);
+			const TRegister p = SimdPolynomial(z, -3.33329491539e-1f, 1.99777106478e-1f, -1.38776856032e-1f, 8.05374449538e-2f);
+			result = ISimd::MulAdd(ISimd::Mul(p, z), t, t);
+			result = ISimd::Add(ISimd::Add(result, ISimd::And(upper, ISimd::Set(-2.18556941e-8f))), ISimd::And(upper, ISimd::Set(0.785398185253143311f)));
+		}
+		else
+		{
+			const TRegister p = SimdPolynomial(ISimd::Mul(a, a), 9.999772191e-1f, -3.326228280e-1f, 1.935403761e-1f, -1.164264813e-1f, 5.264735032e-2f, -1.171913519e-2f);
+			result = ISimd::Mul(p, a);
+		}
+
+		// pi/2 - r and pi - r, with the constants split in two parts.
+		result = ISimd::Select(ISimd::Greater(ay, ax), ISimd::Add(ISimd::Sub(ISimd::Set(-4.37113882867379289e-8f), result), ISimd::Set(1.57079637050628662f)), result);
+		result = ISimd::Select(ISimd::And(x, signBit), ISimd::Add(ISimd::Sub(ISimd::Set(-8.74227765734758578e-8f), result), ISimd::Set(3.14159274101257324f)), result);
+		result = ISimd::Or(result, ISimd::And(y, signBit));
+
+		if constexpr (bPrecise)
+		{
+			result = ISimd::Select(ISimd::Unordered(x, y), ISimd::Add(x, y), result);
+		}
+		return result;
+	}
+}
+
+
+
+/** Integer division. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Divides 32-bit integers with truncation, through double precision which holds every quotient exactly.
+	 *           Division by zero and INT32_MIN / -1 give INT32_MIN.
+	 * @details  32 位整数除法。
+	 */
+	furud_inline __m128i SimdDivide(__m128i lhs, __m128i rhs) noexcept
+	{
+		const __m128i low = _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(lhs), _mm_cvtepi32_pd(rhs)));
+		const __m128i high = _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(lhs, _MM_SHUFFLE(1, 0, 3, 2))), _mm_cvtepi32_pd(_mm_shuffle_epi32(rhs, _MM_SHUFFLE(1, 0, 3, 2)))));
+		return _mm_unpacklo_epi64(low, high);
+	}
+}
@@ -0,0 +1,770 @@
+//
+// Platform.SIMD-Vec16.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Vectorized 16 number structure.
+//
+module;
+
+#include <Furud.hpp>
+#include <stdint.h>
+#include <bit>
+
+// The portable backend has no 512-bit registers, this partition is empty there.
+#if !FURUD_SIMD_PORTABLE
+#include <immintrin.h>
+#endif
+
+// Every member below is AVX-512 code. gcc/clang only inline it into callers compiled for the same target,
+// e.g. a TSimdDispatch kernel declared with furud_target("avx512f,avx512dq,avx512bw,avx512vl,avx2,fma").
+#if FURUD_OS_LINUX && !FURUD_SIMD_PORTABLE && !defined(__AVX512F__)
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512dq,avx512bw,avx512vl,avx2,fma")
+#define FURUD_VEC16_TARGET_PUSHED 1
+#endif
+
+
+
+export module Furud.Platform.SIMD:Vec16;
+
+import :Vec8;
+
+
+
+#if !FURUD_SIMD_PORTABLE
+namespace Furud::Internal
+{
+#if FURUD_OS_WIN
+	// msvc registers are unions, the lanes are written one by one like Construct4f/Construct8f.
+	consteval __m512i Construct16i(uint32_t x)
+	{
+		__m512i result;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			result.m512i_u32[i] = x;
+		}
+		return result;
+	}
+
+	consteval __m512 Construct16f(uint32_t x)
+	{
+		__m512 result;
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			result.m512_f32[i] = std::bit_cast<float>(x);
+		}
+		return result;
+	}
+#else
+	struct alignas(64) Lanes16
+	{
+		uint32_t values[16];
+	};
+
+	consteval __m512i Construct16i(uint32_t x)
+	{
+		Lanes16 lanes{};
+		for (uint32_t& value : lanes.values)
+		{
+			value = x;
+		}
+		return std::bit_cast<__m512i>(lanes);
+	}
+
+	consteval __m512 Construct16f(uint32_t x)
+	{
+		Lanes16 lanes{};
+		for (uint32_t& value : lanes.values)
+		{
+			value = x;
+		}
+		return std::bit_cast<__m512>(lanes);
+	}
+#endif
+}
+
+
+
+/** Forward declaration. */
+export namespace Furud
+{
+	class Mask16;
+	furud_inline extern Mask16 furud_vectorapi And(const Mask16& lhs, const Mask16& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi AndNot(const Mask16& lhs, const Mask16& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi Or(const Mask16& lhs, const Mask16& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi Xor(const Mask16& lhs, const Mask16& rhs) noexcept;
+
+
+	class Vec16i;
+	furud_inline extern Mask16 furud_vectorapi Equal(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi NotEqual(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi GreaterThan(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi LessThan(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi GreaterThanOrEqual(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi LessThanOrEqual(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi operator + (const __m512i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi operator - (const __m512i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi operator * (const __m512i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi operator + (const int32_t& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi operator - (const int32_t& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi operator * (const int32_t& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi Min(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi Max(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi And(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi AndNot(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi Or(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi Xor(const Vec16i& lhs, const Vec16i& rhs) noexcept;
+	furud_inline extern Vec16i furud_vectorapi Select(const Mask16& mask, const Vec16i& lhs, const Vec16i& rhs) noexcept;
+
+
+	class Vec16f;
+	furud_inline extern Mask16 furud_vectorapi Equal(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi NotEqual(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi GreaterThan(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi LessThan(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi GreaterThanOrEqual(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Mask16 furud_vectorapi LessThanOrEqual(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi operator + (const __m512& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi operator - (const __m512& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi operator * (const __m512& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi operator / (const __m512& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi Min(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi Max(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi MulAdd(const Vec16f& lhs, const Vec16f& mhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi And(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi AndNot(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi Or(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi Xor(const Vec16f& lhs, const Vec16f& rhs) noexcept;
+	furud_inline extern Vec16f furud_vectorapi Copysign(const Vec16f& value, const Vec16f& sign) noexcept;
+	furud_inline extern Vec16f furud_vectorapi Select(const Mask16& mask, const Vec16f& lhs, const Vec16f& rhs) noexcept;
+}
+
+
+
+/** 16-lane predicate. */
+export namespace Furud
+{
+	/**
+	 * @brief    16-lane predicate held in an AVX-512 mask register, one bit per lane.
+	 * @details  十六通道掩码。
+	 */
+	class Mask16 final
+	{
+	private:
+		__mmask16 k;
+
+
+	public:
+		constexpr Mask16() noexcept : k(0) {}
+		constexpr Mask16(const __mmask16& value) noexcept : k(value) {}
+
+		furud_inline operator __mmask16() const noexcept { return k; }
+
+
+	public:
+		/**
+		 * @brief    Creates a mask with the first `count` lanes set, used for loop tails.
+		 * @return   Bit i = ( i < count ), count is clamped to 16.
+		 * @details  前 count 个通道的掩码。
+		 */
+		furud_inline static Mask16 FirstN(const size_t& count) noexcept
+		{
+			return static_cast<__mmask16>(count >= 16 ? 0xffffu : (1u << count) - 1u);
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Tests the lanes.
+		// @details  通道测试。
+		//****************************************************************
+
+		furud_inline int32_t MaskBits() const noexcept { return static_cast<int32_t>(k); }
+		furud_inline bool Any() const noexcept { return k != 0; }
+		furud_inline bool All() const noexcept { return k == 0xffffu; }
+		furud_inline bool None() const noexcept { return k == 0; }
+		furud_inline int32_t Count() const noexcept { return std::popcount(static_cast<uint32_t>(k)); }
+
+
+	public:
+		//****************************************************************
+		// @brief    Combines two Mask16 using bitwise logic operation.
+		// @return   Mask16( lhs opr rhs )
+		// @details  逻辑运算。
+		//****************************************************************
+
+		furud_inline Mask16 furud_vectorapi operator ~ () const noexcept { return _knot_mask16(k); }
+
+		furud_inline friend Mask16 furud_vectorapi And(const Mask16& lhs, const Mask16& rhs) noexcept { return _kand_mask16(lhs.k, rhs.k); }
+		furud_inline friend Mask16 furud_vectorapi AndNot(const Mask16& lhs, const Mask16& rhs) noexcept { return _kandn_mask16(lhs.k, rhs.k); }
+		furud_inline friend Mask16 furud_vectorapi Or(const Mask16& lhs, const Mask16& rhs) noexcept { return _kor_mask16(lhs.k, rhs.k); }
+		furud_inline friend Mask16 furud_vectorapi Xor(const Mask16& lhs, const Mask16& rhs) noexcept { return _kxor_mask16(lhs.k, rhs.k); }
+	};
+}
+
+
+
+/** 16D 32-bit integer vector. */
+export namespace Furud
+{
+	/**
+	 * @brief    16D 32-bit integer vector.
+	 * @details  SIMD 十六维整型向量。Requires AVX-512 F/DQ/BW/VL, check GetSimdLevel() before use.
+	 */
+	class Vec16i final
+	{
+	private:
+		__m512i reg;
+
+
+	public:
+		static constexpr __m512i SIGN_BIT  { Internal::Construct16i(0x80000000u) };
+		static constexpr __m512i SIGN_MASK { Internal::Construct16i(0x7fffffffu) };
+
+
+	public:
+		constexpr Vec16i() noexcept {}
+		constexpr Vec16i(__m512i&& value) noexcept : reg(std::move(value)) {}
+		constexpr Vec16i(const __m512i& value) noexcept : reg(value) {}
+
+
+	public:
+		furud_inline Vec16i(const int32_t& value) noexcept
+			: reg(_mm512_set1_epi32(value))
+		{}
+
+		furud_inline operator __m512i() noexcept { return reg; }
+
+		furud_inline operator const __m512i() const noexcept { return reg; }
+
+		Vec16i* operator & () = delete;
+
+		const Vec16i* operator & () const = delete;
+
+
+	public:
+		//****************************************************************
+		// @brief    Loads/Stores a Vec16i from/to 64-byte aligned memory.
+		//           The masked versions only touch the lanes set in `mask`,
+		//           they neither fault nor write past the end of a loop tail.
+		// @details  加载/存储向量。
+		//****************************************************************
+
+		furud_inline Vec16i& Load(const void* data) noexcept
+		{
+			reg = _mm512_load_si512(data);
+			return *this;
+		}
+
+		furud_inline void Store(void* data) const noexcept
+		{
+			_mm512_store_si512(data, reg);
+		}
+
+		furud_inline Vec16i& LoadMasked(const void* data, const Mask16& mask) noexcept
+		{
+			reg = _mm512_maskz_loadu_epi32(mask, data);
+			return *this;
+		}
+
+		furud_inline void StoreMasked(void* data, const Mask16& mask) const noexcept
+		{
+			_mm512_mask_storeu_epi32(data, mask, reg);
+		}
+
+
+	public:
+		/**
+		 * @brief    Converts Vec16i (signed 32-bit integer) to Vec16f (float).
+		 * @return   ( (float)reg.x0, same for the others )
+		 * @details  整数转浮点数。
+		 */
+		furud_inline Vec16f furud_vectorapi ToFloat() const noexcept;
+
+
+	public:
+		//****************************************************************
+		// @brief    Creates a 16-lane mask through elements comparison from each Vec16i.
+		// @return   Mask16( bit i = lhs[i] opr rhs[i] )
+		// @details  比较运算。
+		//****************************************************************
+
+		furud_inline friend Mask16 furud_vectorapi Equal(const Vec16i& lhs, const Vec16i& rhs) noexcept
+		{
+			return _mm512_cmp_epi32_mask(lhs.reg, rhs.reg, _MM_CMPINT_EQ);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi NotEqual(const Vec16i& lhs, const Vec16i& rhs) noexcept
+		{
+			return _mm512_cmp_epi32_mask(lhs.reg, rhs.reg, _MM_CMPINT_NE);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi GreaterThan(const Vec16i& lhs, const Vec16i& rhs) noexcept
+		{
+			return _mm512_cmp_epi32_mask(lhs.reg, rhs.reg, _MM_CMPINT_NLE);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi LessThan(const Vec16i& lhs, const Vec16i& rhs) noexcept
+		{
+			return _mm512_cmp_epi32_mask(lhs.reg, rhs.reg, _MM_CMPINT_LT);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi GreaterThanOrEqual(const Vec16i& lhs, const Vec16i& rhs) noexcept
+		{
+			return _mm512_cmp_epi32_mask(lhs.reg, rhs.reg, _MM_CMPINT_NLT);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi LessThanOrEqual(const Vec16i& lhs, const Vec16i& rhs) noexcept
+		{
+			return _mm512_cmp_epi32_mask(lhs.reg, rhs.reg, _MM_CMPINT_LE);
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Basic numerical operations.
+		// @return   Vec16i( x opr rhs.x, same for the others )
+		// @details  加减乘。
+		//****************************************************************
+
+		furud_inline Vec16i furud_vectorapi operator - () const noexcept { return _mm512_sub_epi32(_mm512_setzero_si512(), reg); }
+
+		furud_inline Vec16i furud_vectorapi operator + (const Vec16i& rhs) const noexcept { return _mm512_add_epi32(reg, rhs.reg); }
+		furud_inline Vec16i furud_vectorapi operator - (const Vec16i& rhs) const noexcept { return _mm512_sub_epi32(reg, rhs.reg); }
+		furud_inline Vec16i furud_vectorapi operator * (const Vec16i& rhs) const noexcept { return _mm512_mullo_epi32(reg, rhs.reg); }
+
+		furud_inline Vec16i furud_vectorapi operator + (const __m512i& rhs) const noexcept { return _mm512_add_epi32(reg, rhs); }
+		furud_inline Vec16i furud_vectorapi operator - (const __m512i& rhs) const noexcept { return _mm512_sub_epi32(reg, rhs); }
+		furud_inline Vec16i furud_vectorapi operator * (const __m512i& rhs) const noexcept { return _mm512_mullo_epi32(reg, rhs); }
+
+		furud_inline friend Vec16i furud_vectorapi operator + (const __m512i& lhs, const Vec16i& rhs) noexcept { return _mm512_add_epi32(lhs, rhs.reg); }
+		furud_inline friend Vec16i furud_vectorapi operator - (const __m512i& lhs, const Vec16i& rhs) noexcept { return _mm512_sub_epi32(lhs, rhs.reg); }
+		furud_inline friend Vec16i furud_vectorapi operator * (const __m512i& lhs, const Vec16i& rhs) noexcept { return _mm512_mullo_epi32(lhs, rhs.reg); }
+
+		furud_inline const Vec16i& operator += (const Vec16i& rhs) noexcept { reg = _mm512_add_epi32(reg, rhs.reg); return *this; }
+		furud_inline const Vec16i& operator -= (const Vec16i& rhs) noexcept { reg = _mm512_sub_epi32(reg, rhs.reg); return *this; }
+		furud_inline const Vec16i& operator *= (const Vec16i& rhs) noexcept { reg = _mm512_mullo_epi32(reg, rhs.reg); return *this; }
+
+
+	public:
+		//****************************************************************
+		// @brief    Basic numerical operations.
+		// @return   Vec16i( x opr rhs, same for the others )
+		// @details  加减乘。
+		//****************************************************************
+
+		furud_inline Vec16i furud_vectorapi operator + (const int32_t& rhs) const noexcept { return _mm512_add_epi32(reg, _mm512_set1_epi32(rhs)); }
+		furud_inline Vec16i furud_vectorapi operator - (const int32_t& rhs) const noexcept { return _mm512_sub_epi32(reg, _mm512_set1_epi32(rhs)); }
+		furud_inline Vec16i furud_vectorapi operator * (const int32_t& rhs) const noexcept { return _mm512_mullo_epi32(reg, _mm512_set1_epi32(rhs)); }
+
+		furud_inline friend Vec16i furud_vectorapi operator + (const int32_t& lhs, const Vec16i& rhs) noexcept { return _mm512_add_epi32(_mm512_set1_epi32(lhs), rhs.reg); }
+		furud_inline friend Vec16i furud_vectorapi operator - (const int32_t& lhs, const Vec16i& rhs) noexcept { return _mm512_sub_epi32(_mm512_set1_epi32(lhs), rhs.reg); }
+		furud_inline friend Vec16i furud_vectorapi operator * (const int32_t& lhs, const Vec16i& rhs) noexcept { return _mm512_mullo_epi32(_mm512_set1_epi32(lhs), rhs.reg); }
+
+		furud_inline const Vec16i& operator += (const int32_t& rhs) noexcept { reg = _mm512_add_epi32(reg, _mm512_set1_epi32(rhs));   return *this; }
+		furud_inline const Vec16i& operator -= (const int32_t& rhs) noexcept { reg = _mm512_sub_epi32(reg, _mm512_set1_epi32(rhs));   return *this; }
+		furud_inline const Vec16i& operator *= (const int32_t& rhs) noexcept { reg = _mm512_mullo_epi32(reg, _mm512_set1_epi32(rhs)); return *this; }
+
+
+	public:
+		//****************************************************************
+		// @brief    Returns the minimum/maximum values of two Vec16i.
+		// @return   Vec16i( min( lhs.x, rhs.x )/max( lhs.x, rhs.x ), same for the others )
+		// @details  最大/最小值。
+		//****************************************************************
+
+		furud_inline friend Vec16i furud_vectorapi Min(const Vec16i& lhs, const Vec16i& rhs) noexcept { return _mm512_min_epi32(lhs.reg, rhs.reg); }
+		furud_inline friend Vec16i furud_vectorapi Max(const Vec16i& lhs, const Vec16i& rhs) noexcept { return _mm512_max_epi32(lhs.reg, rhs.reg); }
+
+
+	public:
+		/**
+		 * @brief    Returns the absolute Vec16i.
+		 * @return   Vec16i( abs(reg.x), same for the others )
+		 * @details  绝对值。
+		 */
+		furud_inline Vec16i furud_vectorapi Abs() const noexcept { return _mm512_abs_epi32(reg); }
+
+
+	public:
+		//****************************************************************
+		// @brief    Combines two Vec16i using bitwise logic operation.
+		// @return   Vec16i( reg.x opr rhs.x, same for the others )
+		// @details  按位逻辑运算。
+		//****************************************************************
+
+		furud_inline friend Vec16i furud_vectorapi And(const Vec16i& lhs, const Vec16i& rhs) noexcept { return _mm512_and_si512(lhs.reg, rhs.reg); }
+		furud_inline friend Vec16i furud_vectorapi AndNot(const Vec16i& lhs, const Vec16i& rhs) noexcept { return _mm512_andnot_si512(lhs.reg, rhs.reg); }
+		furud_inline friend Vec16i furud_vectorapi Or(const Vec16i& lhs, const Vec16i& rhs) noexcept { return _mm512_or_si512(lhs.reg, rhs.reg); }
+		furud_inline friend Vec16i furud_vectorapi Xor(const Vec16i& lhs, const Vec16i& rhs) noexcept { return _mm512_xor_si512(lhs.reg, rhs.reg); }
+
+
+	public:
+		/**
+		 * @brief    Returns an integer bit-mask (0x0000 - 0xffff) based on the sign-bit for each elements in a Vec16i.
+		 * @return   Bit i = sign(reg[i])
+		 * @details  掩码。
+		 */
+		furud_inline int32_t MaskBits() const noexcept { return static_cast<int32_t>(_mm512_movepi32_mask(reg)); }
+
+		/**
+		 * @brief    Picks each lane from `lhs` where the mask bit is set, otherwise from `rhs`.
+		 * @return   Vec16i( mask[i] ? lhs[i] : rhs[i] )
+		 * @details  按掩码选择。
+		 */
+		furud_inline friend Vec16i furud_vectorapi Select(const Mask16& mask, const Vec16i& lhs, const Vec16i& rhs) noexcept
+		{
+			return _mm512_mask_blend_epi32(mask, rhs.reg, lhs.reg);
+		}
+	};
+}
+
+
+
+/** 16D 32-bit single floating-point vector. */
+export namespace Furud
+{
+	/**
+	 * @brief    16D 32-bit single floating-point vector.
+	 * @details  SIMD 十六维单精度浮点向量。Requires AVX-512 F/DQ/BW/VL, check GetSimdLevel() before use.
+	 */
+	class Vec16f final
+	{
+	private:
+		__m512 reg;
+
+
+	public:
+		static constexpr __m512 SIGN_BIT   { Internal::Construct16f(0x80000000u) };
+		static constexpr __m512 SIGN_MASK  { Internal::Construct16f(0x7fffffffu) };
+
+
+	public:
+		constexpr Vec16f() noexcept {}
+		constexpr Vec16f(__m512&& value) noexcept : reg(std::move(value)) {}
+		constexpr Vec16f(const __m512& value) noexcept : reg(value) {}
+
+
+	public:
+		furud_inline Vec16f(const float& value) noexcept
+			: reg(_mm512_set1_ps(value))
+		{}
+
+		furud_inline Vec16f(const Vec8f& lo, const Vec8f& hi) noexcept
+			: reg(_mm512_insertf32x8(_mm512_castps256_ps512(lo), hi, 1))
+		{}
+
+		furud_inline operator __m512() noexcept { return reg; }
+
+		furud_inline operator const __m512() const noexcept { return reg; }
+
+		Vec16f* operator & () = delete;
+
+		const Vec16f* operator & () const = delete;
+
+
+	public:
+		//****************************************************************
+		// @brief    Loads/Stores a Vec16f from/to 64-byte aligned memory.
+		//           The masked versions only touch the lanes set in `mask`,
+		//           they neither fault nor write past the end of a loop tail.
+		// @details  加载/存储向量。
+		//****************************************************************
+
+		furud_inline Vec16f& Load(const void* data) noexcept
+		{
+			reg = _mm512_load_ps(data);
+			return *this;
+		}
+
+		furud_inline void Store(void* data) const noexcept
+		{
+			_mm512_store_ps(data, reg);
+		}
+
+		furud_inline Vec16f& LoadMasked(const void* data, const Mask16& mask) noexcept
+		{
+			reg = _mm512_maskz_loadu_ps(mask, data);
+			return *this;
+		}
+
+		furud_inline void StoreMasked(void* data, const Mask16& mask) const noexcept
+		{
+			_mm512_mask_storeu_ps(data, mask, reg);
+		}
+
+		furud_inline static void Copy(const void* src, void* dst) noexcept
+		{
+			_mm512_store_ps(dst, _mm512_load_ps(src));
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Loads/Stores a Vec16f from/to unaligned memory.
+		//           The partial versions only touch the first `count` elements (clamped to 16).
+		// @details  非对齐/部分加载存储向量。
+		//****************************************************************
+
+		furud_inline Vec16f& LoadUnaligned(const void* data) noexcept
+		{
+			reg = _mm512_loadu_ps(data);
+			return *this;
+		}
+
+		furud_inline void StoreUnaligned(void* data) const noexcept
+		{
+			_mm512_storeu_ps(data, reg);
+		}
+
+		furud_inline Vec16f& LoadPartial(const void* data, const size_t& count) noexcept
+		{
+			return LoadMasked(data, Mask16::FirstN(count));
+		}
+
+		furud_inline void StorePartial(void* data, const size_t& count) const noexcept
+		{
+			StoreMasked(data, Mask16::FirstN(count));
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Splits the Vec16f into two Vec8f.
+		// @details  拆分为两个八维向量。
+		//****************************************************************
+
+		furud_inline Vec8f furud_vectorapi Low() const noexcept { return _mm512_castps512_ps256(reg); }
+		furud_inline Vec8f furud_vectorapi High() const noexcept { return _mm512_extractf32x8_ps(reg, 1); }
+
+
+	public:
+		/**
+		 * @brief    Converts Vec16f (float) to Vec16i (signed 32-bit integer), rounding toward zero.
+		 * @return   ( (int32_t)reg.x0, same for the others )
+		 * @details  浮点数转整数。
+		 */
+		furud_inline Vec16i furud_vectorapi ToInteger() const noexcept { return _mm512_cvttps_epi32(reg); }
+
+
+	public:
+		//****************************************************************
+		// @brief    Creates a 16-lane mask through elements comparison from each Vec16f.
+		// @return   Mask16( bit i = lhs[i] opr rhs[i] ), false for NaN lanes except NotEqual.
+		// @details  比较运算。
+		//****************************************************************
+
+		furud_inline friend Mask16 furud_vectorapi Equal(const Vec16f& lhs, const Vec16f& rhs) noexcept
+		{
+			return _mm512_cmp_ps_mask(lhs.reg, rhs.reg, _CMP_EQ_OQ);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi NotEqual(const Vec16f& lhs, const Vec16f& rhs) noexcept
+		{
+			return _mm512_cmp_ps_mask(lhs.reg, rhs.reg, _CMP_NEQ_UQ);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi GreaterThan(const Vec16f& lhs, const Vec16f& rhs) noexcept
+		{
+			return _mm512_cmp_ps_mask(lhs.reg, rhs.reg, _CMP_GT_OQ);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi LessThan(const Vec16f& lhs, const Vec16f& rhs) noexcept
+		{
+			return _mm512_cmp_ps_mask(lhs.reg, rhs.reg, _CMP_LT_OQ);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi GreaterThanOrEqual(const Vec16f& lhs, const Vec16f& rhs) noexcept
+		{
+			return _mm512_cmp_ps_mask(lhs.reg, rhs.reg, _CMP_GE_OQ);
+		}
+
+		furud_inline friend Mask16 furud_vectorapi LessThanOrEqual(const Vec16f& lhs, const Vec16f& rhs) noexcept
+		{
+			return _mm512_cmp_ps_mask(lhs.reg, rhs.reg, _CMP_LE_OQ);
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Basic numerical operations.
+		// @return   Vec16f( x opr rhs.x, same for the others )
+		// @details  加减乘除。
+		//****************************************************************
+
+		furud_inline Vec16f furud_vectorapi operator - () const noexcept { return _mm512_xor_ps(reg, SIGN_BIT); }
+
+		furud_inline Vec16f furud_vectorapi operator + (const Vec16f& rhs) const noexcept { return _mm512_add_ps(reg, rhs.reg); }
+		furud_inline Vec16f furud_vectorapi operator - (const Vec16f& rhs) const noexcept { return _mm512_sub_ps(reg, rhs.reg); }
+		furud_inline Vec16f furud_vectorapi operator * (const Vec16f& rhs) const noexcept { return _mm512_mul_ps(reg, rhs.reg); }
+		furud_inline Vec16f furud_vectorapi operator / (const Vec16f& rhs) const noexcept { return _mm512_div_ps(reg, rhs.reg); }
+
+		furud_inline Vec16f furud_vectorapi operator + (const __m512& rhs) const noexcept { return _mm512_add_ps(reg, rhs); }
+		furud_inline Vec16f furud_vectorapi operator - (const __m512& rhs) const noexcept { return _mm512_sub_ps(reg, rhs); }
+		furud_inline Vec16f furud_vectorapi operator * (const __m512& rhs) const noexcept { return _mm512_mul_ps(reg, rhs); }
+		furud_inline Vec16f furud_vectorapi operator / (const __m512& rhs) const noexcept { return _mm512_div_ps(reg, rhs); }
+
+		furud_inline friend Vec16f furud_vectorapi operator + (const __m512& lhs, const Vec16f& rhs) noexcept { return _mm512_add_ps(lhs, rhs.reg); }
+		furud_inline friend Vec16f furud_vectorapi operator - (const __m512& lhs, const Vec16f& rhs) noexcept { return _mm512_sub_ps(lhs, rhs.reg); }
+		furud_inline friend Vec16f furud_vectorapi operator * (const __m512& lhs, const Vec16f& rhs) noexcept { return _mm512_mul_ps(lhs, rhs.reg); }
+		furud_inline friend Vec16f furud_vectorapi operator / (const __m512& lhs, const Vec16f& rhs) noexcept { return _mm512_div_ps(lhs, rhs.reg); }
+
+		furud_inline const Vec16f& operator += (const Vec16f& rhs) noexcept { reg = _mm512_add_ps(reg, rhs.reg); return *this; }
+		furud_inline const Vec16f& operator -= (const Vec16f& rhs) noexcept { reg = _mm512_sub_ps(reg, rhs.reg); return *this; }
+		furud_inline const Vec16f& operator *= (const Vec16f& rhs) noexcept { reg = _mm512_mul_ps(reg, rhs.reg); return *this; }
+		furud_inline const Vec16f& operator /= (const Vec16f& rhs) noexcept { reg = _mm512_div_ps(reg, rhs.reg); return *this; }
+
+		furud_inline const Vec16f& operator += (const __m512& rhs) noexcept { reg = _mm512_add_ps(reg, rhs); return *this; }
+		furud_inline const Vec16f& operator -= (const __m512& rhs) noexcept { reg = _mm512_sub_ps(reg, rhs); return *this; }
+		furud_inline const Vec16f& operator *= (const __m512& rhs) noexcept { reg = _mm512_mul_ps(reg, rhs); return *this; }
+		furud_inline const Vec16f& operator /= (const __m512& rhs) noexcept { reg = _mm512_div_ps(reg, rhs); return *this; }
+
+
+	public:
+		//****************************************************************
+		// @brief    Basic numerical operations.
+		// @return   Vec16f( x opr rhs, same for the others )
+		// @details  加减乘除。
+		//****************************************************************
+
+		furud_inline Vec16f furud_vectorapi operator + (const float& rhs) const noexcept { return _mm512_add_ps(reg, _mm512_set1_ps(rhs)); }
+		furud_inline Vec16f furud_vectorapi operator - (const float& rhs) const noexcept { return _mm512_sub_ps(reg, _mm512_set1_ps(rhs)); }
+		furud_inline Vec16f furud_vectorapi operator * (const float& rhs) const noexcept { return _mm512_mul_ps(reg, _mm512_set1_ps(rhs)); }
+		furud_inline Vec16f furud_vectorapi operator / (const float& rhs) const noexcept { return _mm512_div_ps(reg, _mm512_set1_ps(rhs)); }
+
+		furud_inline const Vec16f& operator += (const float& rhs) noexcept { reg = _mm512_add_ps(reg, _mm512_set1_ps(rhs)); return *this; }
+		furud_inline const Vec16f& operator -= (const float& rhs) noexcept { reg = _mm512_sub_ps(reg, _mm512_set1_ps(rhs)); return *this; }
+		furud_inline const Vec16f& operator *= (const float& rhs) noexcept { reg = _mm512_mul_ps(reg, _mm512_set1_ps(rhs)); return *this; }
+		furud_inline const Vec16f& operator /= (const float& rhs) noexcept { reg = _mm512_div_ps(reg, _mm512_set1_ps(rhs)); return *this; }
+
+
+	public:
+		//****************************************************************
+		// @brief    Returns the minimum/maximum values of two Vec16f.
+		// @return   Vec16f( min( lhs.x, rhs.x )/max( lhs.x, rhs.x ), same for the others )
+		// @details  最大/最小值。
+		//****************************************************************
+
+		furud_inline friend Vec16f furud_vectorapi Min(const Vec16f& lhs, const Vec16f& rhs) noexcept { return _mm512_min_ps(lhs.reg, rhs.reg); }
+		furud_inline friend Vec16f furud_vectorapi Max(const Vec16f& lhs, const Vec16f& rhs) noexcept { return _mm512_max_ps(lhs.reg, rhs.reg); }
+
+
+	public:
+		/**
+		 * @brief    Fused multiply-add with a single rounding.
+		 * @return   Vec16f( lhs.x * mhs.x + rhs.x, same for the others )
+		 * @details  乘加。
+		 */
+		furud_inline friend Vec16f furud_vectorapi MulAdd(const Vec16f& lhs, const Vec16f& mhs, const Vec16f& rhs) noexcept
+		{
+			return _mm512_fmadd_ps(lhs.reg, mhs.reg, rhs.reg);
+		}
+
+		/**
+		 * @brief    Computes the square roots.
+		 * @return   Vec16f( sqrt(x), same for the others )
+		 * @details  平方根。
+		 */
+		furud_inline Vec16f furud_vectorapi Sqrt() const noexcept { return _mm512_sqrt_ps(reg); }
+
+		/**
+		 * @brief    Computes the approximations of reciprocal square roots, relative error below 2^-14 (exact under FURUD_SIMD_STRICT_IEEE).
+		 * @return   Vec16f( 1 / sqrt(x), same for the others )
+		 * @details  平方根倒数。
+		 */
+		furud_inline Vec16f furud_vectorapi RecipSqrt() const noexcept
+		{
+#if FURUD_SIMD_STRICT_IEEE
+			return _mm512_div_ps(_mm512_set1_ps(1.f), _mm512_sqrt_ps(reg));
+#else
+			return _mm512_rsqrt14_ps(reg);
+#endif
+		}
+
+		/**
+		 * @brief    Computes the squares.
+		 * @return   Vec16f( x * x, same for the others )
+		 * @details  平方。
+		 */
+		furud_inline Vec16f furud_vectorapi Squares() const noexcept { return _mm512_mul_ps(reg, reg); }
+
+		/**
+		 * @brief    Computes the approximations of reciprocals, relative error below 2^-14 (exact under FURUD_SIMD_STRICT_IEEE).
+		 * @return   Vec16f( 1 / x, same for the others )
+		 * @details  倒数。
+		 */
+		furud_inline Vec16f furud_vectorapi Reciprocal() const noexcept
+		{
+#if FURUD_SIMD_STRICT_IEEE
+			return _mm512_div_ps(_mm512_set1_ps(1.f), reg);
+#else
+			return _mm512_rcp14_ps(reg);
+#endif
+		}
+
+		/**
+		 * @brief    Returns the absolute value.
+		 * @return   Vec16f( abs(x), same for the others )
+		 * @details  绝对值。
+		 */
+		furud_inline Vec16f furud_vectorapi Abs() const noexcept { return _mm512_and_ps(reg, SIGN_MASK); }
+
+
+	public:
+		//****************************************************************
+		// @brief    Combines two Vec16f using bitwise logic operation.
+		// @return   Vec16f( x opr rhs.x, same for the others )
+		// @details  逻辑运算。
+		//****************************************************************
+
+		furud_inline friend Vec16f furud_vectorapi And(const Vec16f& lhs, const Vec16f& rhs) noexcept { return _mm512_and_ps(lhs.reg, rhs.reg); }
+		furud_inline friend Vec16f furud_vectorapi AndNot(const Vec16f& lhs, const Vec16f& rhs) noexcept { return _mm512_andnot_ps(lhs.reg, rhs.reg); }
+		furud_inline friend Vec16f furud_vectorapi Or(const Vec16f& lhs, const Vec16f& rhs) noexcept { return _mm512_or_ps(lhs.reg, rhs.reg); }
+		furud_inline friend Vec16f furud_vectorapi Xor(const Vec16f& lhs, const Vec16f& rhs) noexcept { return _mm512_xor_ps(lhs.reg, rhs.reg); }
+
+
+	public:
+		/**
+		 * @brief    Returns an integer bit-mask (0x0000 - 0xffff) based on the sign-bit for each elements in a Vec16f.
+		 * @return   Bit i = sign(reg[i])
+		 * @details  掩码。
+		 */
+		furud_inline int32_t MaskBits() const noexcept { return static_cast<int32_t>(_mm512_movepi32_mask(_mm512_castps_si512(reg))); }
+
+		/**
+		 * @brief    Copy sign.
+		 * @return   Vec16f( sign.x > 0 ? abs(value.x) : -abs(value.x), same for the others )
+		 * @details  复制符号位。
+		 */
+		furud_inline friend Vec16f furud_vectorapi Copysign(const Vec16f& value, const Vec16f& sign) noexcept
+		{
+			return _mm512_or_ps(_mm512_and_ps(SIGN_BIT, sign.reg), _mm512_andnot_ps(SIGN_BIT, value.reg));
+		}
+
+		/**
+		 * @brief    Picks each lane from `lhs` where the mask bit is set, otherwise from `rhs`.
+		 * @return   Vec16f( mask[i] ? lhs[i] : rhs[i] )
+		 * @details  按掩码选择。
+		 */
+		furud_inline friend Vec16f furud_vectorapi Select(const Mask16& mask, const Vec16f& lhs, const Vec16f& rhs) noexcept
+		{
+			return _mm512_mask_blend_ps(mask, rhs.reg, lhs.reg);
+		}
+	};
+
+
+	furud_inline Vec16f furud_vectorapi Vec16i::ToFloat() const noexcept
+	{
+		return _mm512_cvtepi32_ps(reg);
+	}
+}
+#endif // !FURUD_SIMD_PORTABLE
+
+
+
+#ifdef FURUD_VEC16_TARGET_PUSHED
+#undef FURUD_VEC16_TARGET_PUSHED
+#pragma GCC pop_options
+#endif
@@ -10,84 +10,15 @@ module;
 
 #include <Furud.hpp>
 #include <stdint.h>
-#include <immintrin.h>
 #include <utility>
+#include "SIMDBackend.hpp"
 
 
 
 export module Furud.Platform.SIMD:Vec4;
 
 import Furud.Numbers;
-
-
-
-namespace Furud::Internal
-{
-	consteval __m128i Construct4i(uint32_t x)
-	{
-		__m128i result;
-		result.m128i_u32[0] = x;
-		result.m128i_u32[1] = x;
-		result.m128i_u32[2] = x;
-		result.m128i_u32[3] = x;
-		return result;
-	}
-
-	consteval __m128i Construct4i(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
-	{
-		__m128i result;
-		result.m128i_u32[0] = x;
-		result.m128i_u32[1] = y;
-		result.m128i_u32[2] = z;
-		result.m128i_u32[3] = w;
-		return result;
-	}
-}
-
-
-
-namespace Furud::Internal
-{
-	consteval __m128 Construct4f(float x, float y, float z, float w)
-	{
-		__m128 result;
-		result.m128_f32[0] = x;
-		result.m128_f32[1] = y;
-		result.m128_f32[2] = z;
-		result.m128_f32[3] = w;
-		return result;
-	}
-
-	consteval __m128 Construct4f(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
-	{
-		__m128 result;
-		result.m128_u32[0] = x;
-		result.m128_u32[1] = y;
-		result.m128_u32[2] = z;
-		result.m128_u32[3] = w;
-		return result;
-	}
-
-	consteval __m128 Construct4f(float x)
-	{
-		__m128 result;
-		result.m128_f32[0] = x;
-		result.m128_f32[1] = x;
-		result.m128_f32[2] = x;
-		result.m128_f32[3] = x;
-		return result;
-	}
-
-	consteval __m128 Construct4f(uint32_t x)
-	{
-		__m128 result;
-		result.m128_u32[0] = x;
-		result.m128_u32[1] = x;
-		result.m128_u32[2] = x;
-		result.m128_u32[3] = x;
-		return result;
-	}
-}
+import :Transcendental;
 
 
 
@@ -150,6 +81,23 @@ export namespace Furud
 	furud_inline extern Vec4f furud_vectorapi Select(const Vec4f& mask, const Vec4f& lhs, const Vec4f& rhs) noexcept;
 	furud_inline extern float furud_vectorapi DotProduct(const Vec4f& lhs, const Vec4f& rhs) noexcept;
 	furud_inline extern Vec4f furud_vectorapi Pow(const Vec4f& lhs, const Vec4f& rhs) noexcept;
+	furud_inline extern Vec4f furud_vectorapi Sin(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi Cos(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi Exp(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi Exp2(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi Log(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi Log2(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi Atan2(const Vec4f& y, const Vec4f& x) noexcept;
+	furud_inline extern Vec4f furud_vectorapi FastSin(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi FastCos(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi FastExp(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi FastExp2(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi FastLog(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi FastLog2(const Vec4f& value) noexcept;
+	furud_inline extern Vec4f furud_vectorapi FastPow(const Vec4f& lhs, const Vec4f& rhs) noexcept;
+	furud_inline extern Vec4f furud_vectorapi FastAtan2(const Vec4f& y, const Vec4f& x) noexcept;
+	furud_inline extern void furud_vectorapi SinCos(const Vec4f& value, Vec4f& outSin, Vec4f& outCos) noexcept;
+	furud_inline extern void furud_vectorapi FastSinCos(const Vec4f& value, Vec4f& outSin, Vec4f& outCos) noexcept;
 	furud_inline extern Vec4f furud_vectorapi And(const Vec4f& lhs, const Vec4f& rhs) noexcept;
 	furud_inline extern Vec4f furud_vectorapi AndNot(const Vec4f& lhs, const Vec4f& rhs) noexcept;
 	furud_inline extern Vec4f furud_vectorapi Or(const Vec4f& lhs, const Vec4f& rhs) noexcept;
@@ -203,19 +151,19 @@ export namespace Furud
 
 
 	public:
-		static constexpr __m128i X_MASK    { Internal::Construct4i(0xffffffffui32, 0, 0, 0) };
-		static constexpr __m128i Y_MASK    { Internal::Construct4i(0, 0xffffffffui32, 0, 0) };
-		static constexpr __m128i Z_MASK    { Internal::Construct4i(0, 0, 0xffffffffui32, 0) };
-		static constexpr __m128i W_MASK    { Internal::Construct4i(0, 0, 0, 0xffffffffui32) };
-		static constexpr __m128i XY_MASK   { Internal::Construct4i(0xffffffffui32, 0xffffffffui32, 0, 0) };
-		static constexpr __m128i XZ_MASK   { Internal::Construct4i(0xffffffffui32, 0, 0xffffffffui32, 0) };
-		static constexpr __m128i YW_MASK   { Internal::Construct4i(0, 0xffffffffui32, 0, 0xffffffffui32) };
-		static constexpr __m128i ZW_MASK   { Internal::Construct4i(0, 0, 0xffffffffui32, 0xffffffffui32) };
-		static constexpr __m128i XYZ_MASK  { Internal::Construct4i(0xffffffffui32, 0xffffffffui32, 0xffffffffui32, 0) };
-		static constexpr __m128i YZW_MASK  { Internal::Construct4i(0, 0xffffffffui32, 0xffffffffui32, 0xffffffffui32) };
-		static constexpr __m128i XYZW_MASK { Internal::Construct4i(0xffffffffui32) };
-		static constexpr __m128i SIGN_BIT  { Internal::Construct4i(0x80000000ui32) };
-		static constexpr __m128i SIGN_MASK { Internal::Construct4i(0x7fffffffui32) };
+		static constexpr __m128i X_MASK    { Internal::Construct4i(0xffffffffu, 0, 0, 0) };
+		static constexpr __m128i Y_MASK    { Internal::Construct4i(0, 0xffffffffu, 0, 0) };
+		static constexpr __m128i Z_MASK    { Internal::Construct4i(0, 0, 0xffffffffu, 0) };
+		static constexpr __m128i W_MASK    { Internal::Construct4i(0, 0, 0, 0xffffffffu) };
+		static constexpr __m128i XY_MASK   { Internal::Construct4i(0xffffffffu, 0xffffffffu, 0, 0) };
+		static constexpr __m128i XZ_MASK   { Internal::Construct4i(0xffffffffu, 0, 0xffffffffu, 0) };
+		static constexpr __m128i YW_MASK   { Internal::Construct4i(0, 0xffffffffu, 0, 0xffffffffu) };
+		static constexpr __m128i ZW_MASK   { Internal::Construct4i(0, 0, 0xffffffffu, 0xffffffffu) };
+		static constexpr __m128i XYZ_MASK  { Internal::Construct4i(0xffffffffu, 0xffffffffu, 0xffffffffu, 0) };
+		static constexpr __m128i YZW_MASK  { Internal::Construct4i(0, 0xffffffffu, 0xffffffffu, 0xffffffffu) };
+		static constexpr __m128i XYZW_MASK { Internal::Construct4i(0xffffffffu) };
+		static constexpr __m128i SIGN_BIT  { Internal::Construct4i(0x80000000u) };
+		static constexpr __m128i SIGN_MASK { Internal::Construct4i(0x7fffffffu) };
 
 
 	public:
@@ -278,12 +226,12 @@ export namespace Furud
 	private:
 		furud_inline int32_t Extract(int32_t&& index) const noexcept
 		{
-			return r.m128i_i32[index];
+			return reinterpret_cast<const int32_t*>(&r)[index];
 		}
 
 		furud_inline void Insert(int32_t&& index, const int32_t& value) noexcept
 		{
-			r.m128i_i32[index] = value;
+			reinterpret_cast<int32_t*>(&r)[index] = value;
 		}
 
 
@@ -301,8 +249,8 @@ export namespace Furud
 		furud_inline void SetY(const int32_t& value) noexcept { Insert(1, value); }
 		furud_inline void SetZ(const int32_t& value) noexcept { Insert(2, value); }
 		furud_inline void SetW(const int32_t& value) noexcept { Insert(3, value); }
-		furud_inline void SetX0() noexcept { r = _mm_and_epi32(r, YZW_MASK); }
-		furud_inline void SetW0() noexcept { r = _mm_and_epi32(r, XYZ_MASK); }
+		furud_inline void SetX0() noexcept { r = _mm_and_si128(r, YZW_MASK); }
+		furud_inline void SetW0() noexcept { r = _mm_and_si128(r, XYZ_MASK); }
 
 
 	public:
@@ -377,27 +325,27 @@ export namespace Furud
 		furud_inline Vec4i furud_vectorapi operator + (const Vec4i& rhs) const noexcept { return _mm_add_epi32(r, rhs.r); }
 		furud_inline Vec4i furud_vectorapi operator - (const Vec4i& rhs) const noexcept { return _mm_sub_epi32(r, rhs.r); }
 		furud_inline Vec4i furud_vectorapi operator * (const Vec4i& rhs) const noexcept { return _mm_mullo_epi32(r, rhs.r); }
-		furud_inline Vec4i furud_vectorapi operator / (const Vec4i& rhs) const noexcept { return _mm_div_epi32(r, rhs.r); }
+		furud_inline Vec4i furud_vectorapi operator / (const Vec4i& rhs) const noexcept { return Internal::SimdDivide(r, rhs.r); }
 
 		furud_inline Vec4i furud_vectorapi operator + (const __m128i& rhs) const noexcept { return _mm_add_epi32(r, rhs); }
 		furud_inline Vec4i furud_vectorapi operator - (const __m128i& rhs) const noexcept { return _mm_sub_epi32(r, rhs); }
 		furud_inline Vec4i furud_vectorapi operator * (const __m128i& rhs) const noexcept { return _mm_mullo_epi32(r, rhs); }
-		furud_inline Vec4i furud_vectorapi operator / (const __m128i& rhs) const noexcept { return _mm_div_epi32(r, rhs); }
+		furud_inline Vec4i furud_vectorapi operator / (const __m128i& rhs) const noexcept { return Internal::SimdDivide(r, rhs); }
 
 		furud_inline friend Vec4i furud_vectorapi operator + (const __m128i& lhs, const Vec4i& rhs) noexcept { return _mm_add_epi32(lhs, rhs.r); }
 		furud_inline friend Vec4i furud_vectorapi operator - (const __m128i& lhs, const Vec4i& rhs) noexcept { return _mm_sub_epi32(lhs, rhs.r); }
 		furud_inline friend Vec4i furud_vectorapi operator * (const __m128i& lhs, const Vec4i& rhs) noexcept { return _mm_mullo_epi32(lhs, rhs.r); }
-		furud_inline friend Vec4i furud_vectorapi operator / (const __m128i& lhs, const Vec4i& rhs) noexcept { return _mm_div_epi32(lhs, rhs.r); }
+		furud_inline friend Vec4i furud_vectorapi operator / (const __m128i& lhs, const Vec4i& rhs) noexcept { return Internal::SimdDivide(lhs, rhs.r); }
 
 		furud_inline const Vec4i& operator += (const Vec4i& rhs) noexcept { r = _mm_add_epi32(r, rhs.r); return *this; }
 		furud_inline const Vec4i& operator -= (const Vec4i& rhs) noexcept { r = _mm_sub_epi32(r, rhs.r); return *this; }
 		furud_inline const Vec4i& operator *= (const Vec4i& rhs) noexcept { r = _mm_mullo_epi32(r, rhs.r); return *this; }
-		furud_inline const Vec4i& operator /= (const Vec4i& rhs) noexcept { r = _mm_div_epi32(r, rhs.r); return *this; }
+		furud_inline const Vec4i& operator /= (const Vec4i& rhs) noexcept { r = Internal::SimdDivide(r, rhs.r); return *this; }
 
 		furud_inline const Vec4i& operator += (const __m128i& rhs) noexcept { r = _mm_add_epi32(r, rhs); return *this; }
 		furud_inline const Vec4i& operator -= (const __m128i& rhs) noexcept { r = _mm_sub_epi32(r, rhs); return *this; }
 		furud_inline const Vec4i& operator *= (const __m128i& rhs) noexcept { r = _mm_mullo_epi32(r, rhs); return *this; }
-		furud_inline const Vec4i& operator /= (const __m128i& rhs) noexcept { r = _mm_div_epi32(r, rhs); return *this; }
+		furud_inline const Vec4i& operator /= (const __m128i& rhs) noexcept { r = Internal::SimdDivide(r, rhs); return *this; }
 
 
 	public:
@@ -410,17 +358,17 @@ export namespace Furud
 		furud_inline Vec4i furud_vectorapi operator + (const int32_t& rhs) const noexcept { return _mm_add_epi32(r, _mm_set1_epi32(rhs)); }
 		furud_inline Vec4i furud_vectorapi operator - (const int32_t& rhs) const noexcept { return _mm_sub_epi32(r, _mm_set1_epi32(rhs)); }
 		furud_inline Vec4i furud_vectorapi operator * (const int32_t& rhs) const noexcept { return _mm_mullo_epi32(r, _mm_set1_epi32(rhs)); }
-		furud_inline Vec4i furud_vectorapi operator / (const int32_t& rhs) const noexcept { return _mm_div_epi32(r, _mm_set1_epi32(rhs)); }
+		furud_inline Vec4i furud_vectorapi operator / (const int32_t& rhs) const noexcept { return Internal::SimdDivide(r, _mm_set1_epi32(rhs)); }
 
 		furud_inline friend Vec4i furud_vectorapi operator + (const int32_t& lhs, const Vec4i& rhs) noexcept { return _mm_add_epi32(_mm_set1_epi32(lhs), rhs.r); }
 		furud_inline friend Vec4i furud_vectorapi operator - (const int32_t& lhs, const Vec4i& rhs) noexcept { return _mm_sub_epi32(_mm_set1_epi32(lhs), rhs.r); }
 		furud_inline friend Vec4i furud_vectorapi operator * (const int32_t& lhs, const Vec4i& rhs) noexcept { return _mm_mullo_epi32(_mm_set1_epi32(lhs), rhs.r); }
-		furud_inline friend Vec4i furud_vectorapi operator / (const int32_t& lhs, const Vec4i& rhs) noexcept { return _mm_div_epi32(_mm_set1_epi32(lhs), rhs.r); }
+		furud_inline friend Vec4i furud_vectorapi operator / (const int32_t& lhs, const Vec4i& rhs) noexcept { return Internal::SimdDivide(_mm_set1_epi32(lhs), rhs.r); }
 
 		furud_inline const Vec4i& operator += (const int32_t& rhs) noexcept { r = _mm_add_epi32(r, _mm_set1_epi32(rhs));   return *this; }
 		furud_inline const Vec4i& operator -= (const int32_t& rhs) noexcept { r = _mm_sub_epi32(r, _mm_set1_epi32(rhs));   return *this; }
 		furud_inline const Vec4i& operator *= (const int32_t& rhs) noexcept { r = _mm_mullo_epi32(r, _mm_set1_epi32(rhs)); return *this; }
-		furud_inline const Vec4i& operator /= (const int32_t& rhs) noexcept { r = _mm_div_epi32(r, _mm_set1_epi32(rhs));   return *this; }
+		furud_inline const Vec4i& operator /= (const int32_t& rhs) noexcept { r = Internal::SimdDivide(r, _mm_set1_epi32(rhs));   return *this; }
 
 
 	public:
@@ -457,7 +405,7 @@ export namespace Furud
 		 * @return   Vec4i( abs(r.x), same for yzw )
 		 * @details  绝对值。
 		 */
-		furud_inline Vec4i furud_vectorapi Abs() const noexcept { return _mm_and_epi32(r, SIGN_MASK); }
+		furud_inline Vec4i furud_vectorapi Abs() const noexcept { return _mm_and_si128(r, SIGN_MASK); }
 
 
 	public:
@@ -467,10 +415,10 @@ export namespace Furud
 		// @details  按位逻辑运算。
 		//****************************************************************
 
-		furud_inline friend Vec4i furud_vectorapi And(const Vec4i& lhs, const Vec4i& rhs) noexcept { return _mm_and_epi32(lhs.r, rhs.r); }
-		furud_inline friend Vec4i furud_vectorapi AndNot(const Vec4i& lhs, const Vec4i& rhs) noexcept { return _mm_andnot_epi32(lhs.r, rhs.r); }
-		furud_inline friend Vec4i furud_vectorapi Or(const Vec4i& lhs, const Vec4i& rhs) noexcept { return _mm_or_epi32(lhs.r, rhs.r); }
-		furud_inline friend Vec4i furud_vectorapi Xor(const Vec4i& lhs, const Vec4i& rhs) noexcept { return _mm_xor_epi32(lhs.r, rhs.r); }
+		furud_inline friend Vec4i furud_vectorapi And(const Vec4i& lhs, const Vec4i& rhs) noexcept { return _mm_and_si128(lhs.r, rhs.r); }
+		furud_inline friend Vec4i furud_vectorapi AndNot(const Vec4i& lhs, const Vec4i& rhs) noexcept { return _mm_andnot_si128(lhs.r, rhs.r); }
+		furud_inline friend Vec4i furud_vectorapi Or(const Vec4i& lhs, const Vec4i& rhs) noexcept { return _mm_or_si128(lhs.r, rhs.r); }
+		furud_inline friend Vec4i furud_vectorapi Xor(const Vec4i& lhs, const Vec4i& rhs) noexcept { return _mm_xor_si128(lhs.r, rhs.r); }
 
 
 	public:
@@ -481,7 +429,7 @@ export namespace Furud
 		 */
 		furud_inline friend Vec4i furud_vectorapi Copysign(const Vec4i& value, const Vec4i& sign) noexcept
 		{
-			return _mm_or_epi32(_mm_and_epi32(SIGN_BIT, sign.r), _mm_andnot_epi32(SIGN_BIT, value.r));
+			return _mm_or_si128(_mm_and_si128(SIGN_BIT, sign.r), _mm_andnot_si128(SIGN_BIT, value.r));
 		}
 	};
 }
@@ -518,28 +466,28 @@ export namespace Furud
 		static constexpr __m128 D255            { Internal::Construct4f(255.f) };
 		static constexpr __m128 DEG_TO_RAD      { Internal::Construct4f(IFloat::DEG_TO_RAD) };
 		static constexpr __m128 RAD_TO_DEG      { Internal::Construct4f(IFloat::RAD_TO_DEG) };
-		static constexpr __m128 SIGN_BIT        { Internal::Construct4f(0x80000000ui32) };
-		static constexpr __m128 SIGN_MASK       { Internal::Construct4f(0x7fffffffui32) };
+		static constexpr __m128 SIGN_BIT        { Internal::Construct4f(0x80000000u) };
+		static constexpr __m128 SIGN_MASK       { Internal::Construct4f(0x7fffffffu) };
 		static constexpr __m128 NON_FRACTIONAL  { Internal::Construct4f(8388608.f) };
-		static constexpr __m128 X_MASK          { Internal::Construct4f(0xffffffffui32, 0, 0, 0) };
-		static constexpr __m128 Y_MASK          { Internal::Construct4f(0, 0xffffffffui32, 0, 0) };
-		static constexpr __m128 Z_MASK          { Internal::Construct4f(0, 0, 0xffffffffui32, 0) };
-		static constexpr __m128 W_MASK          { Internal::Construct4f(0, 0, 0, 0xffffffffui32) };
-		static constexpr __m128 XY_MASK         { Internal::Construct4f(0xffffffffui32, 0xffffffffui32, 0, 0) };
-		static constexpr __m128 XZ_MASK         { Internal::Construct4f(0xffffffffui32, 0, 0xffffffffui32, 0) };
-		static constexpr __m128 YW_MASK         { Internal::Construct4f(0, 0xffffffffui32, 0, 0xffffffffui32) };
-		static constexpr __m128 ZW_MASK         { Internal::Construct4f(0, 0, 0xffffffffui32, 0xffffffffui32) };
-		static constexpr __m128 XYZ_MASK        { Internal::Construct4f(0xffffffffui32, 0xffffffffui32, 0xffffffffui32, 0) };
-		static constexpr __m128 YZW_MASK        { Internal::Construct4f(0, 0xffffffffui32, 0xffffffffui32, 0xffffffffui32) };
-		static constexpr __m128 XYZW_MASK       { Internal::Construct4f(0xffffffffui32) };
+		static constexpr __m128 X_MASK          { Internal::Construct4f(0xffffffffu, 0, 0, 0) };
+		static constexpr __m128 Y_MASK          { Internal::Construct4f(0, 0xffffffffu, 0, 0) };
+		static constexpr __m128 Z_MASK          { Internal::Construct4f(0, 0, 0xffffffffu, 0) };
+		static constexpr __m128 W_MASK          { Internal::Construct4f(0, 0, 0, 0xffffffffu) };
+		static constexpr __m128 XY_MASK         { Internal::Construct4f(0xffffffffu, 0xffffffffu, 0, 0) };
+		static constexpr __m128 XZ_MASK         { Internal::Construct4f(0xffffffffu, 0, 0xffffffffu, 0) };
+		static constexpr __m128 YW_MASK         { Internal::Construct4f(0, 0xffffffffu, 0, 0xffffffffu) };
+		static constexpr __m128 ZW_MASK         { Internal::Construct4f(0, 0, 0xffffffffu, 0xffffffffu) };
+		static constexpr __m128 XYZ_MASK        { Internal::Construct4f(0xffffffffu, 0xffffffffu, 0xffffffffu, 0) };
+		static constexpr __m128 YZW_MASK        { Internal::Construct4f(0, 0xffffffffu, 0xffffffffu, 0xffffffffu) };
+		static constexpr __m128 XYZW_MASK       { Internal::Construct4f(0xffffffffu) };
 
 
 	public:
 		constexpr Vec4f() noexcept {}
 		constexpr Vec4f(__m128&& value) noexcept : r(std::move(value)) {}
 		constexpr Vec4f(const __m128& value) noexcept : r(value) {}
-		constexpr Vec4f(float&& x) noexcept : r({ x, x, x, x }) {}
-		constexpr Vec4f(float&& x, float&& y, float&& z, float&& w) noexcept : r({ x, y, z, w }) {}
+		constexpr Vec4f(float&& x) noexcept : r{ x, x, x, x } {}
+		constexpr Vec4f(float&& x, float&& y, float&& z, float&& w) noexcept : r{ x, y, z, w } {}
 
 
 	public:
@@ -596,7 +544,7 @@ export namespace Furud
 	private:
 		furud_inline void Insert(int32_t&& index, const float& value) noexcept
 		{
-			r.m128_f32[index] = value;
+			reinterpret_cast<float*>(&r)[index] = value;
 		}
 
 
@@ -858,11 +806,18 @@ export namespace Furud
 		furud_inline Vec4f furud_vectorapi Sqrt() const noexcept { return _mm_sqrt_ps(r); }
 
 		/**
-		 * @brief    Computes the reciprocal square roots.
+		 * @brief    Computes the reciprocal square roots, 12-bit estimates unless FURUD_SIMD_STRICT_IEEE.
 		 * @return   Vec4f( 1/sqrt(r.x), same for yzw )
 		 * @details  平方根倒数。
 		 */
-		furud_inline Vec4f furud_vectorapi RecipSqrt() const noexcept { return _mm_rsqrt_ps(r); }
+		furud_inline Vec4f furud_vectorapi RecipSqrt() const noexcept
+		{
+#if FURUD_SIMD_STRICT_IEEE
+			return _mm_div_ps(ONE, _mm_sqrt_ps(r));
+#else
+			return _mm_rsqrt_ps(r);
+#endif
+		}
 
 		/**
 		 * @brief    Computes the squares.
@@ -872,11 +827,18 @@ export namespace Furud
 		furud_inline Vec4f furud_vectorapi Squares() const noexcept { return _mm_mul_ps(r, r); }
 
 		/*
-		 * @brief    Computes the approximations of reciprocals.
+		 * @brief    Computes the approximations of reciprocals, exact under FURUD_SIMD_STRICT_IEEE.
 		 * @return   Vec4f( 1 / r.x, same for yzw )
 		 * @details  倒数。
 		 */
-		furud_inline Vec4f furud_vectorapi Reciprocal() const noexcept { return _mm_rcp_ps(r); }
+		furud_inline Vec4f furud_vectorapi Reciprocal() const noexcept
+		{
+#if FURUD_SIMD_STRICT_IEEE
+			return _mm_div_ps(ONE, r);
+#else
+			return _mm_rcp_ps(r);
+#endif
+		}
 
 		/**
 		 * @brief    Returns the absolute value.
@@ -985,6 +947,10 @@ export namespace Furud
 			const float squareSum = Squares().Sum();
 			if (squareSum > tolerance)
 			{
+#if FURUD_SIMD_STRICT_IEEE
+				// The rsqrt estimate differs between cpu vendors, divide by the correctly rounded length.
+				return _mm_div_ps(r, _mm_sqrt_ps(_mm_set_ps1(squareSum)));
+#else
 				__m128 x0, y0, x1, x2, fOver2;
 
 				// Fast Inverse Square Root.
@@ -1005,6 +971,7 @@ export namespace Furud
 				x2 = _mm_fmadd_ps(x1, x2, x1);
 
 				return _mm_mul_ps(r, x2);
+#endif
 			}
 			return *this;
 		}
@@ -1046,7 +1013,48 @@ export namespace Furud
 		 */
 		furud_inline friend Vec4f furud_vectorapi Pow(const Vec4f& lhs, const Vec4f& rhs) noexcept
 		{
-			return _mm_pow_ps(lhs.r, rhs.r);
+			return Internal::SimdPow<__m128, true>(lhs.r, rhs.r);
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Transcendental functions, evaluated for each element.
+		//           The precise ones stay within 2.5 ulp of the C library and keep its special values.
+		//           The fast ones trade accuracy and special values for speed.
+		// @return   Vec4f( f(value.x), same for yzw )
+		// @details  超越函数。
+		//****************************************************************
+
+		furud_inline friend Vec4f furud_vectorapi Sin(const Vec4f& value) noexcept { return Internal::SimdSin<__m128, true>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi Cos(const Vec4f& value) noexcept { return Internal::SimdCos<__m128, true>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi Exp(const Vec4f& value) noexcept { return Internal::SimdExp<__m128, true>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi Exp2(const Vec4f& value) noexcept { return Internal::SimdExp2<__m128, true>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi Log(const Vec4f& value) noexcept { return Internal::SimdLog<__m128, true>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi Log2(const Vec4f& value) noexcept { return Internal::SimdLog2<__m128, true>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi Atan2(const Vec4f& y, const Vec4f& x) noexcept { return Internal::SimdAtan2<__m128, true>(y.r, x.r); }
+
+		furud_inline friend Vec4f furud_vectorapi FastSin(const Vec4f& value) noexcept { return Internal::SimdSin<__m128, false>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi FastCos(const Vec4f& value) noexcept { return Internal::SimdCos<__m128, false>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi FastExp(const Vec4f& value) noexcept { return Internal::SimdExp<__m128, false>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi FastExp2(const Vec4f& value) noexcept { return Internal::SimdExp2<__m128, false>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi FastLog(const Vec4f& value) noexcept { return Internal::SimdLog<__m128, false>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi FastLog2(const Vec4f& value) noexcept { return Internal::SimdLog2<__m128, false>(value.r); }
+		furud_inline friend Vec4f furud_vectorapi FastPow(const Vec4f& lhs, const Vec4f& rhs) noexcept { return Internal::SimdPow<__m128, false>(lhs.r, rhs.r); }
+		furud_inline friend Vec4f furud_vectorapi FastAtan2(const Vec4f& y, const Vec4f& x) noexcept { return Internal::SimdAtan2<__m128, false>(y.r, x.r); }
+
+		/**
+		 * @brief    Computes the sine and cosine together, sharing the range reduction.
+		 * @details  同时计算正弦与余弦。
+		 */
+		furud_inline friend void furud_vectorapi SinCos(const Vec4f& value, Vec4f& outSin, Vec4f& outCos) noexcept
+		{
+			Internal::SimdSinCos<__m128, true>(value.r, outSin.r, outCos.r);
+		}
+
+		furud_inline friend void furud_vectorapi FastSinCos(const Vec4f& value, Vec4f& outSin, Vec4f& outCos) noexcept
+		{
+			Internal::SimdSinCos<__m128, false>(value.r, outSin.r, outCos.r);
 		}
 
 
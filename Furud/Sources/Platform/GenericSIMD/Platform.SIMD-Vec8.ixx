@@ -9,46 +9,14 @@
 module;
 
 #include <Furud.hpp>
-#include <immintrin.h>
 #include <bit>
+#include "SIMDBackend.hpp"
 
 
 export module Furud.Platform.SIMD:Vec8;
 
 import Furud.Numbers;
-
-
-
-namespace Furud::Internal
-{
-	consteval __m256 Construct8f(uint32_t x)
-	{
-		__m256 result;
-		result.m256_f32[0] = std::bit_cast<float>(x);
-		result.m256_f32[1] = std::bit_cast<float>(x);
-		result.m256_f32[2] = std::bit_cast<float>(x);
-		result.m256_f32[3] = std::bit_cast<float>(x);
-		result.m256_f32[4] = std::bit_cast<float>(x);
-		result.m256_f32[5] = std::bit_cast<float>(x);
-		result.m256_f32[6] = std::bit_cast<float>(x);
-		result.m256_f32[7] = std::bit_cast<float>(x);
-		return result;
-	}
-
-	consteval __m256 Construct8f(float x)
-	{
-		__m256 result;
-		result.m256_f32[0] = x;
-		result.m256_f32[1] = x;
-		result.m256_f32[2] = x;
-		result.m256_f32[3] = x;
-		result.m256_f32[4] = x;
-		result.m256_f32[5] = x;
-		result.m256_f32[6] = x;
-		result.m256_f32[7] = x;
-		return result;
-	}
-}
+import :Transcendental;
 
 
 
@@ -68,11 +36,39 @@ export namespace Furud
 	furud_inline extern Vec8f furud_vectorapi operator / (const __m256& lhs, const Vec8f& rhs) noexcept;
 	furud_inline extern Vec8f furud_vectorapi Min(const Vec8f& lhs, const Vec8f& rhs) noexcept;
 	furud_inline extern Vec8f furud_vectorapi Max(const Vec8f& lhs, const Vec8f& rhs) noexcept;
+	furud_inline extern Vec8f furud_vectorapi MulAdd(const Vec8f& lhs, const Vec8f& mhs, const Vec8f& rhs) noexcept;
+	furud_inline extern Vec8f furud_vectorapi Select(const Vec8f& mask, const Vec8f& lhs, const Vec8f& rhs) noexcept;
 	furud_inline extern Vec8f furud_vectorapi And(const Vec8f& lhs, const Vec8f& rhs) noexcept;
 	furud_inline extern Vec8f furud_vectorapi AndNot(const Vec8f& lhs, const Vec8f& rhs) noexcept;
 	furud_inline extern Vec8f furud_vectorapi Or(const Vec8f& lhs, const Vec8f& rhs) noexcept;
 	furud_inline extern Vec8f furud_vectorapi Xor(const Vec8f& lhs, const Vec8f& rhs) noexcept;
 	furud_inline extern Vec8f furud_vectorapi Copysign(const Vec8f& value, const Vec8f& sign) noexcept;
+	furud_inline extern Vec8f furud_vectorapi Sin(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi Cos(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi Exp(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi Exp2(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi Log(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi Log2(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi Pow(const Vec8f& lhs, const Vec8f& rhs) noexcept;
+	furud_inline extern Vec8f furud_vectorapi Atan2(const Vec8f& y, const Vec8f& x) noexcept;
+	furud_inline extern Vec8f furud_vectorapi FastSin(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi FastCos(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi FastExp(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi FastExp2(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi FastLog(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi FastLog2(const Vec8f& value) noexcept;
+	furud_inline extern Vec8f furud_vectorapi FastPow(const Vec8f& lhs, const Vec8f& rhs) noexcept;
+	furud_inline extern Vec8f furud_vectorapi FastAtan2(const Vec8f& y, const Vec8f& x) noexcept;
+	furud_inline extern void furud_vectorapi SinCos(const Vec8f& value, Vec8f& outSin, Vec8f& outCos) noexcept;
+	furud_inline extern void furud_vectorapi FastSinCos(const Vec8f& value, Vec8f& outSin, Vec8f& outCos) noexcept;
+	furud_inline extern void furud_vectorapi LoadDeinterleave3(const float* data, Vec8f& x, Vec8f& y, Vec8f& z) noexcept;
+	furud_inline extern void furud_vectorapi LoadDeinterleave4(const float* data, Vec8f& x, Vec8f& y, Vec8f& z, Vec8f& w) noexcept;
+	furud_inline extern void furud_vectorapi StoreInterleave3(float* data, const Vec8f& x, const Vec8f& y, const Vec8f& z) noexcept;
+	furud_inline extern void furud_vectorapi StoreInterleave4(float* data, const Vec8f& x, const Vec8f& y, const Vec8f& z, const Vec8f& w) noexcept;
+	furud_inline extern void furud_vectorapi LoadDeinterleaveInt16(const void* data, Vec8f& x, Vec8f& y) noexcept;
+	furud_inline extern void furud_vectorapi LoadDeinterleaveInt8(const void* data, Vec8f& x, Vec8f& y) noexcept;
+	furud_inline extern void furud_vectorapi StoreInterleaveInt16(void* data, const Vec8f& x, const Vec8f& y) noexcept;
+	furud_inline extern void furud_vectorapi StoreInterleaveInt8(void* data, const Vec8f& x, const Vec8f& y) noexcept;
 }
 
 
@@ -92,11 +88,11 @@ export namespace Furud
 
 	public:
 
-		static constexpr __m256 SIGN_BIT   { Internal::Construct8f(0x80000000ui32) };
-		static constexpr __m256 SIGN_MASK  { Internal::Construct8f(0x7fffffffui32) };
+		static constexpr __m256 SIGN_BIT   { Internal::Construct8f(0x80000000u) };
+		static constexpr __m256 SIGN_MASK  { Internal::Construct8f(0x7fffffffu) };
 
 	public:
-		const Vec8f() noexcept {}
+		constexpr Vec8f() noexcept {}
 		constexpr Vec8f(__m256&& value) noexcept : reg(std::move(value)) {}
 		constexpr Vec8f(const __m256& value) noexcept : reg(value) {}
 
@@ -147,6 +143,124 @@ export namespace Furud
 		}
 
 
+	public:
+		//****************************************************************
+		// @brief    Loads/Stores a Vec8f from/to unaligned memory.
+		//           The partial versions only touch the first `count` elements (clamped to 8),
+		//           they neither fault nor write past the end of a loop tail.
+		// @details  非对齐/部分加载存储向量。
+		//****************************************************************
+
+		furud_inline Vec8f& LoadUnaligned(const void* data) noexcept
+		{
+			reg = _mm256_loadu_ps(static_cast<const float*>(data));
+			return *this;
+		}
+
+		furud_inline void StoreUnaligned(void* data) const noexcept
+		{
+			_mm256_storeu_ps(static_cast<float*>(data), reg);
+		}
+
+		furud_inline Vec8f& LoadPartial(const void* data, const size_t& count) noexcept
+		{
+			reg = count >= 8
+				? _mm256_loadu_ps(static_cast<const float*>(data))
+				: _mm256_maskload_ps(static_cast<const float*>(data), PartialMask(count));
+			return *this;
+		}
+
+		furud_inline void StorePartial(void* data, const size_t& count) const noexcept
+		{
+			if (count >= 8) furud_likely
+			{
+				_mm256_storeu_ps(static_cast<float*>(data), reg);
+			}
+			else
+			{
+				// Masked stores are slow on some cores, keep them for the tail only.
+				_mm256_maskstore_ps(static_cast<float*>(data), PartialMask(count), reg);
+			}
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Loads/Stores 8 elements from/to packed formats in unaligned memory.
+		//           Half  IEEE 754 binary16 through F16C, rounded to nearest even.
+		//           Int*  Rounded to nearest and saturated to the integer range, loads are exact.
+		// @details  压缩格式加载/存储。
+		//****************************************************************
+
+		furud_inline Vec8f& LoadHalf(const void* data) noexcept
+		{
+			reg = _mm256_cvtph_ps(_mm_loadu_si128(static_cast<const __m128i*>(data)));
+			return *this;
+		}
+
+		furud_inline void StoreHalf(void* data) const noexcept
+		{
+			_mm_storeu_si128(static_cast<__m128i*>(data), _mm256_cvtps_ph(reg, _MM_FROUND_TO_NEAREST_INT));
+		}
+
+		furud_inline Vec8f& LoadInt16(const void* data) noexcept
+		{
+			reg = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(static_cast<const __m128i*>(data))));
+			return *this;
+		}
+
+		furud_inline Vec8f& LoadUint16(const void* data) noexcept
+		{
+			reg = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128(static_cast<const __m128i*>(data))));
+			return *this;
+		}
+
+		furud_inline Vec8f& LoadInt8(const void* data) noexcept
+		{
+			reg = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64(static_cast<const __m128i*>(data))));
+			return *this;
+		}
+
+		furud_inline Vec8f& LoadUint8(const void* data) noexcept
+		{
+			reg = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(static_cast<const __m128i*>(data))));
+			return *this;
+		}
+
+		furud_inline void StoreInt16(void* data) const noexcept
+		{
+			const __m256i i = _mm256_cvtps_epi32(reg);
+			_mm_storeu_si128(static_cast<__m128i*>(data), _mm_packs_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1)));
+		}
+
+		furud_inline void StoreUint16(void* data) const noexcept
+		{
+			const __m256i i = _mm256_cvtps_epi32(reg);
+			_mm_storeu_si128(static_cast<__m128i*>(data), _mm_packus_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1)));
+		}
+
+		furud_inline void StoreInt8(void* data) const noexcept
+		{
+			const __m256i i = _mm256_cvtps_epi32(reg);
+			const __m128i w = _mm_packs_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1));
+			_mm_storel_epi64(static_cast<__m128i*>(data), _mm_packs_epi16(w, w));
+		}
+
+		furud_inline void StoreUint8(void* data) const noexcept
+		{
+			const __m256i i = _mm256_cvtps_epi32(reg);
+			const __m128i w = _mm_packs_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1));
+			_mm_storel_epi64(static_cast<__m128i*>(data), _mm_packus_epi16(w, w));
+		}
+
+
+	private:
+		furud_inline static __m256i PartialMask(const size_t& count) noexcept
+		{
+			return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int32_t>(count)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+		}
+
+
 	public:
 		//****************************************************************
 		// @brief    Creates a four-part mask through elements comparison from each Vec8f.
@@ -249,6 +363,28 @@ export namespace Furud
 		furud_inline friend Vec8f furud_vectorapi Max(const Vec8f& lhs, const Vec8f& rhs) noexcept { return _mm256_max_ps(lhs.reg, rhs.reg); }
 
 
+	public:
+		/**
+		 * @brief    Fused multiply-add with a single rounding.
+		 * @return   Vec8f( lhs.x * mhs.x + rhs.x, same for the others )
+		 * @details  乘加。
+		 */
+		furud_inline friend Vec8f furud_vectorapi MulAdd(const Vec8f& lhs, const Vec8f& mhs, const Vec8f& rhs) noexcept
+		{
+			return _mm256_fmadd_ps(lhs.reg, mhs.reg, rhs.reg);
+		}
+
+		/**
+		 * @brief    Does a bitwise Vec8f selection based on a mask.
+		 * @return   Vec8f( (mask.x & 0x80000000) ? lhs.x : rhs.x, same for the others )
+		 * @details  选择向量元素。
+		 */
+		furud_inline friend Vec8f furud_vectorapi Select(const Vec8f& mask, const Vec8f& lhs, const Vec8f& rhs) noexcept
+		{
+			return _mm256_blendv_ps(rhs.reg, lhs.reg, mask.reg);
+		}
+
+
 	public:
 		/**
 		 * @brief    Computes the square roots.
@@ -258,11 +394,18 @@ export namespace Furud
 		furud_inline Vec8f furud_vectorapi Sqrt() const noexcept { return _mm256_sqrt_ps(reg); }
 
 		/**
-		 * @brief    Computes the reciprocal square roots.
+		 * @brief    Computes the reciprocal square roots, 12-bit estimates unless FURUD_SIMD_STRICT_IEEE.
 		 * @return   Vec8f( sqrt(x), same for yzw )
 		 * @details  平方根倒数。
 		 */
-		furud_inline Vec8f furud_vectorapi RecipSqrt() const noexcept { return _mm256_rsqrt_ps(reg); }
+		furud_inline Vec8f furud_vectorapi RecipSqrt() const noexcept
+		{
+#if FURUD_SIMD_STRICT_IEEE
+			return _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(reg));
+#else
+			return _mm256_rsqrt_ps(reg);
+#endif
+		}
 
 		/**
 		 * @brief    Computes the squares.
@@ -272,11 +415,18 @@ export namespace Furud
 		furud_inline Vec8f furud_vectorapi Squares() const noexcept { return _mm256_mul_ps(reg, reg); }
 
 		/*
-		 * @brief    Computes the approximations of reciprocals.
+		 * @brief    Computes the approximations of reciprocals, exact under FURUD_SIMD_STRICT_IEEE.
 		 * @return   Vec8f( 1 / reg1.x, same for yzw )
 		 * @details  倒数。
 		 */
-		furud_inline Vec8f furud_vectorapi Reciprocal() const noexcept { return _mm256_rcp_ps(reg); }
+		furud_inline Vec8f furud_vectorapi Reciprocal() const noexcept
+		{
+#if FURUD_SIMD_STRICT_IEEE
+			return _mm256_div_ps(_mm256_set1_ps(1.f), reg);
+#else
+			return _mm256_rcp_ps(reg);
+#endif
+		}
 
 		/**
 		 * @brief    Returns the absolute value.
@@ -289,6 +439,60 @@ export namespace Furud
 			return _mm256_and_ps(reg, SIGN_MASK);
 		}
 
+		/**
+		 * @brief    Rearranges the elements of both 4-element halves with the same pattern.
+		 * @return   Vec8f( r[i], r[j], r[k], r[l], r[4 + i], r[4 + j], r[4 + k], r[4 + l] )
+		 * @details  交换向量元素位置（前后四个元素各自交换）。
+		 */
+		template<uint32_t i, uint32_t j, uint32_t k, uint32_t l>
+		furud_inline Vec8f furud_vectorapi Swizzle() const noexcept
+		{
+			constexpr int32_t v = i | (j << 2) | (k << 4) | (l << 6);
+			return _mm256_permute_ps(reg, v);
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Transcendental functions, evaluated for each element.
+		//           The precise ones stay within 2.5 ulp of the C library and keep its special values.
+		//           The fast ones trade accuracy and special values for speed.
+		// @return   Vec8f( f(value.x0), same for the others )
+		// @details  超越函数。
+		//****************************************************************
+
+		furud_inline friend Vec8f furud_vectorapi Sin(const Vec8f& value) noexcept { return Internal::SimdSin<__m256, true>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi Cos(const Vec8f& value) noexcept { return Internal::SimdCos<__m256, true>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi Exp(const Vec8f& value) noexcept { return Internal::SimdExp<__m256, true>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi Exp2(const Vec8f& value) noexcept { return Internal::SimdExp2<__m256, true>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi Log(const Vec8f& value) noexcept { return Internal::SimdLog<__m256, true>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi Log2(const Vec8f& value) noexcept { return Internal::SimdLog2<__m256, true>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi Pow(const Vec8f& lhs, const Vec8f& rhs) noexcept { return Internal::SimdPow<__m256, true>(lhs.reg, rhs.reg); }
+		furud_inline friend Vec8f furud_vectorapi Atan2(const Vec8f& y, const Vec8f& x) noexcept { return Internal::SimdAtan2<__m256, true>(y.reg, x.reg); }
+
+		furud_inline friend Vec8f furud_vectorapi FastSin(const Vec8f& value) noexcept { return Internal::SimdSin<__m256, false>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi FastCos(const Vec8f& value) noexcept { return Internal::SimdCos<__m256, false>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi FastExp(const Vec8f& value) noexcept { return Internal::SimdExp<__m256, false>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi FastExp2(const Vec8f& value) noexcept { return Internal::SimdExp2<__m256, false>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi FastLog(const Vec8f& value) noexcept { return Internal::SimdLog<__m256, false>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi FastLog2(const Vec8f& value) noexcept { return Internal::SimdLog2<__m256, false>(value.reg); }
+		furud_inline friend Vec8f furud_vectorapi FastPow(const Vec8f& lhs, const Vec8f& rhs) noexcept { return Internal::SimdPow<__m256, false>(lhs.reg, rhs.reg); }
+		furud_inline friend Vec8f furud_vectorapi FastAtan2(const Vec8f& y, const Vec8f& x) noexcept { return Internal::SimdAtan2<__m256, false>(y.reg, x.reg); }
+
+		/**
+		 * @brief    Computes the sine and cosine together, sharing the range reduction.
+		 * @details  同时计算正弦与余弦。
+		 */
+		furud_inline friend void furud_vectorapi SinCos(const Vec8f& value, Vec8f& outSin, Vec8f& outCos) noexcept
+		{
+			Internal::SimdSinCos<__m256, true>(value.reg, outSin.reg, outCos.reg);
+		}
+
+		furud_inline friend void furud_vectorapi FastSinCos(const Vec8f& value, Vec8f& outSin, Vec8f& outCos) noexcept
+		{
+			Internal::SimdSinCos<__m256, false>(value.reg, outSin.reg, outCos.reg);
+		}
+
 
 	public:
 		//****************************************************************
@@ -320,5 +524,131 @@ export namespace Furud
 		{
 			return _mm256_or_ps(_mm256_and_ps(SIGN_BIT, sign.reg), _mm256_andnot_ps(SIGN_BIT, value.reg));
 		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Transposes 8 packed xyz(w) vectors (AoS) into one Vec8f per component (SoA), and back.
+		//           `data` holds 24 (or 32) floats and needs no alignment.
+		// @details  数组结构与结构数组互转。
+		//****************************************************************
+
+		furud_inline friend void furud_vectorapi LoadDeinterleave3(const float* data, Vec8f& x, Vec8f& y, Vec8f& z) noexcept
+		{
+			// Lane 0 holds vectors 0-3, lane 1 holds vectors 4-7.
+			__m256 m03 = _mm256_castps128_ps256(_mm_loadu_ps(data + 0));
+			__m256 m14 = _mm256_castps128_ps256(_mm_loadu_ps(data + 4));
+			__m256 m25 = _mm256_castps128_ps256(_mm_loadu_ps(data + 8));
+			m03 = _mm256_insertf128_ps(m03, _mm_loadu_ps(data + 12), 1);
+			m14 = _mm256_insertf128_ps(m14, _mm_loadu_ps(data + 16), 1);
+			m25 = _mm256_insertf128_ps(m25, _mm_loadu_ps(data + 20), 1);
+
+			const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+			const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+			x.reg = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+			y.reg = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+			z.reg = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+		}
+
+		furud_inline friend void furud_vectorapi LoadDeinterleave4(const float* data, Vec8f& x, Vec8f& y, Vec8f& z, Vec8f& w) noexcept
+		{
+			const __m256 m04 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data + 0)), _mm_loadu_ps(data + 16), 1);
+			const __m256 m15 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data + 4)), _mm_loadu_ps(data + 20), 1);
+			const __m256 m26 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data + 8)), _mm_loadu_ps(data + 24), 1);
+			const __m256 m37 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data + 12)), _mm_loadu_ps(data + 28), 1);
+
+			const __m256 t0 = _mm256_unpacklo_ps(m04, m15);
+			const __m256 t1 = _mm256_unpacklo_ps(m26, m37);
+			const __m256 t2 = _mm256_unpackhi_ps(m04, m15);
+			const __m256 t3 = _mm256_unpackhi_ps(m26, m37);
+			x.reg = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+			y.reg = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+			z.reg = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			w.reg = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		furud_inline friend void furud_vectorapi StoreInterleave3(float* data, const Vec8f& x, const Vec8f& y, const Vec8f& z) noexcept
+		{
+			const __m256 xy = _mm256_shuffle_ps(x.reg, y.reg, _MM_SHUFFLE(2, 0, 2, 0));
+			const __m256 yz = _mm256_shuffle_ps(y.reg, z.reg, _MM_SHUFFLE(3, 1, 3, 1));
+			const __m256 zx = _mm256_shuffle_ps(z.reg, x.reg, _MM_SHUFFLE(3, 1, 2, 0));
+			const __m256 m03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+			const __m256 m14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+			const __m256 m25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+
+			_mm_storeu_ps(data + 0, _mm256_castps256_ps128(m03));
+			_mm_storeu_ps(data + 4, _mm256_castps256_ps128(m14));
+			_mm_storeu_ps(data + 8, _mm256_castps256_ps128(m25));
+			_mm_storeu_ps(data + 12, _mm256_extractf128_ps(m03, 1));
+			_mm_storeu_ps(data + 16, _mm256_extractf128_ps(m14, 1));
+			_mm_storeu_ps(data + 20, _mm256_extractf128_ps(m25, 1));
+		}
+
+		furud_inline friend void furud_vectorapi StoreInterleave4(float* data, const Vec8f& x, const Vec8f& y, const Vec8f& z, const Vec8f& w) noexcept
+		{
+			const __m256 t0 = _mm256_unpacklo_ps(x.reg, y.reg);
+			const __m256 t1 = _mm256_unpacklo_ps(z.reg, w.reg);
+			const __m256 t2 = _mm256_unpackhi_ps(x.reg, y.reg);
+			const __m256 t3 = _mm256_unpackhi_ps(z.reg, w.reg);
+			const __m256 m04 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m256 m15 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+			const __m256 m26 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			const __m256 m37 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+
+			_mm_storeu_ps(data + 0, _mm256_castps256_ps128(m04));
+			_mm_storeu_ps(data + 4, _mm256_castps256_ps128(m15));
+			_mm_storeu_ps(data + 8, _mm256_castps256_ps128(m26));
+			_mm_storeu_ps(data + 12, _mm256_castps256_ps128(m37));
+			_mm_storeu_ps(data + 16, _mm256_extractf128_ps(m04, 1));
+			_mm_storeu_ps(data + 20, _mm256_extractf128_ps(m15, 1));
+			_mm_storeu_ps(data + 24, _mm256_extractf128_ps(m26, 1));
+			_mm_storeu_ps(data + 28, _mm256_extractf128_ps(m37, 1));
+		}
+
+
+	public:
+		//****************************************************************
+		// @brief    Converts between two Vec8f and 8 interleaved ( x, y ) integer pairs, e.g. packed normals.
+		//           Stores round to nearest and saturate, loads are exact.
+		// @details  整型二元组交错加载/存储。
+		//****************************************************************
+
+		furud_inline friend void furud_vectorapi LoadDeinterleaveInt16(const void* data, Vec8f& x, Vec8f& y) noexcept
+		{
+			// Each 32-bit word is ( y << 16 | x ).
+			const __m256i xy = _mm256_loadu_si256(static_cast<const __m256i*>(data));
+			x.reg = _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(xy, 16), 16));
+			y.reg = _mm256_cvtepi32_ps(_mm256_srai_epi32(xy, 16));
+		}
+
+		furud_inline friend void furud_vectorapi LoadDeinterleaveInt8(const void* data, Vec8f& x, Vec8f& y) noexcept
+		{
+			// Each 16-bit word is ( y << 8 | x ), sign-extended to 32-bit.
+			const __m256i xy = _mm256_cvtepi16_epi32(_mm_loadu_si128(static_cast<const __m128i*>(data)));
+			x.reg = _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(xy, 24), 24));
+			y.reg = _mm256_cvtepi32_ps(_mm256_srai_epi32(xy, 8));
+		}
+
+		furud_inline friend void furud_vectorapi StoreInterleaveInt16(void* data, const Vec8f& x, const Vec8f& y) noexcept
+		{
+			// Each 128-bit lane packs to ( x0 x1 x2 x3 y0 y1 y2 y3 ), then the words are interleaved in place.
+			const __m256i packed = _mm256_packs_epi32(_mm256_cvtps_epi32(x.reg), _mm256_cvtps_epi32(y.reg));
+			const __m256i order = _mm256_setr_epi8(
+				0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+				0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+			_mm256_storeu_si256(static_cast<__m256i*>(data), _mm256_shuffle_epi8(packed, order));
+		}
+
+		furud_inline friend void furud_vectorapi StoreInterleaveInt8(void* data, const Vec8f& x, const Vec8f& y) noexcept
+		{
+			// Each 128-bit lane packs to ( x0 x1 x2 x3 y0 y1 y2 y3 ) in its low 8 bytes, interleave them and join the lanes.
+			const __m256i words = _mm256_packs_epi32(_mm256_cvtps_epi32(x.reg), _mm256_cvtps_epi32(y.reg));
+			const __m256i bytes = _mm256_packs_epi16(words, words);
+			const __m256i order = _mm256_setr_epi8(
+				0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15,
+				0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15);
+			const __m256i joined = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(bytes, order), _MM_SHUFFLE(3, 1, 2, 0));
+			_mm_storeu_si128(static_cast<__m128i*>(data), _mm256_castsi256_si128(joined));
+		}
 	};
 }
\ No newline at end of file
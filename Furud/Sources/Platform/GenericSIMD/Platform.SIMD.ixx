@@ -8,6 +8,9 @@
 //
 export module Furud.Platform.SIMD;
 
+export import :Dispatch;
+export import :Transcendental;
 export import :Vec4;
 export import :Vec8;
+export import :Vec16;
 export import :Mat44;
\ No newline at end of file
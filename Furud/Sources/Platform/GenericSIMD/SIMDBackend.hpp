@@ -0,0 +1,123 @@
+//
+// SIMDBackend.hpp
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Register backend of Furud.Platform.SIMD.
+//
+#pragma once
+
+#include <Furud.hpp>
+#include <stdint.h>
+#include <bit>
+
+// x86 intrinsics, or the same intrinsics emulated with vector extensions (see FURUD_SIMD_PORTABLE).
+#if FURUD_SIMD_PORTABLE
+#include "SIMDPortable.hpp"
+#else
+#include <immintrin.h>
+#endif
+
+
+
+/**
+ * Compile-time register constants.
+ * msvc registers are unions, so the lanes are written one by one. gcc/clang registers are vector types
+ * (on both backends), which std::bit_cast can build in a constant expression.
+ */
+namespace Furud::Internal
+{
+#if FURUD_OS_WIN
+	consteval __m128i Construct4i(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
+	{
+		__m128i result;
+		result.m128i_u32[0] = x;
+		result.m128i_u32[1] = y;
+		result.m128i_u32[2] = z;
+		result.m128i_u32[3] = w;
+		return result;
+	}
+
+	consteval __m128 Construct4f(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
+	{
+		__m128 result;
+		result.m128_u32[0] = x;
+		result.m128_u32[1] = y;
+		result.m128_u32[2] = z;
+		result.m128_u32[3] = w;
+		return result;
+	}
+
+	consteval __m128 Construct4f(float x, float y, float z, float w)
+	{
+		__m128 result;
+		result.m128_f32[0] = x;
+		result.m128_f32[1] = y;
+		result.m128_f32[2] = z;
+		result.m128_f32[3] = w;
+		return result;
+	}
+
+	consteval __m256 Construct8f(uint32_t x)
+	{
+		__m256 result;
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			result.m256_f32[i] = std::bit_cast<float>(x);
+		}
+		return result;
+	}
+#else
+	struct Lanes4
+	{
+		uint32_t values[4];
+	};
+
+	struct Lanes8
+	{
+		uint32_t values[8];
+	};
+
+	consteval __m128i Construct4i(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
+	{
+		return std::bit_cast<__m128i>(Lanes4{ { x, y, z, w } });
+	}
+
+	consteval __m128 Construct4f(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
+	{
+		return std::bit_cast<__m128>(Lanes4{ { x, y, z, w } });
+	}
+
+	consteval __m128 Construct4f(float x, float y, float z, float w)
+	{
+		return std::bit_cast<__m128>(Lanes4{ { std::bit_cast<uint32_t>(x), std::bit_cast<uint32_t>(y), std::bit_cast<uint32_t>(z), std::bit_cast<uint32_t>(w) } });
+	}
+
+	consteval __m256 Construct8f(uint32_t x)
+	{
+		return std::bit_cast<__m256>(Lanes8{ { x, x, x, x, x, x, x, x } });
+	}
+#endif
+
+
+	consteval __m128i Construct4i(uint32_t x)
+	{
+		return Construct4i(x, x, x, x);
+	}
+
+	consteval __m128 Construct4f(uint32_t x)
+	{
+		return Construct4f(x, x, x, x);
+	}
+
+	consteval __m128 Construct4f(float x)
+	{
+		return Construct4f(x, x, x, x);
+	}
+
+	consteval __m256 Construct8f(float x)
+	{
+		return Construct8f(std::bit_cast<uint32_t>(x));
+	}
+}
@@ -0,0 +1,1018 @@
+//
+// SIMDPortable.hpp
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Portable simd backend, the x86 intrinsics used by Furud.Platform.SIMD rewritten with gcc/clang vector extensions.
+//
+#pragma once
+
+#include <Furud.hpp>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <limits>
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "[Furud] the portable simd backend requires gcc/clang vector extensions!"
+#endif
+
+
+
+/**
+ * Every function below reproduces the lane semantics of the x86 intrinsic with the same name,
+ * including nan handling of min/max, saturation of packs and the out-of-range result 0x80000000
+ * of float-to-int conversions, so Vec4f/Vec8f/Mat44f give identical bits on both backends.
+ * Exceptions: _mm_rcp_ps/_mm_rsqrt_ps (and the 256-bit ones) are exact here, they are estimates on x86,
+ * and the sign/payload of a nan result is not reproduced (the lanes are nan on both backends).
+ *
+ * The element-wise operators lower to NEON on aarch64, shuffles and conversions are written lane by lane.
+ */
+namespace Furud::Internal
+{
+	typedef float    F32x4 __attribute__((vector_size(16)));
+	typedef double   F64x2 __attribute__((vector_size(16)));
+	typedef int64_t  I64x2 __attribute__((vector_size(16)));
+	typedef uint64_t U64x2 __attribute__((vector_size(16)));
+	typedef int32_t  I32x4 __attribute__((vector_size(16)));
+	typedef uint32_t U32x4 __attribute__((vector_size(16)));
+	typedef int16_t  I16x8 __attribute__((vector_size(16)));
+	typedef uint16_t U16x8 __attribute__((vector_size(16)));
+	typedef int8_t   I8x16 __attribute__((vector_size(16)));
+	typedef uint8_t  U8x16 __attribute__((vector_size(16)));
+
+	typedef float    F32x8 __attribute__((vector_size(32)));
+	typedef double   F64x4 __attribute__((vector_size(32)));
+	typedef int64_t  I64x4 __attribute__((vector_size(32)));
+	typedef uint64_t U64x4 __attribute__((vector_size(32)));
+	typedef int32_t  I32x8 __attribute__((vector_size(32)));
+	typedef uint32_t U32x8 __attribute__((vector_size(32)));
+	typedef int16_t  I16x16 __attribute__((vector_size(32)));
+	typedef int8_t   I8x32 __attribute__((vector_size(32)));
+	typedef uint8_t  U8x32 __attribute__((vector_size(32)));
+}
+
+
+
+namespace Furud
+{
+	typedef float     __m128  __attribute__((vector_size(16), aligned(16), may_alias));
+	typedef double    __m128d __attribute__((vector_size(16), aligned(16), may_alias));
+	typedef long long __m128i __attribute__((vector_size(16), aligned(16), may_alias));
+	typedef float     __m256  __attribute__((vector_size(32), aligned(32), may_alias));
+	typedef double    __m256d __attribute__((vector_size(32), aligned(32), may_alias));
+	typedef long long __m256i __attribute__((vector_size(32), aligned(32), may_alias));
+}
+
+
+
+#ifndef _MM_SHUFFLE
+#define _MM_SHUFFLE(z, y, x, w) (((z) << 6) | ((y) << 4) | ((x) << 2) | (w))
+#endif
+
+#define _MM_FROUND_TO_NEAREST_INT 0x00
+#define _MM_FROUND_TO_NEG_INF     0x01
+#define _MM_FROUND_TO_POS_INF     0x02
+#define _MM_FROUND_TO_ZERO        0x03
+#define _MM_FROUND_CUR_DIRECTION  0x04
+#define _MM_FROUND_RAISE_EXC      0x00
+#define _MM_FROUND_NO_EXC         0x08
+#define _MM_FROUND_NINT           (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_FLOOR          (_MM_FROUND_TO_NEG_INF | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_CEIL           (_MM_FROUND_TO_POS_INF | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_TRUNC          (_MM_FROUND_TO_ZERO | _MM_FROUND_RAISE_EXC)
+
+#define _CMP_EQ_OQ    0x00
+#define _CMP_LT_OS    0x01
+#define _CMP_LE_OS    0x02
+#define _CMP_UNORD_Q  0x03
+#define _CMP_NEQ_UQ   0x04
+#define _CMP_NLT_US   0x05
+#define _CMP_NLE_US   0x06
+#define _CMP_ORD_Q    0x07
+#define _CMP_EQ_UQ    0x08
+#define _CMP_NGE_US   0x09
+#define _CMP_NGT_US   0x0a
+#define _CMP_FALSE_OQ 0x0b
+#define _CMP_NEQ_OQ   0x0c
+#define _CMP_GE_OS    0x0d
+#define _CMP_GT_OS    0x0e
+#define _CMP_TRUE_UQ  0x0f
+#define _CMP_EQ_OS    0x10
+#define _CMP_LT_OQ    0x11
+#define _CMP_LE_OQ    0x12
+#define _CMP_UNORD_S  0x13
+#define _CMP_NEQ_US   0x14
+#define _CMP_NLT_UQ   0x15
+#define _CMP_NLE_UQ   0x16
+#define _CMP_ORD_S    0x17
+#define _CMP_EQ_US    0x18
+#define _CMP_NGE_UQ   0x19
+#define _CMP_NGT_UQ   0x1a
+#define _CMP_FALSE_OS 0x1b
+#define _CMP_NEQ_OS   0x1c
+#define _CMP_GE_OQ    0x1d
+#define _CMP_GT_OQ    0x1e
+#define _CMP_TRUE_US  0x1f
+
+#define _MM_EXTRACT_FLOAT(dst, src, index) ((dst) = (src)[(index) & 3])
+
+#define _MM_TRANSPOSE4_PS(row0, row1, row2, row3) ::Furud::Internal::Transpose4(row0, row1, row2, row3)
+
+
+
+/** Lane helpers. */
+namespace Furud::Internal
+{
+	/** Returns ( mask ? lhs : rhs ) bit by bit. */
+	template <typename TMask, typename TVector>
+	furud_inline TVector BitSelect(TMask mask, TVector lhs, TVector rhs) noexcept
+	{
+		return (TVector)(((TMask)lhs & mask) | ((TMask)rhs & ~mask));
+	}
+
+	/** Compares by the predicate of _mm_cmp_ps, the bit 4 (signaling or quiet) only affects exceptions. */
+	template <typename TMask, typename TVector>
+	furud_inline TMask CompareLanes(TVector a, TVector b, int predicate) noexcept
+	{
+		const TMask unordered = (TMask)(a != a) | (TMask)(b != b);
+		switch (predicate & 0x0f)
+		{
+		case _CMP_EQ_OQ:    return (TMask)(a == b);
+		case _CMP_LT_OS:    return (TMask)(a < b);
+		case _CMP_LE_OS:    return (TMask)(a <= b);
+		case _CMP_UNORD_Q:  return unordered;
+		case _CMP_NEQ_UQ:   return (TMask)(a != b);
+		case _CMP_NLT_US:   return ~(TMask)(a < b);
+		case _CMP_NLE_US:   return ~(TMask)(a <= b);
+		case _CMP_ORD_Q:    return ~unordered;
+		case _CMP_EQ_UQ:    return (TMask)(a == b) | unordered;
+		case _CMP_NGE_US:   return ~(TMask)(a >= b);
+		case _CMP_NGT_US:   return ~(TMask)(a > b);
+		case _CMP_FALSE_OQ: return TMask{};
+		case _CMP_NEQ_OQ:   return (TMask)(a != b) & ~unordered;
+		case _CMP_GE_OS:    return (TMask)(a >= b);
+		case _CMP_GT_OS:    return (TMask)(a > b);
+		default:            return ~TMask{};
+		}
+	}
+
+	/** Rounds by the immediate of _mm_round_ps. */
+	furud_inline float RoundLane(float value, int mode) noexcept
+	{
+		if (mode & _MM_FROUND_CUR_DIRECTION)
+		{
+			return __builtin_nearbyintf(value);
+		}
+		switch (mode & 0x03)
+		{
+		case _MM_FROUND_TO_NEAREST_INT: return __builtin_roundevenf(value);
+		case _MM_FROUND_TO_NEG_INF:     return __builtin_floorf(value);
+		case _MM_FROUND_TO_POS_INF:     return __builtin_ceilf(value);
+		default:                        return __builtin_truncf(value);
+		}
+	}
+
+	furud_inline double RoundLane(double value, int mode) noexcept
+	{
+		if (mode & _MM_FROUND_CUR_DIRECTION)
+		{
+			return __builtin_nearbyint(value);
+		}
+		switch (mode & 0x03)
+		{
+		case _MM_FROUND_TO_NEAREST_INT: return __builtin_roundeven(value);
+		case _MM_FROUND_TO_NEG_INF:     return __builtin_floor(value);
+		case _MM_FROUND_TO_POS_INF:     return __builtin_ceil(value);
+		default:                        return __builtin_trunc(value);
+		}
+	}
+
+	/** cvtps2dq: rounds with the current rounding mode, nan or out of range gives 0x80000000. */
+	furud_inline int32_t ConvertLane(float value) noexcept
+	{
+		return (value >= -2147483648.f && value < 2147483648.f) ? (int32_t)__builtin_nearbyintf(value) : INT32_MIN;
+	}
+
+	/** cvttps2dq / cvttpd2dq: truncates, nan or out of range gives 0x80000000. */
+	furud_inline int32_t TruncateLane(double value) noexcept
+	{
+		return (value > -2147483649.0 && value < 2147483648.0) ? (int32_t)value : INT32_MIN;
+	}
+
+	template <typename TFrom, typename TTo>
+	furud_inline TTo SaturateLane(TFrom value) noexcept
+	{
+		constexpr TFrom lo = std::numeric_limits<TTo>::min();
+		constexpr TFrom hi = std::numeric_limits<TTo>::max();
+		return (TTo)(value < lo ? lo : (value > hi ? hi : value));
+	}
+
+	/** vcvtps2ph with round-to-nearest-even, nans keep their top payload bits and become quiet. */
+	furud_inline uint16_t FloatToHalfLane(float value) noexcept
+	{
+		uint32_t x;
+		memcpy(&x, &value, sizeof(x));
+		const uint16_t sign = (uint16_t)((x >> 16) & 0x8000u);
+		x &= 0x7fffffffu;
+
+		if (x >= 0x7f800000u)
+		{
+			return sign | (x > 0x7f800000u ? (uint16_t)(0x7e00u | ((x >> 13) & 0x3ffu)) : (uint16_t)0x7c00u);
+		}
+		if (x >= 0x477ff000u)
+		{
+			return sign | 0x7c00u;
+		}
+		if (x >= 0x38800000u)
+		{
+			x += 0xc8000fffu + ((x >> 13) & 1u);
+			return sign | (uint16_t)(x >> 13);
+		}
+		if (x <= 0x33000000u)
+		{
+			return sign;
+		}
+
+		const uint32_t shift = 126u - (x >> 23);
+		const uint32_t mantissa = (x & 0x7fffffu) | 0x800000u;
+		const uint32_t halfway = 1u << (shift - 1);
+		const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+		uint32_t result = mantissa >> shift;
+		if (remainder > halfway || (remainder == halfway && (result & 1u)))
+		{
+			++result;
+		}
+		return sign | (uint16_t)result;
+	}
+
+	/** vcvtph2ps, exact, nans become quiet. */
+	furud_inline float HalfToFloatLane(uint16_t value) noexcept
+	{
+		const uint32_t sign = (uint32_t)(value & 0x8000u) << 16;
+		uint32_t exponent = (value >> 10) & 0x1fu;
+		uint32_t mantissa = value & 0x3ffu;
+
+		uint32_t x;
+		if (exponent == 0x1fu)
+		{
+			x = sign | 0x7f800000u | (mantissa ? (0x400000u | (mantissa << 13)) : 0u);
+		}
+		else if (exponent != 0)
+		{
+			x = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+		}
+		else if (mantissa == 0)
+		{
+			x = sign;
+		}
+		else
+		{
+			exponent = 113u;
+			while ((mantissa & 0x400u) == 0)
+			{
+				mantissa <<= 1;
+				--exponent;
+			}
+			x = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+		}
+
+		float result;
+		memcpy(&result, &x, sizeof(result));
+		return result;
+	}
+}
+
+
+
+namespace Furud
+{
+	//****************************************************************
+	// @brief    Casts.
+	// @details  类型转换。
+	//****************************************************************
+
+	furud_inline __m128i _mm_castps_si128(__m128 a) noexcept { return (__m128i)a; }
+	furud_inline __m128 _mm_castsi128_ps(__m128i a) noexcept { return (__m128)a; }
+	furud_inline __m256i _mm256_castps_si256(__m256 a) noexcept { return (__m256i)a; }
+	furud_inline __m256 _mm256_castsi256_ps(__m256i a) noexcept { return (__m256)a; }
+	furud_inline __m128i _mm_castpd_si128(__m128d a) noexcept { return (__m128i)a; }
+	furud_inline __m128d _mm_castsi128_pd(__m128i a) noexcept { return (__m128d)a; }
+	furud_inline __m256i _mm256_castpd_si256(__m256d a) noexcept { return (__m256i)a; }
+	furud_inline __m256d _mm256_castsi256_pd(__m256i a) noexcept { return (__m256d)a; }
+
+	furud_inline __m128 _mm256_castps256_ps128(__m256 a) noexcept { return __m128{ a[0], a[1], a[2], a[3] }; }
+	furud_inline __m128i _mm256_castsi256_si128(__m256i a) noexcept { return __m128i{ a[0], a[1] }; }
+	furud_inline __m256 _mm256_castps128_ps256(__m128 a) noexcept { return __m256{ a[0], a[1], a[2], a[3], 0.f, 0.f, 0.f, 0.f }; }
+
+	furud_inline __m128 _mm256_extractf128_ps(__m256 a, int index) noexcept
+	{
+		const int base = (index & 1) * 4;
+		return __m128{ a[base + 0], a[base + 1], a[base + 2], a[base + 3] };
+	}
+
+	furud_inline __m128i _mm256_extracti128_si256(__m256i a, int index) noexcept
+	{
+		const int base = (index & 1) * 2;
+		return __m128i{ a[base + 0], a[base + 1] };
+	}
+
+	furud_inline __m256 _mm256_insertf128_ps(__m256 a, __m128 b, int index) noexcept
+	{
+		const int base = (index & 1) * 4;
+		a[base + 0] = b[0];
+		a[base + 1] = b[1];
+		a[base + 2] = b[2];
+		a[base + 3] = b[3];
+		return a;
+	}
+
+
+
+	//****************************************************************
+	// @brief    Sets.
+	// @details  赋值。
+	//****************************************************************
+
+	furud_inline __m128 _mm_setzero_ps() noexcept { return __m128{}; }
+	furud_inline __m128 _mm_set1_ps(float a) noexcept { return __m128{ a, a, a, a }; }
+	furud_inline __m128 _mm_set_ps1(float a) noexcept { return __m128{ a, a, a, a }; }
+	furud_inline __m128 _mm_setr_ps(float x, float y, float z, float w) noexcept { return __m128{ x, y, z, w }; }
+	furud_inline __m128i _mm_setzero_si128() noexcept { return __m128i{}; }
+	furud_inline __m128i _mm_set1_epi32(int a) noexcept { return (__m128i)Internal::I32x4{ a, a, a, a }; }
+	furud_inline __m128i _mm_setr_epi32(int x, int y, int z, int w) noexcept { return (__m128i)Internal::I32x4{ x, y, z, w }; }
+	furud_inline __m128i _mm_set1_epi64x(long long a) noexcept { return __m128i{ a, a }; }
+	furud_inline __m128d _mm_set1_pd(double a) noexcept { return __m128d{ a, a }; }
+
+	furud_inline __m256 _mm256_set1_ps(float a) noexcept { return __m256{ a, a, a, a, a, a, a, a }; }
+	furud_inline __m256d _mm256_set1_pd(double a) noexcept { return __m256d{ a, a, a, a }; }
+	furud_inline __m256d _mm256_setzero_pd() noexcept { return __m256d{}; }
+	furud_inline __m256i _mm256_set1_epi32(int a) noexcept { return (__m256i)Internal::I32x8{ a, a, a, a, a, a, a, a }; }
+	furud_inline __m256i _mm256_set1_epi64x(long long a) noexcept { return __m256i{ a, a, a, a }; }
+
+	furud_inline __m256 _mm256_setr_ps(float e0, float e1, float e2, float e3, float e4, float e5, float e6, float e7) noexcept
+	{
+		return __m256{ e0, e1, e2, e3, e4, e5, e6, e7 };
+	}
+
+	furud_inline __m256i _mm256_setr_epi32(int e0, int e1, int e2, int e3, int e4, int e5, int e6, int e7) noexcept
+	{
+		return (__m256i)Internal::I32x8{ e0, e1, e2, e3, e4, e5, e6, e7 };
+	}
+
+	furud_inline __m256i _mm256_setr_epi8(
+		char e00, char e01, char e02, char e03, char e04, char e05, char e06, char e07,
+		char e08, char e09, char e10, char e11, char e12, char e13, char e14, char e15,
+		char e16, char e17, char e18, char e19, char e20, char e21, char e22, char e23,
+		char e24, char e25, char e26, char e27, char e28, char e29, char e30, char e31) noexcept
+	{
+		return (__m256i)Internal::I8x32
+		{
+			(int8_t)e00, (int8_t)e01, (int8_t)e02, (int8_t)e03, (int8_t)e04, (int8_t)e05, (int8_t)e06, (int8_t)e07,
+			(int8_t)e08, (int8_t)e09, (int8_t)e10, (int8_t)e11, (int8_t)e12, (int8_t)e13, (int8_t)e14, (int8_t)e15,
+			(int8_t)e16, (int8_t)e17, (int8_t)e18, (int8_t)e19, (int8_t)e20, (int8_t)e21, (int8_t)e22, (int8_t)e23,
+			(int8_t)e24, (int8_t)e25, (int8_t)e26, (int8_t)e27, (int8_t)e28, (int8_t)e29, (int8_t)e30, (int8_t)e31
+		};
+	}
+
+	furud_inline __m256 _mm256_broadcast_ps(const __m128* p) noexcept
+	{
+		const __m128 a = *p;
+		return __m256{ a[0], a[1], a[2], a[3], a[0], a[1], a[2], a[3] };
+	}
+
+	furud_inline float _mm_cvtss_f32(__m128 a) noexcept { return a[0]; }
+
+
+
+	//****************************************************************
+	// @brief    Loads and stores, alignment is not checked.
+	// @details  加载/存储。
+	//****************************************************************
+
+	furud_inline __m128 _mm_load_ps(const float* p) noexcept { __m128 r; memcpy(&r, p, sizeof(r)); return r; }
+	furud_inline __m128 _mm_loadu_ps(const float* p) noexcept { __m128 r; memcpy(&r, p, sizeof(r)); return r; }
+	furud_inline void _mm_store_ps(float* p, __m128 a) noexcept { memcpy(p, &a, sizeof(a)); }
+	furud_inline void _mm_storeu_ps(float* p, __m128 a) noexcept { memcpy(p, &a, sizeof(a)); }
+
+	furud_inline __m128i _mm_load_si128(const __m128i* p) noexcept { __m128i r; memcpy(&r, p, sizeof(r)); return r; }
+	furud_inline __m128i _mm_loadu_si128(const __m128i* p) noexcept { __m128i r; memcpy(&r, p, sizeof(r)); return r; }
+	furud_inline void _mm_store_si128(__m128i* p, __m128i a) noexcept { memcpy(p, &a, sizeof(a)); }
+	furud_inline void _mm_storeu_si128(__m128i* p, __m128i a) noexcept { memcpy(p, &a, sizeof(a)); }
+	furud_inline __m128i _mm_loadl_epi64(const __m128i* p) noexcept { __m128i r{}; memcpy(&r, p, 8); return r; }
+	furud_inline void _mm_storel_epi64(__m128i* p, __m128i a) noexcept { memcpy(p, &a, 8); }
+
+	furud_inline __m256 _mm256_load_ps(const float* p) noexcept { __m256 r; memcpy(&r, p, sizeof(r)); return r; }
+	furud_inline __m256 _mm256_loadu_ps(const float* p) noexcept { __m256 r; memcpy(&r, p, sizeof(r)); return r; }
+	furud_inline void _mm256_store_ps(float* p, __m256 a) noexcept { memcpy(p, &a, sizeof(a)); }
+	furud_inline void _mm256_storeu_ps(float* p, __m256 a) noexcept { memcpy(p, &a, sizeof(a)); }
+	furud_inline __m256i _mm256_loadu_si256(const __m256i* p) noexcept { __m256i r; memcpy(&r, p, sizeof(r)); return r; }
+	furud_inline void _mm256_storeu_si256(__m256i* p, __m256i a) noexcept { memcpy(p, &a, sizeof(a)); }
+
+	/** Lanes whose mask sign bit is clear are neither read nor written. */
+	furud_inline __m256 _mm256_maskload_ps(const float* p, __m256i mask) noexcept
+	{
+		const Internal::I32x8 m = (Internal::I32x8)mask;
+		__m256 r{};
+		for (int i = 0; i < 8; ++i)
+		{
+			if (m[i] < 0)
+			{
+				r[i] = p[i];
+			}
+		}
+		return r;
+	}
+
+	furud_inline void _mm256_maskstore_ps(float* p, __m256i mask, __m256 a) noexcept
+	{
+		const Internal::I32x8 m = (Internal::I32x8)mask;
+		for (int i = 0; i < 8; ++i)
+		{
+			if (m[i] < 0)
+			{
+				p[i] = a[i];
+			}
+		}
+	}
+
+
+
+	//****************************************************************
+	// @brief    Float arithmetic.
+	// @details  浮点运算。
+	//****************************************************************
+
+	furud_inline __m128 _mm_add_ps(__m128 a, __m128 b) noexcept { return a + b; }
+	furud_inline __m128 _mm_sub_ps(__m128 a, __m128 b) noexcept { return a - b; }
+	furud_inline __m128 _mm_mul_ps(__m128 a, __m128 b) noexcept { return a * b; }
+	furud_inline __m128 _mm_div_ps(__m128 a, __m128 b) noexcept { return a / b; }
+	furud_inline __m256 _mm256_add_ps(__m256 a, __m256 b) noexcept { return a + b; }
+	furud_inline __m256 _mm256_sub_ps(__m256 a, __m256 b) noexcept { return a - b; }
+	furud_inline __m256 _mm256_mul_ps(__m256 a, __m256 b) noexcept { return a * b; }
+	furud_inline __m256 _mm256_div_ps(__m256 a, __m256 b) noexcept { return a / b; }
+	furud_inline __m128d _mm_add_pd(__m128d a, __m128d b) noexcept { return a + b; }
+	furud_inline __m128d _mm_sub_pd(__m128d a, __m128d b) noexcept { return a - b; }
+	furud_inline __m128d _mm_mul_pd(__m128d a, __m128d b) noexcept { return a * b; }
+	furud_inline __m128d _mm_div_pd(__m128d a, __m128d b) noexcept { return a / b; }
+	furud_inline __m256d _mm256_add_pd(__m256d a, __m256d b) noexcept { return a + b; }
+	furud_inline __m256d _mm256_sub_pd(__m256d a, __m256d b) noexcept { return a - b; }
+	furud_inline __m256d _mm256_mul_pd(__m256d a, __m256d b) noexcept { return a * b; }
+	furud_inline __m256d _mm256_div_pd(__m256d a, __m256d b) noexcept { return a / b; }
+
+	// min/max return the second operand when either one is nan, like minps/maxps.
+	furud_inline __m128 _mm_min_ps(__m128 a, __m128 b) noexcept { return Internal::BitSelect(a < b, a, b); }
+	furud_inline __m128 _mm_max_ps(__m128 a, __m128 b) noexcept { return Internal::BitSelect(a > b, a, b); }
+	furud_inline __m256 _mm256_min_ps(__m256 a, __m256 b) noexcept { return Internal::BitSelect(a < b, a, b); }
+	furud_inline __m256 _mm256_max_ps(__m256 a, __m256 b) noexcept { return Internal::BitSelect(a > b, a, b); }
+	furud_inline __m128d _mm_min_pd(__m128d a, __m128d b) noexcept { return Internal::BitSelect(a < b, a, b); }
+	furud_inline __m128d _mm_max_pd(__m128d a, __m128d b) noexcept { return Internal::BitSelect(a > b, a, b); }
+	furud_inline __m256d _mm256_min_pd(__m256d a, __m256d b) noexcept { return Internal::BitSelect(a < b, a, b); }
+	furud_inline __m256d _mm256_max_pd(__m256d a, __m256d b) noexcept { return Internal::BitSelect(a > b, a, b); }
+
+	furud_inline __m128 _mm_sqrt_ps(__m128 a) noexcept
+	{
+		for (int i = 0; i < 4; ++i) a[i] = __builtin_sqrtf(a[i]);
+		return a;
+	}
+
+	furud_inline __m256 _mm256_sqrt_ps(__m256 a) noexcept
+	{
+		for (int i = 0; i < 8; ++i) a[i] = __builtin_sqrtf(a[i]);
+		return a;
+	}
+
+	furud_inline __m128 _mm_rcp_ps(__m128 a) noexcept { return 1.f / a; }
+	furud_inline __m256 _mm256_rcp_ps(__m256 a) noexcept { return 1.f / a; }
+	furud_inline __m128 _mm_rsqrt_ps(__m128 a) noexcept { return 1.f / _mm_sqrt_ps(a); }
+	furud_inline __m256 _mm256_rsqrt_ps(__m256 a) noexcept { return 1.f / _mm256_sqrt_ps(a); }
+
+	furud_inline __m128 _mm_round_ps(__m128 a, int mode) noexcept
+	{
+		for (int i = 0; i < 4; ++i) a[i] = Internal::RoundLane(a[i], mode);
+		return a;
+	}
+
+	furud_inline __m256 _mm256_round_ps(__m256 a, int mode) noexcept
+	{
+		for (int i = 0; i < 8; ++i) a[i] = Internal::RoundLane(a[i], mode);
+		return a;
+	}
+
+	furud_inline __m128d _mm_round_pd(__m128d a, int mode) noexcept
+	{
+		for (int i = 0; i < 2; ++i) a[i] = Internal::RoundLane(a[i], mode);
+		return a;
+	}
+
+	furud_inline __m256d _mm256_round_pd(__m256d a, int mode) noexcept
+	{
+		for (int i = 0; i < 4; ++i) a[i] = Internal::RoundLane(a[i], mode);
+		return a;
+	}
+
+	/** { a0 + a1, a2 + a3, b0 + b1, b2 + b3 } */
+	furud_inline __m128 _mm_hadd_ps(__m128 a, __m128 b) noexcept
+	{
+		return __m128{ a[0] + a[1], a[2] + a[3], b[0] + b[1], b[2] + b[3] };
+	}
+
+	/** dpps: products rounded one by one, then summed as ( p0 + p1 ) + ( p2 + p3 ). */
+	furud_inline __m128 _mm_dp_ps(__m128 a, __m128 b, int mask) noexcept
+	{
+		__m128 products{};
+		for (int i = 0; i < 4; ++i)
+		{
+			if (mask & (0x10 << i))
+			{
+				products[i] = a[i] * b[i];
+			}
+		}
+		const float sum = (products[0] + products[1]) + (products[2] + products[3]);
+
+		__m128 r{};
+		for (int i = 0; i < 4; ++i)
+		{
+			if (mask & (1 << i))
+			{
+				r[i] = sum;
+			}
+		}
+		return r;
+	}
+
+
+
+	//****************************************************************
+	// @brief    Fused multiply-add, a single rounding like fma3.
+	// @details  乘加。
+	//****************************************************************
+
+	furud_inline __m128 _mm_fmadd_ps(__m128 a, __m128 b, __m128 c) noexcept
+	{
+		for (int i = 0; i < 4; ++i) a[i] = __builtin_fmaf(a[i], b[i], c[i]);
+		return a;
+	}
+
+	furud_inline __m128 _mm_fmsub_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fmadd_ps(a, b, -c); }
+	furud_inline __m128 _mm_fnmadd_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fmadd_ps(-a, b, c); }
+	furud_inline __m128 _mm_fnmsub_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fmadd_ps(-a, b, -c); }
+
+	furud_inline __m256 _mm256_fmadd_ps(__m256 a, __m256 b, __m256 c) noexcept
+	{
+		for (int i = 0; i < 8; ++i) a[i] = __builtin_fmaf(a[i], b[i], c[i]);
+		return a;
+	}
+
+	furud_inline __m256 _mm256_fnmadd_ps(__m256 a, __m256 b, __m256 c) noexcept { return _mm256_fmadd_ps(-a, b, c); }
+
+	furud_inline __m256d _mm256_fmadd_pd(__m256d a, __m256d b, __m256d c) noexcept
+	{
+		for (int i = 0; i < 4; ++i) a[i] = __builtin_fma(a[i], b[i], c[i]);
+		return a;
+	}
+
+
+
+	//****************************************************************
+	// @brief    Bitwise operations.
+	// @details  位运算。
+	//****************************************************************
+
+	furud_inline __m128 _mm_and_ps(__m128 a, __m128 b) noexcept { return (__m128)((__m128i)a & (__m128i)b); }
+	furud_inline __m128 _mm_andnot_ps(__m128 a, __m128 b) noexcept { return (__m128)(~(__m128i)a & (__m128i)b); }
+	furud_inline __m128 _mm_or_ps(__m128 a, __m128 b) noexcept { return (__m128)((__m128i)a | (__m128i)b); }
+	furud_inline __m128 _mm_xor_ps(__m128 a, __m128 b) noexcept { return (__m128)((__m128i)a ^ (__m128i)b); }
+	furud_inline __m128i _mm_and_si128(__m128i a, __m128i b) noexcept { return a & b; }
+	furud_inline __m128i _mm_andnot_si128(__m128i a, __m128i b) noexcept { return ~a & b; }
+	furud_inline __m128i _mm_or_si128(__m128i a, __m128i b) noexcept { return a | b; }
+	furud_inline __m128i _mm_xor_si128(__m128i a, __m128i b) noexcept { return a ^ b; }
+
+	furud_inline __m256 _mm256_and_ps(__m256 a, __m256 b) noexcept { return (__m256)((__m256i)a & (__m256i)b); }
+	furud_inline __m256 _mm256_andnot_ps(__m256 a, __m256 b) noexcept { return (__m256)(~(__m256i)a & (__m256i)b); }
+	furud_inline __m256 _mm256_or_ps(__m256 a, __m256 b) noexcept { return (__m256)((__m256i)a | (__m256i)b); }
+	furud_inline __m256 _mm256_xor_ps(__m256 a, __m256 b) noexcept { return (__m256)((__m256i)a ^ (__m256i)b); }
+	furud_inline __m128d _mm_and_pd(__m128d a, __m128d b) noexcept { return (__m128d)((__m128i)a & (__m128i)b); }
+	furud_inline __m256d _mm256_and_pd(__m256d a, __m256d b) noexcept { return (__m256d)((__m256i)a & (__m256i)b); }
+	furud_inline __m256i _mm256_and_si256(__m256i a, __m256i b) noexcept { return a & b; }
+	furud_inline __m256i _mm256_or_si256(__m256i a, __m256i b) noexcept { return a | b; }
+
+
+
+	//****************************************************************
+	// @brief    Comparisons, blends and sign masks.
+	// @details  比较与选择。
+	//****************************************************************
+
+	furud_inline __m128 _mm_cmpeq_ps(__m128 a, __m128 b) noexcept { return (__m128)(a == b); }
+	furud_inline __m128 _mm_cmpneq_ps(__m128 a, __m128 b) noexcept { return (__m128)(a != b); }
+	furud_inline __m128 _mm_cmplt_ps(__m128 a, __m128 b) noexcept { return (__m128)(a < b); }
+	furud_inline __m128 _mm_cmple_ps(__m128 a, __m128 b) noexcept { return (__m128)(a <= b); }
+	furud_inline __m128 _mm_cmpgt_ps(__m128 a, __m128 b) noexcept { return (__m128)(a > b); }
+	furud_inline __m128 _mm_cmpge_ps(__m128 a, __m128 b) noexcept { return (__m128)(a >= b); }
+	furud_inline __m128 _mm_cmpunord_ps(__m128 a, __m128 b) noexcept { return (__m128)((a != a) | (b != b)); }
+	furud_inline __m128d _mm_cmpeq_pd(__m128d a, __m128d b) noexcept { return (__m128d)(a == b); }
+	furud_inline __m128d _mm_cmpgt_pd(__m128d a, __m128d b) noexcept { return (__m128d)(a > b); }
+	furud_inline __m128d _mm_cmpnlt_pd(__m128d a, __m128d b) noexcept { return (__m128d)~(a < b); }
+
+	furud_inline __m256 _mm256_cmp_ps(__m256 a, __m256 b, int predicate) noexcept
+	{
+		return (__m256)Internal::CompareLanes<Internal::I32x8>(a, b, predicate);
+	}
+
+	furud_inline __m256d _mm256_cmp_pd(__m256d a, __m256d b, int predicate) noexcept
+	{
+		return (__m256d)Internal::CompareLanes<Internal::I64x4>(a, b, predicate);
+	}
+
+	furud_inline __m128i _mm_cmpeq_epi32(__m128i a, __m128i b) noexcept { return (__m128i)((Internal::I32x4)a == (Internal::I32x4)b); }
+	furud_inline __m128i _mm_cmpgt_epi32(__m128i a, __m128i b) noexcept { return (__m128i)((Internal::I32x4)a > (Internal::I32x4)b); }
+	furud_inline __m128i _mm_cmplt_epi32(__m128i a, __m128i b) noexcept { return (__m128i)((Internal::I32x4)a < (Internal::I32x4)b); }
+	furud_inline __m256i _mm256_cmpgt_epi32(__m256i a, __m256i b) noexcept { return (__m256i)((Internal::I32x8)a > (Internal::I32x8)b); }
+
+	/** Picks b where the sign bit of mask is set. */
+	furud_inline __m128 _mm_blendv_ps(__m128 a, __m128 b, __m128 mask) noexcept
+	{
+		return Internal::BitSelect((Internal::I32x4)mask < 0, b, a);
+	}
+
+	furud_inline __m256 _mm256_blendv_ps(__m256 a, __m256 b, __m256 mask) noexcept
+	{
+		return Internal::BitSelect((Internal::I32x8)mask < 0, b, a);
+	}
+
+	furud_inline __m128d _mm_blendv_pd(__m128d a, __m128d b, __m128d mask) noexcept
+	{
+		return Internal::BitSelect((Internal::I64x2)mask < 0, b, a);
+	}
+
+	furud_inline __m256d _mm256_blendv_pd(__m256d a, __m256d b, __m256d mask) noexcept
+	{
+		return Internal::BitSelect((Internal::I64x4)mask < 0, b, a);
+	}
+
+	furud_inline int _mm_movemask_ps(__m128 a) noexcept
+	{
+		const Internal::U32x4 bits = (Internal::U32x4)a >> 31;
+		return (int)(bits[0] | (bits[1] << 1) | (bits[2] << 2) | (bits[3] << 3));
+	}
+
+	furud_inline int _mm256_movemask_ps(__m256 a) noexcept
+	{
+		const Internal::U32x8 bits = (Internal::U32x8)a >> 31;
+		int r = 0;
+		for (int i = 0; i < 8; ++i) r |= (int)(bits[i] << i);
+		return r;
+	}
+
+
+
+	//****************************************************************
+	// @brief    Integer arithmetic, wrapping like the hardware.
+	// @details  整型运算。
+	//****************************************************************
+
+	furud_inline __m128i _mm_add_epi32(__m128i a, __m128i b) noexcept { return (__m128i)((Internal::U32x4)a + (Internal::U32x4)b); }
+	furud_inline __m128i _mm_sub_epi32(__m128i a, __m128i b) noexcept { return (__m128i)((Internal::U32x4)a - (Internal::U32x4)b); }
+	furud_inline __m128i _mm_mullo_epi32(__m128i a, __m128i b) noexcept { return (__m128i)((Internal::U32x4)a * (Internal::U32x4)b); }
+	furud_inline __m256i _mm256_add_epi32(__m256i a, __m256i b) noexcept { return (__m256i)((Internal::U32x8)a + (Internal::U32x8)b); }
+	furud_inline __m256i _mm256_sub_epi32(__m256i a, __m256i b) noexcept { return (__m256i)((Internal::U32x8)a - (Internal::U32x8)b); }
+	furud_inline __m128i _mm_add_epi64(__m128i a, __m128i b) noexcept { return (__m128i)((Internal::U64x2)a + (Internal::U64x2)b); }
+	furud_inline __m128i _mm_sub_epi64(__m128i a, __m128i b) noexcept { return (__m128i)((Internal::U64x2)a - (Internal::U64x2)b); }
+	furud_inline __m256i _mm256_add_epi64(__m256i a, __m256i b) noexcept { return (__m256i)((Internal::U64x4)a + (Internal::U64x4)b); }
+	furud_inline __m256i _mm256_sub_epi64(__m256i a, __m256i b) noexcept { return (__m256i)((Internal::U64x4)a - (Internal::U64x4)b); }
+
+	furud_inline __m128i _mm_min_epi32(__m128i a, __m128i b) noexcept
+	{
+		const Internal::I32x4 x = (Internal::I32x4)a, y = (Internal::I32x4)b;
+		return (__m128i)Internal::BitSelect(x < y, x, y);
+	}
+
+	furud_inline __m128i _mm_max_epi32(__m128i a, __m128i b) noexcept
+	{
+		const Internal::I32x4 x = (Internal::I32x4)a, y = (Internal::I32x4)b;
+		return (__m128i)Internal::BitSelect(x > y, x, y);
+	}
+
+	// Counts above the lane width give 0 (logical) or the sign fill (arithmetic), like the hardware.
+	furud_inline __m128i _mm_slli_epi32(__m128i a, int count) noexcept
+	{
+		return (unsigned)count > 31u ? __m128i{} : (__m128i)((Internal::U32x4)a << count);
+	}
+
+	furud_inline __m128i _mm_srli_epi32(__m128i a, int count) noexcept
+	{
+		return (unsigned)count > 31u ? __m128i{} : (__m128i)((Internal::U32x4)a >> count);
+	}
+
+	furud_inline __m128i _mm_srai_epi32(__m128i a, int count) noexcept
+	{
+		return (__m128i)((Internal::I32x4)a >> ((unsigned)count > 31u ? 31 : count));
+	}
+
+	furud_inline __m128i _mm_slli_epi64(__m128i a, int count) noexcept
+	{
+		return (unsigned)count > 63u ? __m128i{} : (__m128i)((Internal::U64x2)a << count);
+	}
+
+	furud_inline __m128i _mm_srli_epi64(__m128i a, int count) noexcept
+	{
+		return (unsigned)count > 63u ? __m128i{} : (__m128i)((Internal::U64x2)a >> count);
+	}
+
+	furud_inline __m256i _mm256_slli_epi32(__m256i a, int count) noexcept
+	{
+		return (unsigned)count > 31u ? __m256i{} : (__m256i)((Internal::U32x8)a << count);
+	}
+
+	furud_inline __m256i _mm256_srli_epi32(__m256i a, int count) noexcept
+	{
+		return (unsigned)count > 31u ? __m256i{} : (__m256i)((Internal::U32x8)a >> count);
+	}
+
+	furud_inline __m256i _mm256_srai_epi32(__m256i a, int count) noexcept
+	{
+		return (__m256i)((Internal::I32x8)a >> ((unsigned)count > 31u ? 31 : count));
+	}
+
+	furud_inline __m256i _mm256_slli_epi64(__m256i a, int count) noexcept
+	{
+		return (unsigned)count > 63u ? __m256i{} : (__m256i)((Internal::U64x4)a << count);
+	}
+
+	furud_inline __m256i _mm256_srli_epi64(__m256i a, int count) noexcept
+	{
+		return (unsigned)count > 63u ? __m256i{} : (__m256i)((Internal::U64x4)a >> count);
+	}
+
+
+
+	//****************************************************************
+	// @brief    Shuffles, 256-bit ones work inside each 128-bit half unless noted.
+	// @details  重排。
+	//****************************************************************
+
+	furud_inline __m128 _mm_shuffle_ps(__m128 a, __m128 b, int imm) noexcept
+	{
+		return __m128{ a[imm & 3], a[(imm >> 2) & 3], b[(imm >> 4) & 3], b[(imm >> 6) & 3] };
+	}
+
+	furud_inline __m128i _mm_shuffle_epi32(__m128i a, int imm) noexcept
+	{
+		const Internal::I32x4 x = (Internal::I32x4)a;
+		return (__m128i)Internal::I32x4{ x[imm & 3], x[(imm >> 2) & 3], x[(imm >> 4) & 3], x[(imm >> 6) & 3] };
+	}
+
+	/** { a2, a3, b2, b3 } with b as the upper half, like movhlps. */
+	furud_inline __m128 _mm_movehl_ps(__m128 a, __m128 b) noexcept { return __m128{ b[2], b[3], a[2], a[3] }; }
+	furud_inline __m128 _mm_movelh_ps(__m128 a, __m128 b) noexcept { return __m128{ a[0], a[1], b[0], b[1] }; }
+	furud_inline __m128i _mm_unpacklo_epi64(__m128i a, __m128i b) noexcept { return __m128i{ a[0], b[0] }; }
+
+	furud_inline __m256 _mm256_shuffle_ps(__m256 a, __m256 b, int imm) noexcept
+	{
+		return __m256
+		{
+			a[imm & 3], a[(imm >> 2) & 3], b[(imm >> 4) & 3], b[(imm >> 6) & 3],
+			a[4 + (imm & 3)], a[4 + ((imm >> 2) & 3)], b[4 + ((imm >> 4) & 3)], b[4 + ((imm >> 6) & 3)]
+		};
+	}
+
+	furud_inline __m256 _mm256_permute_ps(__m256 a, int imm) noexcept
+	{
+		return _mm256_shuffle_ps(a, a, imm);
+	}
+
+	furud_inline __m256 _mm256_unpacklo_ps(__m256 a, __m256 b) noexcept
+	{
+		return __m256{ a[0], b[0], a[1], b[1], a[4], b[4], a[5], b[5] };
+	}
+
+	furud_inline __m256 _mm256_unpackhi_ps(__m256 a, __m256 b) noexcept
+	{
+		return __m256{ a[2], b[2], a[3], b[3], a[6], b[6], a[7], b[7] };
+	}
+
+	/** Crosses the halves: picks 64-bit lanes from the whole register. */
+	furud_inline __m256i _mm256_permute4x64_epi64(__m256i a, int imm) noexcept
+	{
+		return __m256i{ a[imm & 3], a[(imm >> 2) & 3], a[(imm >> 4) & 3], a[(imm >> 6) & 3] };
+	}
+
+	/** Index bytes with the top bit set give 0, otherwise their low 4 bits pick a byte of the same half. */
+	furud_inline __m256i _mm256_shuffle_epi8(__m256i a, __m256i b) noexcept
+	{
+		const Internal::U8x32 x = (Internal::U8x32)a;
+		const Internal::U8x32 index = (Internal::U8x32)b;
+		Internal::U8x32 r;
+		for (int i = 0; i < 32; ++i)
+		{
+			r[i] = (index[i] & 0x80) ? 0 : x[(i & 16) | (index[i] & 15)];
+		}
+		return (__m256i)r;
+	}
+
+
+
+	//****************************************************************
+	// @brief    Saturating packs.
+	// @details  饱和打包。
+	//****************************************************************
+
+	furud_inline __m128i _mm_packs_epi32(__m128i a, __m128i b) noexcept
+	{
+		const Internal::I32x4 x = (Internal::I32x4)a, y = (Internal::I32x4)b;
+		Internal::I16x8 r;
+		for (int i = 0; i < 4; ++i)
+		{
+			r[i] = Internal::SaturateLane<int32_t, int16_t>(x[i]);
+			r[i + 4] = Internal::SaturateLane<int32_t, int16_t>(y[i]);
+		}
+		return (__m128i)r;
+	}
+
+	furud_inline __m128i _mm_packus_epi32(__m128i a, __m128i b) noexcept
+	{
+		const Internal::I32x4 x = (Internal::I32x4)a, y = (Internal::I32x4)b;
+		Internal::U16x8 r;
+		for (int i = 0; i < 4; ++i)
+		{
+			r[i] = Internal::SaturateLane<int32_t, uint16_t>(x[i]);
+			r[i + 4] = Internal::SaturateLane<int32_t, uint16_t>(y[i]);
+		}
+		return (__m128i)r;
+	}
+
+	furud_inline __m128i _mm_packs_epi16(__m128i a, __m128i b) noexcept
+	{
+		const Internal::I16x8 x = (Internal::I16x8)a, y = (Internal::I16x8)b;
+		Internal::I8x16 r;
+		for (int i = 0; i < 8; ++i)
+		{
+			r[i] = Internal::SaturateLane<int16_t, int8_t>(x[i]);
+			r[i + 8] = Internal::SaturateLane<int16_t, int8_t>(y[i]);
+		}
+		return (__m128i)r;
+	}
+
+	furud_inline __m128i _mm_packus_epi16(__m128i a, __m128i b) noexcept
+	{
+		const Internal::I16x8 x = (Internal::I16x8)a, y = (Internal::I16x8)b;
+		Internal::U8x16 r;
+		for (int i = 0; i < 8; ++i)
+		{
+			r[i] = Internal::SaturateLane<int16_t, uint8_t>(x[i]);
+			r[i + 8] = Internal::SaturateLane<int16_t, uint8_t>(y[i]);
+		}
+		return (__m128i)r;
+	}
+
+	furud_inline __m256i _mm256_packs_epi32(__m256i a, __m256i b) noexcept
+	{
+		const __m128i lo = _mm_packs_epi32(_mm256_extracti128_si256(a, 0), _mm256_extracti128_si256(b, 0));
+		const __m128i hi = _mm_packs_epi32(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+		return __m256i{ lo[0], lo[1], hi[0], hi[1] };
+	}
+
+	furud_inline __m256i _mm256_packs_epi16(__m256i a, __m256i b) noexcept
+	{
+		const __m128i lo = _mm_packs_epi16(_mm256_extracti128_si256(a, 0), _mm256_extracti128_si256(b, 0));
+		const __m128i hi = _mm_packs_epi16(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+		return __m256i{ lo[0], lo[1], hi[0], hi[1] };
+	}
+
+
+
+	//****************************************************************
+	// @brief    Conversions.
+	// @details  数值转换。
+	//****************************************************************
+
+	furud_inline __m128 _mm_cvtepi32_ps(__m128i a) noexcept
+	{
+		return __builtin_convertvector((Internal::I32x4)a, __m128);
+	}
+
+	furud_inline __m256 _mm256_cvtepi32_ps(__m256i a) noexcept
+	{
+		return __builtin_convertvector((Internal::I32x8)a, __m256);
+	}
+
+	furud_inline __m128i _mm_cvtps_epi32(__m128 a) noexcept
+	{
+		Internal::I32x4 r;
+		for (int i = 0; i < 4; ++i) r[i] = Internal::ConvertLane(a[i]);
+		return (__m128i)r;
+	}
+
+	furud_inline __m256i _mm256_cvtps_epi32(__m256 a) noexcept
+	{
+		Internal::I32x8 r;
+		for (int i = 0; i < 8; ++i) r[i] = Internal::ConvertLane(a[i]);
+		return (__m256i)r;
+	}
+
+	furud_inline __m128i _mm_cvttps_epi32(__m128 a) noexcept
+	{
+		Internal::I32x4 r;
+		for (int i = 0; i < 4; ++i) r[i] = Internal::TruncateLane(a[i]);
+		return (__m128i)r;
+	}
+
+	/** The 128-bit double conversions use the lower two lanes, and zero the upper two of their result. */
+	furud_inline __m128d _mm_cvtps_pd(__m128 a) noexcept
+	{
+		return __m128d{ a[0], a[1] };
+	}
+
+	furud_inline __m128 _mm_cvtpd_ps(__m128d a) noexcept
+	{
+		return __m128{ (float)a[0], (float)a[1], 0.f, 0.f };
+	}
+
+	furud_inline __m128d _mm_cvtepi32_pd(__m128i a) noexcept
+	{
+		const Internal::I32x4 x = (Internal::I32x4)a;
+		return __m128d{ (double)x[0], (double)x[1] };
+	}
+
+	furud_inline __m128i _mm_cvttpd_epi32(__m128d a) noexcept
+	{
+		return (__m128i)Internal::I32x4{ Internal::TruncateLane(a[0]), Internal::TruncateLane(a[1]), 0, 0 };
+	}
+
+	furud_inline __m256d _mm256_cvtps_pd(__m128 a) noexcept
+	{
+		return __builtin_convertvector(a, __m256d);
+	}
+
+	furud_inline __m128 _mm256_cvtpd_ps(__m256d a) noexcept
+	{
+		return __builtin_convertvector(a, __m128);
+	}
+
+	furud_inline __m256d _mm256_cvtepi32_pd(__m128i a) noexcept
+	{
+		return __builtin_convertvector((Internal::I32x4)a, __m256d);
+	}
+
+	furud_inline __m128i _mm256_cvttpd_epi32(__m256d a) noexcept
+	{
+		Internal::I32x4 r;
+		for (int i = 0; i < 4; ++i) r[i] = Internal::TruncateLane(a[i]);
+		return (__m128i)r;
+	}
+
+	furud_inline __m256i _mm256_cvtepi16_epi32(__m128i a) noexcept
+	{
+		return (__m256i)__builtin_convertvector((Internal::I16x8)a, Internal::I32x8);
+	}
+
+	furud_inline __m256i _mm256_cvtepu16_epi32(__m128i a) noexcept
+	{
+		return (__m256i)__builtin_convertvector((Internal::U16x8)a, Internal::I32x8);
+	}
+
+	furud_inline __m256i _mm256_cvtepi8_epi32(__m128i a) noexcept
+	{
+		const Internal::I8x16 x = (Internal::I8x16)a;
+		return (__m256i)Internal::I32x8{ x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7] };
+	}
+
+	furud_inline __m256i _mm256_cvtepu8_epi32(__m128i a) noexcept
+	{
+		const Internal::U8x16 x = (Internal::U8x16)a;
+		return (__m256i)Internal::I32x8{ x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7] };
+	}
+
+	/** Only round-to-nearest-even is emulated, which is what Vec8f::StoreHalf asks for. */
+	furud_inline __m128i _mm256_cvtps_ph(__m256 a, int) noexcept
+	{
+		Internal::U16x8 r;
+		for (int i = 0; i < 8; ++i) r[i] = Internal::FloatToHalfLane(a[i]);
+		return (__m128i)r;
+	}
+
+	furud_inline __m256 _mm256_cvtph_ps(__m128i a) noexcept
+	{
+		const Internal::U16x8 x = (Internal::U16x8)a;
+		__m256 r;
+		for (int i = 0; i < 8; ++i) r[i] = Internal::HalfToFloatLane(x[i]);
+		return r;
+	}
+}
+
+
+
+namespace Furud::Internal
+{
+	/** Body of _MM_TRANSPOSE4_PS. */
+	furud_inline void Transpose4(__m128& row0, __m128& row1, __m128& row2, __m128& row3) noexcept
+	{
+		const __m128 r0 = row0, r1 = row1, r2 = row2, r3 = row3;
+		row0 = __m128{ r0[0], r1[0], r2[0], r3[0] };
+		row1 = __m128{ r0[1], r1[1], r2[1], r3[1] };
+		row2 = __m128{ r0[2], r1[2], r2[2], r3[2] };
+		row3 = __m128{ r0[3], r1[3], r2[3], r3[3] };
+	}
+}
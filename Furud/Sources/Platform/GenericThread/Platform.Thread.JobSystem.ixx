@@ -0,0 +1,762 @@
+//
+// Platform.Thread.JobSystem.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Work-stealing job system.
+//
+module;
+
+#include <Furud.hpp>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <stdint.h>
+#include <stdio.h>
+#include <thread>
+#include <immintrin.h>
+
+
+
+export module Furud.Platform.Thread.JobSystem;
+
+import Furud.Platform.Memory.Pool;
+import Furud.Platform.Thread;
+import Furud.Platform.Thread.SpinLock;
+
+
+
+/** Chase-Lev deque. */
+namespace Furud::Internal
+{
+	/**
+	 * @brief    A lock-free work-stealing deque, the owner pushes and pops at the bottom,
+	 *           the thieves steal at the top.
+	 * @see      "Correct and Efficient Work-Stealing for Weak Memory Models", Lê et al., PPoPP 2013.
+	 * @tparam   T  -  Pointer type of the items.
+	 * @details  工作窃取双端队列。
+	 */
+	template <typename T> requires std::is_pointer_v<T>
+	class TWorkStealingDeque
+	{
+	private:
+		/** Circular array, never freed until the deque is destroyed since thieves may still read it. */
+		struct Ring
+		{
+			int64_t capacity;
+			int64_t mask;
+			Ring* previous;
+			std::atomic<T>* items;
+
+			explicit Ring(int64_t inCapacity, Ring* inPrevious)
+				: capacity(inCapacity)
+				, mask(inCapacity - 1)
+				, previous(inPrevious)
+				, items(new std::atomic<T>[inCapacity])
+			{}
+
+			~Ring()
+			{
+				delete[] items;
+			}
+
+			furud_inline T Get(int64_t index) const noexcept
+			{
+				return items[index & mask].load(std::memory_order_acquire);
+			}
+
+			furud_inline void Put(int64_t index, T item) noexcept
+			{
+				items[index & mask].store(item, std::memory_order_release);
+			}
+
+			Ring* Grow(int64_t bottom, int64_t top)
+			{
+				Ring* ring = new Ring(capacity * 2, this);
+				for (int64_t index = top; index < bottom; ++index)
+				{
+					ring->Put(index, Get(index));
+				}
+				return ring;
+			}
+		};
+
+		alignas(64) std::atomic<int64_t> top;
+		alignas(64) std::atomic<int64_t> bottom;
+		alignas(64) std::atomic<Ring*> ring;
+
+
+	public:
+		explicit TWorkStealingDeque(int64_t capacity = 1024)
+			: top(0)
+			, bottom(0)
+			, ring(new Ring(capacity, nullptr))
+		{}
+
+		~TWorkStealingDeque()
+		{
+			Ring* current = ring.load(std::memory_order_relaxed);
+			while (current)
+			{
+				Ring* previous = current->previous;
+				delete current;
+				current = previous;
+			}
+		}
+
+		TWorkStealingDeque(const TWorkStealingDeque&) = delete;
+		TWorkStealingDeque& operator = (const TWorkStealingDeque&) = delete;
+
+
+	public:
+		/**
+		 * @brief    Pushes an item at the bottom, called by the owner only.
+		 * @details  入队（仅所有者线程）。
+		 */
+		void Push(T item)
+		{
+			const int64_t b = bottom.load(std::memory_order_relaxed);
+			const int64_t t = top.load(std::memory_order_acquire);
+			Ring* current = ring.load(std::memory_order_relaxed);
+			if (b - t > current->capacity - 1) furud_unlikely
+			{
+				current = current->Grow(b, t);
+				ring.store(current, std::memory_order_release);
+			}
+
+			current->Put(b, item);
+			std::atomic_thread_fence(std::memory_order_release);
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+
+
+		/**
+		 * @brief    Pops an item at the bottom, called by the owner only.
+		 * @returns  Null if the deque is empty.
+		 * @details  出队（仅所有者线程，后进先出）。
+		 */
+		T Pop() noexcept
+		{
+			const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+			Ring* current = ring.load(std::memory_order_relaxed);
+			bottom.store(b, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t t = top.load(std::memory_order_relaxed);
+
+			T item = nullptr;
+			if (t <= b)
+			{
+				item = current->Get(b);
+				if (t == b)
+				{
+					// The last item, races against thieves.
+					if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					{
+						item = nullptr;
+					}
+					bottom.store(b + 1, std::memory_order_relaxed);
+				}
+			}
+			else
+			{
+				bottom.store(b + 1, std::memory_order_relaxed);
+			}
+			return item;
+		}
+
+
+		/**
+		 * @brief    Steals an item at the top, called by any thread.
+		 * @returns  Null if the deque is empty or the steal lost the race.
+		 * @details  窃取（任意线程，先进先出）。
+		 */
+		T Steal() noexcept
+		{
+			int64_t t = top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t b = bottom.load(std::memory_order_acquire);
+
+			T item = nullptr;
+			if (t < b)
+			{
+				Ring* current = ring.load(std::memory_order_acquire);
+				item = current->Get(t);
+				if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					return nullptr;
+				}
+			}
+			return item;
+		}
+
+
+		/**
+		 * @brief    Whether the deque looks empty, the result may be stale.
+		 * @details  队列是否为空。
+		 */
+		furud_inline bool Empty() const noexcept
+		{
+			return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+		}
+	};
+}
+
+
+
+/** Job declaration. */
+export namespace Furud
+{
+	/**
+	 * @brief    The priority of jobs, higher priority jobs are always picked first.
+	 * @details  任务优先级。
+	 */
+	enum class JobPriority : uint8_t
+	{
+		High,
+		Normal,
+		Low,
+		Num,
+	};
+
+
+	/**
+	 * @brief    Job entry point.
+	 * @details  任务函数。
+	 */
+	using JobProc = void (*)(void* data);
+
+
+	/**
+	 * @brief    Counts the unfinished jobs, each job decreases it after finished.
+	 * @details  任务计数器。
+	 */
+	struct JobCounter
+	{
+		std::atomic<int32_t> value { 0 };
+
+		JobCounter() noexcept = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator = (const JobCounter&) = delete;
+
+		furud_inline bool IsDone() const noexcept
+		{
+			return value.load(std::memory_order_acquire) == 0;
+		}
+	};
+}
+
+
+
+/** Job scheduler. */
+namespace Furud::Internal
+{
+	struct Job
+	{
+		JobProc proc;
+		void* data;
+		JobCounter* counter;
+		Job* next;
+	};
+
+
+
+	/**
+	 * @brief    A fifo protected by spin lock, used by the threads outside of the job system.
+	 * @details  外部线程提交任务的队列。
+	 */
+	class JobInjectionQueue
+	{
+		AtomicSpinLock mutex;
+		Job* head = nullptr;
+		Job* tail = nullptr;
+		std::atomic<bool> bEmpty { true };
+
+
+	public:
+		void Push(Job* job) noexcept
+		{
+			AtomicScopeLock lock(mutex);
+			job->next = nullptr;
+			tail ? (tail->next = job) : (head = job);
+			tail = job;
+			bEmpty.store(false, std::memory_order_release);
+		}
+
+		Job* Pop() noexcept
+		{
+			if (bEmpty.load(std::memory_order_acquire))
+			{
+				return nullptr;
+			}
+
+			AtomicScopeLock lock(mutex);
+			Job* job = head;
+			if (job)
+			{
+				head = job->next;
+				if (!head)
+				{
+					tail = nullptr;
+					bEmpty.store(true, std::memory_order_release);
+				}
+			}
+			return job;
+		}
+
+		furud_inline bool Empty() const noexcept
+		{
+			return bEmpty.load(std::memory_order_acquire);
+		}
+	};
+
+
+
+	class JobScheduler
+	{
+	private:
+		static constexpr uint32_t NumPriorities = (uint32_t)JobPriority::Num;
+
+		/** Spinning rounds before a idle worker goes to sleep. */
+		static constexpr uint32_t SpinCount = 64;
+
+
+		/** Each participating thread owns a slot, the slot 0 belongs to the thread which initialized the scheduler. */
+		struct alignas(64) Slot
+		{
+			TWorkStealingDeque<Job*> deques[NumPriorities];
+		};
+
+
+		class Worker : public Thread
+		{
+		public:
+			JobScheduler* owner = nullptr;
+			uint32_t slot = 0;
+
+		protected:
+			virtual void Run() override
+			{
+				owner->WorkerLoop(slot);
+			}
+		};
+
+
+		std::unique_ptr<Slot[]> slots;
+		std::unique_ptr<Worker[]> workers;
+		uint32_t numSlots = 0;
+		uint32_t numWorkers = 0;
+
+		JobInjectionQueue injections[NumPriorities];
+
+		alignas(64) std::atomic<uint32_t> wakeEpoch { 0 };
+		alignas(64) std::atomic<uint32_t> numSleeping { 0 };
+		std::atomic<bool> bQuit { false };
+
+		/** Set with release order once Init has built everything, so a lock-free reader sees a complete scheduler. */
+		std::atomic<bool> bInitialized { false };
+
+		/** The thread which owns the slot 0, assigned by Init and cleared by Shutdown. */
+		std::atomic<std::thread::id> ownerThread {};
+
+		/** Slot index of current worker thread, -1 on any other thread. */
+		static inline thread_local int32_t currentSlot = -1;
+
+
+	public:
+		JobScheduler() = default;
+		JobScheduler(const JobScheduler&) = delete;
+		JobScheduler& operator = (const JobScheduler&) = delete;
+
+		~JobScheduler()
+		{
+			Shutdown();
+		}
+
+
+	public:
+		bool Init(uint32_t inNumWorkers)
+		{
+			if (bInitialized.load(std::memory_order_relaxed))
+			{
+				return false;
+			}
+
+			if (inNumWorkers == 0)
+			{
+				const uint32_t numCores = std::thread::hardware_concurrency();
+				inNumWorkers = numCores > 1 ? numCores - 1 : 1;
+			}
+
+			numWorkers = inNumWorkers;
+			numSlots = inNumWorkers + 1;
+			slots.reset(new Slot[numSlots]);
+			workers.reset(new Worker[numWorkers]);
+			bQuit.store(false, std::memory_order_relaxed);
+			ownerThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+			for (uint32_t index = 0; index < numWorkers; ++index)
+			{
+				char name[32];
+				::snprintf(name, sizeof(name), "Furud Worker %u", index);
+
+				Worker& worker = workers[index];
+				worker.owner = this;
+				worker.slot = index + 1;
+				worker.Init({ name, Thread::Priority::Normal, Thread::InitFlag::CreateRunnable });
+			}
+
+			// Publishes the scheduler after the slots and the workers are ready.
+			bInitialized.store(true, std::memory_order_release);
+			return true;
+		}
+
+
+		void Shutdown()
+		{
+			if (!bInitialized.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+
+			bQuit.store(true, std::memory_order_seq_cst);
+			wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+			wakeEpoch.notify_all();
+
+			for (uint32_t index = 0; index < numWorkers; ++index)
+			{
+				workers[index].Kill(true);
+			}
+
+			// Drains the remaining jobs on current thread.
+			while (Job* job = FindJob(LocalSlot()))
+			{
+				Execute(job);
+			}
+
+			// Jobs drained above may still schedule, so the scheduler stays published until here.
+			bInitialized.store(false, std::memory_order_relaxed);
+			workers.reset();
+			slots.reset();
+			numWorkers = 0;
+			numSlots = 0;
+			ownerThread.store(std::thread::id(), std::memory_order_relaxed);
+		}
+
+
+		furud_inline bool IsInitialized() const noexcept
+		{
+			return bInitialized.load(std::memory_order_acquire);
+		}
+
+
+		furud_inline uint32_t NumWorkers() const noexcept
+		{
+			return numWorkers;
+		}
+
+
+		void Schedule(JobProc proc, void* data, JobCounter* counter, JobPriority priority)
+		{
+			if (counter)
+			{
+				counter->value.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			Job* job = TPool<Job>::New(proc, data, counter, nullptr);
+			const uint32_t queue = (uint32_t)priority < NumPriorities ? (uint32_t)priority : (uint32_t)JobPriority::Normal;
+
+			// Jobs spawned on the job system threads go to the local deque to keep cache locality.
+			const int32_t slot = LocalSlot();
+			assert((slot < 0 || (uint32_t)slot < numSlots) && "The local deque must belong to this scheduler.");
+			if (slot >= 0)
+			{
+				slots[slot].deques[queue].Push(job);
+			}
+			else
+			{
+				injections[queue].Push(job);
+			}
+
+			WakeOne();
+		}
+
+
+		bool TryExecuteOne()
+		{
+			Job* job = FindJob(LocalSlot());
+			if (job)
+			{
+				Execute(job);
+				return true;
+			}
+			return false;
+		}
+
+
+		void Wait(const JobCounter& counter)
+		{
+			uint32_t idleRounds = 0;
+			while (!counter.IsDone())
+			{
+				if (TryExecuteOne())
+				{
+					idleRounds = 0;
+				}
+				else if (++idleRounds < SpinCount)
+				{
+					_mm_pause();
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+
+	private:
+		/**
+		 * @brief    Gets the slot of current thread, -1 if current thread does not belong to the job system.
+		 *           The slot 0 is checked against the owner rather than kept in `currentSlot`,
+		 *           otherwise the initializing thread would keep it after a shutdown on another thread.
+		 * @details  获取当前线程的槽位。
+		 */
+		furud_inline int32_t LocalSlot() const noexcept
+		{
+			if (currentSlot > 0)
+			{
+				return currentSlot;
+			}
+			return ownerThread.load(std::memory_order_relaxed) == std::this_thread::get_id() ? 0 : -1;
+		}
+
+
+		furud_inline void WakeOne() noexcept
+		{
+			wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+			if (numSleeping.load(std::memory_order_seq_cst) > 0)
+			{
+				wakeEpoch.notify_one();
+			}
+		}
+
+
+		furud_inline bool HasWork() const noexcept
+		{
+			for (uint32_t queue = 0; queue < NumPriorities; ++queue)
+			{
+				if (!injections[queue].Empty())
+				{
+					return true;
+				}
+
+				for (uint32_t index = 0; index < numSlots; ++index)
+				{
+					if (!slots[index].deques[queue].Empty())
+					{
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+
+
+		/**
+		 * @brief    Finds a job by priority, first the local deque, then the injection queue, then steals.
+		 * @details  查找可执行的任务。
+		 */
+		Job* FindJob(int32_t slot) noexcept
+		{
+			for (uint32_t queue = 0; queue < NumPriorities; ++queue)
+			{
+				if (slot >= 0)
+				{
+					if (Job* job = slots[slot].deques[queue].Pop())
+					{
+						return job;
+					}
+				}
+
+				if (Job* job = injections[queue].Pop())
+				{
+					return job;
+				}
+
+				const uint32_t start = slot >= 0 ? (uint32_t)slot : 0;
+				for (uint32_t offset = 1; offset <= numSlots; ++offset)
+				{
+					const uint32_t victim = (start + offset) % numSlots;
+					if ((int32_t)victim == slot)
+					{
+						continue;
+					}
+
+					if (Job* job = slots[victim].deques[queue].Steal())
+					{
+						return job;
+					}
+				}
+			}
+			return nullptr;
+		}
+
+
+		furud_inline static void Execute(Job* job)
+		{
+			JobCounter* counter = job->counter;
+			job->proc(job->data);
+			TPool<Job>::Delete(job);
+
+			// Must be the last access, the waiter may release the counter immediately.
+			if (counter)
+			{
+				counter->value.fetch_sub(1, std::memory_order_acq_rel);
+			}
+		}
+
+
+		void WorkerLoop(uint32_t slot)
+		{
+			currentSlot = (int32_t)slot;
+
+			uint32_t idleRounds = 0;
+			while (!bQuit.load(std::memory_order_acquire))
+			{
+				if (Job* job = FindJob((int32_t)slot))
+				{
+					Execute(job);
+					idleRounds = 0;
+					continue;
+				}
+
+				if (++idleRounds < SpinCount)
+				{
+					_mm_pause();
+					continue;
+				}
+
+				// Goes to sleep, rechecks after registered as sleeper to avoid lost wakeup.
+				numSleeping.fetch_add(1, std::memory_order_seq_cst);
+				const uint32_t epoch = wakeEpoch.load(std::memory_order_seq_cst);
+				if (!HasWork() && !bQuit.load(std::memory_order_seq_cst))
+				{
+					wakeEpoch.wait(epoch, std::memory_order_seq_cst);
+				}
+				numSleeping.fetch_sub(1, std::memory_order_seq_cst);
+				idleRounds = 0;
+			}
+
+			currentSlot = -1;
+		}
+	};
+
+
+
+	/** The global scheduler. */
+	JobScheduler globalScheduler;
+
+	/** Guards the initialization of the global scheduler. */
+	AtomicSpinLock globalSchedulerMutex;
+
+
+	/**
+	 * @brief    Gets the global scheduler, launches workers on first use.
+	 * @details  获取全局任务调度器。
+	 */
+	JobScheduler& GetJobScheduler()
+	{
+		if (!globalScheduler.IsInitialized()) furud_unlikely
+		{
+			AtomicScopeLock lock(globalSchedulerMutex);
+			if (!globalScheduler.IsInitialized())
+			{
+				globalScheduler.Init(0);
+			}
+		}
+		return globalScheduler;
+	}
+}
+
+
+
+export namespace Furud
+{
+	/**
+	 * @brief    Work-stealing job system.
+	 *           Each worker owns a Chase-Lev deque per priority, idle workers steal from the others.
+	 * @details  工作窃取任务系统。
+	 */
+	namespace IJobSystem
+	{
+		/**
+		 * @brief    Launches the workers explicitly, otherwise they are launched on first use.
+		 *           The calling thread becomes a member of the job system.
+		 * @param    numWorkers  -  The number of worker threads, `0` means number of cores minus one.
+		 * @returns  False if the job system has been initialized.
+		 * @details  初始化任务系统。
+		 */
+		bool Init(uint32_t numWorkers = 0)
+		{
+			AtomicScopeLock lock(Internal::globalSchedulerMutex);
+			return Internal::globalScheduler.Init(numWorkers);
+		}
+
+
+		/**
+		 * @brief    Stops all workers, the remaining jobs are executed on the calling thread.
+		 * @details  关闭任务系统。
+		 */
+		void Shutdown()
+		{
+			AtomicScopeLock lock(Internal::globalSchedulerMutex);
+			Internal::globalScheduler.Shutdown();
+		}
+
+
+		/**
+		 * @brief    Gets the number of worker threads.
+		 * @details  获取工作线程数量。
+		 */
+		furud_nodiscard uint32_t NumWorkers()
+		{
+			return Internal::GetJobScheduler().NumWorkers();
+		}
+
+
+		/**
+		 * @brief    Schedules a job.
+		 * @param    proc      -  Job entry point.
+		 * @param    data      -  Argument of the job.
+		 * @param    counter   -  Optional, increased now and decreased after the job is done.
+		 * @param    priority  -  Job priority.
+		 * @details  提交任务。
+		 */
+		void Schedule(JobProc proc, void* data, JobCounter* counter = nullptr, JobPriority priority = JobPriority::Normal)
+		{
+			Internal::GetJobScheduler().Schedule(proc, data, counter, priority);
+		}
+
+
+		/**
+		 * @brief    Executes one pending job on the calling thread.
+		 * @returns  False if no job is available.
+		 * @details  在当前线程执行一个任务。
+		 */
+		bool TryExecuteOne()
+		{
+			return Internal::GetJobScheduler().TryExecuteOne();
+		}
+
+
+		/**
+		 * @brief    Waits until the counter reaches zero, the calling thread executes jobs meanwhile.
+		 * @details  等待任务完成。
+		 */
+		void Wait(const JobCounter& counter)
+		{
+			Internal::GetJobScheduler().Wait(counter);
+		}
+	}
+}
@@ -9,16 +9,529 @@
 module;
 
 #include <Furud.hpp>
-#include <ppl.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <memory>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 
 export module Furud.Platform.Thread.Parallel;
 
+import Furud.Platform.Thread.JobSystem;
+
 namespace Furud::Internal
 {
 	template <typename F>
 	concept is_callable = requires(F const& function) { function(0); };
+
+	template <typename F>
+	concept is_chunk_callable = requires(F const& function) { function(0, 0, 0); };
+
+
+
+	/**
+	 * @brief    Shared state of a parallel for, jobs claim chunks dynamically to balance the load.
+	 * @details  并行 for 的共享状态。
+	 */
+	template <typename F>
+	struct ParallelForContext
+	{
+		F const& function;
+		int32_t start;
+		int32_t end;
+		int32_t chunkSize;
+		std::atomic<int32_t> next;
+
+		void Execute()
+		{
+			while (true)
+			{
+				const int32_t first = next.fetch_add(chunkSize, std::memory_order_relaxed);
+				if (first >= end)
+				{
+					break;
+				}
+
+				const int32_t last = end - first > chunkSize ? first + chunkSize : end;
+				for (int32_t index = first; index < last; ++index)
+				{
+					function(index);
+				}
+			}
+		}
+
+		static void ExecuteJob(void* data)
+		{
+			static_cast<ParallelForContext*>(data)->Execute();
+		}
+	};
+
+
+	/**
+	 * @brief    Runs the function on [start, end) with the job system, the calling thread takes part in.
+	 * @details  并行 for 实现。
+	 */
+	template <typename F>
+	void ParallelFor(int32_t start, int32_t end, F const& function)
+	{
+		if (end <= start)
+		{
+			return;
+		}
+
+		// Several chunks per thread, so that the fast threads can take over the slow ones.
+		const int32_t num = end - start;
+		const int32_t numThreads = (int32_t)IJobSystem::NumWorkers() + 1;
+		const int32_t numChunks = std::min(num, numThreads * 4);
+		if (numChunks <= 1 || numThreads <= 1)
+		{
+			for (int32_t index = start; index < end; ++index)
+			{
+				function(index);
+			}
+			return;
+		}
+
+		ParallelForContext<F> context{ function, start, end, (num + numChunks - 1) / numChunks, start };
+		const int32_t numJobs = std::min(numChunks, numThreads) - 1;
+
+		JobCounter counter;
+		for (int32_t index = 0; index < numJobs; ++index)
+		{
+			IJobSystem::Schedule(ParallelForContext<F>::ExecuteJob, &context, &counter);
+		}
+
+		context.Execute();
+		IJobSystem::Wait(counter);
+	}
+
+
+	/**
+	 * @brief    The grain size which gives several chunks per thread, like ParallelFor.
+	 * @details  默认分块大小。
+	 */
+	furud_inline int32_t DefaultGrainSize(int32_t num)
+	{
+		const int32_t numThreads = (int32_t)IJobSystem::NumWorkers() + 1;
+		const int32_t numChunks = std::max(std::min(num, numThreads * 4), 1);
+		return (num + numChunks - 1) / numChunks;
+	}
+
+
+	furud_inline int32_t NumChunks(int32_t num, int32_t grainSize)
+	{
+		return (int32_t)(((int64_t)num + grainSize - 1) / grainSize);
+	}
+
+
+	/**
+	 * @brief    Runs `function(chunk, first, last)` on each chunk of [start, end) in parallel.
+	 * @details  并行分块 for 实现。
+	 */
+	template <typename F>
+	void ParallelForEachChunk(int32_t start, int32_t end, int32_t grainSize, F const& function)
+	{
+		if (end <= start)
+		{
+			return;
+		}
+
+		grainSize = std::max(grainSize, 1);
+		ParallelFor(0, NumChunks(end - start, grainSize), [&](int32_t chunk)
+		{
+			const int32_t first = start + chunk * grainSize;
+			const int32_t last = end - first > grainSize ? first + grainSize : end;
+			function(chunk, first, last);
+		});
+	}
+
+
+	/**
+	 * @brief    Reduces each chunk in parallel, then combines the partial results in chunk order,
+	 *           so the result does not depend on which thread finished first.
+	 * @details  并行归约实现。
+	 */
+	template <typename T, typename F, typename C>
+	T ParallelReduce(int32_t start, int32_t end, const T& identity, F const& function, C const& combine)
+	{
+		if (end <= start)
+		{
+			return identity;
+		}
+
+		const int32_t grainSize = DefaultGrainSize(end - start);
+		std::vector<T> partials(NumChunks(end - start, grainSize), identity);
+		ParallelForEachChunk(start, end, grainSize, [&](int32_t chunk, int32_t first, int32_t last)
+		{
+			partials[chunk] = function(first, last, identity);
+		});
+
+		T result = identity;
+		for (const T& partial : partials)
+		{
+			result = combine(result, partial);
+		}
+		return result;
+	}
+
+
+	/**
+	 * @brief    Three passes: sums of chunks in parallel, scan of the sums, scan of chunks in parallel.
+	 *           `in` and `out` may be the same array.
+	 * @returns  The combination of all elements.
+	 * @details  并行前缀和实现。
+	 */
+	template <typename T, typename C>
+	T ParallelScan(const T* in, T* out, int32_t num, const T& identity, C const& combine, bool bInclusive)
+	{
+		if (num <= 0)
+		{
+			return identity;
+		}
+
+		const int32_t grainSize = DefaultGrainSize(num);
+		const int32_t numChunks = NumChunks(num, grainSize);
+		std::vector<T> offsets(numChunks, identity);
+
+		T total = identity;
+		if (numChunks > 1)
+		{
+			ParallelForEachChunk(0, num, grainSize, [&](int32_t chunk, int32_t first, int32_t last)
+			{
+				T sum = identity;
+				for (int32_t index = first; index < last; ++index)
+				{
+					sum = combine(sum, in[index]);
+				}
+				offsets[chunk] = sum;
+			});
+
+			for (T& offset : offsets)
+			{
+				const T sum = offset;
+				offset = total;
+				total = combine(total, sum);
+			}
+		}
+
+		ParallelForEachChunk(0, num, grainSize, [&](int32_t chunk, int32_t first, int32_t last)
+		{
+			T sum = offsets[chunk];
+			for (int32_t index = first; index < last; ++index)
+			{
+				const T value = in[index];
+				if (bInclusive)
+				{
+					sum = combine(sum, value);
+					out[index] = sum;
+				}
+				else
+				{
+					out[index] = sum;
+					sum = combine(sum, value);
+				}
+			}
+			if (numChunks == 1)
+			{
+				total = sum;
+			}
+		});
+		return total;
+	}
+
+
+	/**
+	 * @brief    Stable compaction, flags and counts each chunk in parallel, then writes each chunk
+	 *           at its offset in parallel. The predicate is evaluated once per index.
+	 * @returns  The number of the written elements.
+	 * @details  并行筛选实现。
+	 */
+	template <typename P, typename W>
+	int32_t ParallelCompact(int32_t start, int32_t end, P const& predicate, W const& write)
+	{
+		if (end <= start)
+		{
+			return 0;
+		}
+
+		const int32_t grainSize = DefaultGrainSize(end - start);
+		std::vector<uint8_t> flags(end - start);
+		std::vector<int32_t> offsets(NumChunks(end - start, grainSize));
+
+		ParallelForEachChunk(start, end, grainSize, [&](int32_t chunk, int32_t first, int32_t last)
+		{
+			int32_t count = 0;
+			for (int32_t index = first; index < last; ++index)
+			{
+				const bool bSelected = predicate(index);
+				flags[index - start] = bSelected;
+				count += bSelected;
+			}
+			offsets[chunk] = count;
+		});
+
+		int32_t total = 0;
+		for (int32_t& offset : offsets)
+		{
+			const int32_t count = offset;
+			offset = total;
+			total += count;
+		}
+
+		ParallelForEachChunk(start, end, grainSize, [&](int32_t chunk, int32_t first, int32_t last)
+		{
+			int32_t position = offsets[chunk];
+			for (int32_t index = first; index < last; ++index)
+			{
+				if (flags[index - start])
+				{
+					write(index, position++);
+				}
+			}
+		});
+		return total;
+	}
+
+
+	/**
+	 * @brief    Sorts chunks in parallel, then merges adjacent chunks pairwise in parallel.
+	 * @details  并行排序实现。
+	 */
+	template <typename T, typename F>
+	void ParallelSort(T* begin, T* end, const F& comparator)
+	{
+		// Small ranges are not worth to be split.
+		constexpr int64_t MinChunkSize = 2048;
+
+		const int64_t num = end - begin;
+		const int64_t numThreads = (int64_t)IJobSystem::NumWorkers() + 1;
+		int64_t numChunks = std::min(numThreads * 2, num / MinChunkSize);
+		if (numChunks <= 1)
+		{
+			std::sort(begin, end, comparator);
+			return;
+		}
+
+		const int64_t chunkSize = (num + numChunks - 1) / numChunks;
+		numChunks = (num + chunkSize - 1) / chunkSize;
+
+		ParallelFor(0, (int32_t)numChunks, [=](int32_t chunk)
+		{
+			T* first = begin + chunk * chunkSize;
+			T* last = std::min(first + chunkSize, end);
+			std::sort(first, last, comparator);
+		});
+
+		for (int64_t width = chunkSize; width < num; width *= 2)
+		{
+			const int32_t numMerges = (int32_t)((num + 2 * width - 1) / (2 * width));
+			ParallelFor(0, numMerges, [=](int32_t merge)
+			{
+				T* first = begin + merge * 2 * width;
+				T* middle = std::min(first + width, end);
+				T* last = std::min(middle + width, end);
+				if (middle < last)
+				{
+					std::inplace_merge(first, middle, last, comparator);
+				}
+			});
+		}
+	}
+
+
+	template <typename T>
+	concept is_radix_sortable = (std::is_integral_v<T> || std::is_floating_point_v<T>) && !std::is_same_v<T, bool>
+		&& (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+
+	template <size_t Size> struct TRadixBits;
+	template <> struct TRadixBits<1> { using Type = uint8_t;  };
+	template <> struct TRadixBits<2> { using Type = uint16_t; };
+	template <> struct TRadixBits<4> { using Type = uint32_t; };
+	template <> struct TRadixBits<8> { using Type = uint64_t; };
+
+
+	/**
+	 * @brief    Maps a key to unsigned bits which sort in the same order,
+	 *           signed integers flip the sign bit, negative floats flip all bits.
+	 * @details  基数排序键编码。
+	 */
+	template <typename T>
+	furud_inline typename TRadixBits<sizeof(T)>::Type RadixEncode(const T& key) noexcept
+	{
+		using U = typename TRadixBits<sizeof(T)>::Type;
+		constexpr U signBit = U(U(1) << (sizeof(T) * 8 - 1));
+
+		const U bits = std::bit_cast<U>(key);
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			return (bits & signBit) ? U(~bits) : U(bits | signBit);
+		}
+		else if constexpr (std::is_signed_v<T>)
+		{
+			return U(bits ^ signBit);
+		}
+		else
+		{
+			return bits;
+		}
+	}
+
+
+	/** Placeholder value type of the key-only radix sort. */
+	struct RadixNoValue {};
+
+
+	/**
+	 * @brief    LSD radix sort, stable.
+	 *           Each pass builds per-chunk histograms in parallel, scans them digit-major so every
+	 *           chunk gets its own range of each bucket, then scatters the chunks in parallel.
+	 *           A pass is skipped if all keys share the digit. Small inputs go to the comparison sort.
+	 * @details  并行基数排序实现。
+	 */
+	template <typename K, typename V>
+	void ParallelRadixSort(K* keys, V* values, int64_t num)
+	{
+		constexpr bool bPairs = !std::is_same_v<V, RadixNoValue>;
+
+		// 11-bit digits, 3 passes for 32-bit keys and 6 passes for 64-bit keys.
+		constexpr uint32_t DigitBits = sizeof(K) >= 4 ? 11 : 8;
+		constexpr uint32_t NumBuckets = 1u << DigitBits;
+		constexpr uint32_t DigitMask = NumBuckets - 1;
+
+		// Below it the histograms cost more than comparing.
+		constexpr int64_t MinRadixSize = 2048;
+
+		// Each chunk clears and scans NumBuckets counters per pass.
+		constexpr int32_t MinChunkSize = 16384;
+
+		if (num < MinRadixSize || num > INT32_MAX)
+		{
+			const auto less = [](const K& lhs, const K& rhs) { return RadixEncode(lhs) < RadixEncode(rhs); };
+			if constexpr (bPairs)
+			{
+				std::vector<std::pair<K, V>> pairs;
+				pairs.reserve((size_t)num);
+				for (int64_t index = 0; index < num; ++index)
+				{
+					pairs.emplace_back(keys[index], std::move(values[index]));
+				}
+
+				std::stable_sort(pairs.begin(), pairs.end(), [&](const auto& lhs, const auto& rhs) { return less(lhs.first, rhs.first); });
+				for (int64_t index = 0; index < num; ++index)
+				{
+					keys[index] = pairs[index].first;
+					values[index] = std::move(pairs[index].second);
+				}
+			}
+			else
+			{
+				ParallelSort(keys, keys + num, less);
+			}
+			return;
+		}
+
+		const int32_t count = (int32_t)num;
+		const int32_t grainSize = std::max(DefaultGrainSize(count), MinChunkSize);
+		const int32_t numChunks = NumChunks(count, grainSize);
+
+		std::vector<K> keyBuffer(count);
+		std::vector<uint32_t> offsets((size_t)numChunks * NumBuckets);
+
+		// Uninitialized, a value lives in the buffer only between the pass moving it in and the pass moving it out.
+		std::allocator<V> valueAllocator;
+		V* valueBuffer = bPairs ? valueAllocator.allocate((size_t)count) : nullptr;
+
+		K* srcKeys = keys;
+		K* dstKeys = keyBuffer.data();
+		V* srcValues = values;
+		V* dstValues = valueBuffer;
+
+		for (uint32_t shift = 0; shift < sizeof(K) * 8; shift += DigitBits)
+		{
+			ParallelForEachChunk(0, count, grainSize, [&](int32_t chunk, int32_t first, int32_t last)
+			{
+				uint32_t* histogram = offsets.data() + (size_t)chunk * NumBuckets;
+				std::fill(histogram, histogram + NumBuckets, 0u);
+				for (int32_t index = first; index < last; ++index)
+				{
+					++histogram[(RadixEncode(srcKeys[index]) >> shift) & DigitMask];
+				}
+			});
+
+			// Bucket-major, chunk-minor, keeps equal digits in their original order.
+			uint32_t total = 0;
+			bool bSkip = false;
+			for (uint32_t digit = 0; digit < NumBuckets; ++digit)
+			{
+				const uint32_t bucketStart = total;
+				for (int32_t chunk = 0; chunk < numChunks; ++chunk)
+				{
+					uint32_t& offset = offsets[(size_t)chunk * NumBuckets + digit];
+					const uint32_t size = offset;
+					offset = total;
+					total += size;
+				}
+				bSkip |= (total - bucketStart) == (uint32_t)count;
+			}
+
+			if (bSkip)
+			{
+				continue;
+			}
+
+			ParallelForEachChunk(0, count, grainSize, [&](int32_t chunk, int32_t first, int32_t last)
+			{
+				uint32_t cursors[NumBuckets];
+				std::copy_n(offsets.data() + (size_t)chunk * NumBuckets, NumBuckets, cursors);
+				for (int32_t index = first; index < last; ++index)
+				{
+					const uint32_t position = cursors[(RadixEncode(srcKeys[index]) >> shift) & DigitMask]++;
+					dstKeys[position] = srcKeys[index];
+					if constexpr (bPairs)
+					{
+						if (dstValues == valueBuffer)
+						{
+							std::construct_at(dstValues + position, std::move(srcValues[index]));
+						}
+						else
+						{
+							dstValues[position] = std::move(srcValues[index]);
+							std::destroy_at(srcValues + index);
+						}
+					}
+				}
+			});
+
+			std::swap(srcKeys, dstKeys);
+			std::swap(srcValues, dstValues);
+		}
+
+		// Odd number of passes, the result is in the buffer.
+		if (srcKeys != keys)
+		{
+			ParallelForEachChunk(0, count, grainSize, [&](int32_t, int32_t first, int32_t last)
+			{
+				std::copy(srcKeys + first, srcKeys + last, keys + first);
+				if constexpr (bPairs)
+				{
+					std::move(srcValues + first, srcValues + last, values + first);
+					std::destroy(srcValues + first, srcValues + last);
+				}
+			});
+		}
+
+		if constexpr (bPairs)
+		{
+			valueAllocator.deallocate(valueBuffer, (size_t)count);
+		}
+	}
 }
 
 
@@ -40,7 +553,7 @@ export namespace Furud
 		 */
 		void For(int32_t start, int32_t end, Internal::is_callable auto const& function)
 		{
-			Concurrency::parallel_for(start, end, function, Concurrency::auto_partitioner{});
+			Internal::ParallelFor(start, end, function);
 		}
 
 
@@ -52,19 +565,136 @@ export namespace Furud
 		 */
 		void For(int32_t num, Internal::is_callable auto const& function)
 		{
-			Concurrency::parallel_for(0, num, function, Concurrency::auto_partitioner{});
+			Internal::ParallelFor(0, num, function);
+		}
+
+
+		/**
+		 * @brief    Splits [start, end) into chunks of `grainSize` indices and executes
+		 *           `function(chunk, first, last)` on each chunk, in parallel.
+		 *           The chunk index runs from 0 and matches the order of the chunks.
+		 * @param    grainSize  -  the number of indices per chunk, the last chunk may be smaller.
+		 * @details  并行分块 for。
+		 */
+		void ForEachChunk(int32_t start, int32_t end, int32_t grainSize, Internal::is_chunk_callable auto const& function)
+		{
+			Internal::ParallelForEachChunk(start, end, grainSize, function);
+		}
+
+
+		/**
+		 * @brief    Reduces [start, end) in parallel.
+		 *           Each chunk is reduced by `function(first, last, identity)`, then the results
+		 *           are combined by `combine(lhs, rhs)` in chunk order.
+		 * @param    identity  -  the value which does not change the result when combined.
+		 * @details  并行归约。
+		 */
+		template <typename T, typename F, typename C>
+		furud_nodiscard T Reduce(int32_t start, int32_t end, const T& identity, F const& function, C const& combine)
+		{
+			return Internal::ParallelReduce(start, end, identity, function, combine);
+		}
+
+
+		/**
+		 * @brief    Inclusive prefix scan in parallel, ( out[i] = in[0] + ... + in[i] ).
+		 *           `in` and `out` may be the same array.
+		 * @returns  The combination of all elements.
+		 * @details  并行包含前缀和。
+		 */
+		template <typename T, typename C = std::plus<T>>
+		T InclusiveScan(const T* in, T* out, int32_t num, const T& identity = T(), C const& combine = C())
+		{
+			return Internal::ParallelScan(in, out, num, identity, combine, true);
+		}
+
+
+		/**
+		 * @brief    Exclusive prefix scan in parallel, ( out[i] = in[0] + ... + in[i - 1] ).
+		 *           `in` and `out` may be the same array.
+		 * @returns  The combination of all elements, e.g. the total size when scanning buffer sizes.
+		 * @details  并行排除前缀和。
+		 */
+		template <typename T, typename C = std::plus<T>>
+		T ExclusiveScan(const T* in, T* out, int32_t num, const T& identity = T(), C const& combine = C())
+		{
+			return Internal::ParallelScan(in, out, num, identity, combine, false);
+		}
+
+
+		/**
+		 * @brief    Copies the elements which satisfy `predicate(element)` in parallel, keeping their order.
+		 *           `out` must have room for `num` elements and must not overlap `in`.
+		 * @returns  The number of the copied elements.
+		 * @details  并行筛选。
+		 */
+		template <typename T, typename P>
+		int32_t Filter(const T* in, T* out, int32_t num, P const& predicate)
+		{
+			return Internal::ParallelCompact(0, num,
+				[&](int32_t index) { return predicate(in[index]); },
+				[&](int32_t index, int32_t position) { out[position] = in[index]; });
+		}
+
+
+		/**
+		 * @brief    Writes the indices in [start, end) which satisfy `predicate(index)` in parallel, in ascending order.
+		 *           `out` must have room for `end - start` indices.
+		 * @returns  The number of the written indices.
+		 * @details  并行筛选下标。
+		 */
+		template <typename P>
+		int32_t FilterIndices(int32_t start, int32_t end, int32_t* out, P const& predicate)
+		{
+			return Internal::ParallelCompact(start, end, predicate,
+				[&](int32_t index, int32_t position) { out[position] = index; });
 		}
 
 
 		/**
 		 * @brief    Sorts the specified range in parallel.
+		 *           Integer keys go to the radix sort, the others to the comparison sort by `operator <`,
+		 *           so floats keep the ordering of `std::sort`, use RadixSort for the bitwise float order.
 		 * @tparam   T  -  Data type.
 		 * @details  并行排序。
 		 */
 		template <typename T>
 		void Sort(T* begin, T* end)
 		{
-			Concurrency::parallel_sort(begin, end);
+			if constexpr (Internal::is_radix_sortable<T> && std::is_integral_v<T>)
+			{
+				Internal::ParallelRadixSort(begin, (Internal::RadixNoValue*)nullptr, end - begin);
+			}
+			else
+			{
+				Internal::ParallelSort(begin, end, std::less<T>{});
+			}
+		}
+
+
+		/**
+		 * @brief    Sorts integer or float keys in parallel with LSD radix sort, the sort is stable.
+		 *           Floats are ordered by their bits: -NaN first, then -inf, negatives, -0, +0, positives, +inf, +NaN last.
+		 * @details  并行基数排序。
+		 */
+		template <Internal::is_radix_sortable K>
+		void RadixSort(K* begin, K* end)
+		{
+			Internal::ParallelRadixSort(begin, (Internal::RadixNoValue*)nullptr, end - begin);
+		}
+
+
+		/**
+		 * @brief    Sorts the keys in parallel and moves the values along, the sort is stable.
+		 *           Passing indices as values gives the sorting permutation, e.g. of draw calls by sort key.
+		 * @param    keys    -  integer or float keys.
+		 * @param    values  -  payload of each key.
+		 * @details  并行基数排序（键值对）。
+		 */
+		template <Internal::is_radix_sortable K, typename V>
+		void RadixSort(K* keys, V* values, int64_t num)
+		{
+			Internal::ParallelRadixSort(keys, values, num);
 		}
 
 
@@ -77,7 +707,7 @@ export namespace Furud
 		template <typename T, typename F>
 		void Sort(T* begin, T* end, const F& comparator)
 		{
-			Concurrency::parallel_sort(begin, end, comparator);
+			Internal::ParallelSort(begin, end, comparator);
 		}
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,466 @@
+//
+// Platform.Thread.Queue.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Lock-free queues.
+//
+module;
+
+#include <Furud.hpp>
+#include <atomic>
+#include <new>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+
+
+export module Furud.Platform.Thread.Queue;
+
+namespace Furud::Internal
+{
+	furud_inline size_t RoundUpPowerOfTwo(size_t value) noexcept
+	{
+		size_t result = 2;
+		while (result < value)
+		{
+			result <<= 1;
+		}
+		return result;
+	}
+
+
+
+	/**
+	 * @brief    Uninitialized storage of an element.
+	 * @details  元素存储。
+	 */
+	template <typename T>
+	struct TQueueSlot
+	{
+		alignas(T) unsigned char bytes[sizeof(T)];
+
+		furud_inline T* Get() noexcept
+		{
+			return std::launder(reinterpret_cast<T*>(bytes));
+		}
+
+		template <typename... Args>
+		furud_inline void Construct(Args&&... args)
+		{
+			::new (static_cast<void*>(bytes)) T(std::forward<Args>(args)...);
+		}
+
+		/** Moves the element out and destroys it. */
+		furud_inline void MoveTo(T& out)
+		{
+			T* item = Get();
+			out = std::move(*item);
+			item->~T();
+		}
+	};
+}
+
+
+
+export namespace Furud
+{
+	/**
+	 * @brief    Bounded lock-free queue for multiple producers and multiple consumers.
+	 *           Each cell has a sequence number telling whether it is ready for the next push or pop,
+	 *           so producers and consumers only contend on their own position counter.
+	 * @see      "Bounded MPMC queue", Dmitry Vyukov.
+	 * @tparam   T  -  Element type.
+	 * @details  有界多生产者多消费者无锁队列。
+	 */
+	template <typename T>
+	class TMpmcQueue
+	{
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> sequence;
+			Internal::TQueueSlot<T> slot;
+		};
+
+		Cell* cells;
+		size_t mask;
+
+		alignas(64) std::atomic<size_t> enqueuePos { 0 };
+		alignas(64) std::atomic<size_t> dequeuePos { 0 };
+
+
+	public:
+		/**
+		 * @param    capacity  -  Rounded up to a power of two.
+		 */
+		explicit TMpmcQueue(size_t capacity)
+		{
+			capacity = Internal::RoundUpPowerOfTwo(capacity);
+			cells = new Cell[capacity];
+			mask = capacity - 1;
+			for (size_t index = 0; index < capacity; ++index)
+			{
+				cells[index].sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+
+		~TMpmcQueue()
+		{
+			const size_t tail = enqueuePos.load(std::memory_order_relaxed);
+			for (size_t position = dequeuePos.load(std::memory_order_relaxed); position != tail; ++position)
+			{
+				cells[position & mask].slot.Get()->~T();
+			}
+			delete[] cells;
+		}
+
+		TMpmcQueue(const TMpmcQueue&) = delete;
+		TMpmcQueue& operator = (const TMpmcQueue&) = delete;
+
+
+	public:
+		/**
+		 * @brief    Constructs an element at the tail.
+		 * @returns  False if the queue is full.
+		 * @details  入队。
+		 */
+		template <typename... Args>
+		bool TryPush(Args&&... args)
+		{
+			size_t position = enqueuePos.load(std::memory_order_relaxed);
+			Cell* cell;
+			while (true)
+			{
+				cell = &cells[position & mask];
+				const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+				const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+				if (difference == 0)
+				{
+					if (enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = enqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			cell->slot.Construct(std::forward<Args>(args)...);
+			cell->sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief    Pops the element at the head.
+		 * @returns  False if the queue is empty.
+		 * @details  出队。
+		 */
+		bool TryPop(T& out)
+		{
+			size_t position = dequeuePos.load(std::memory_order_relaxed);
+			Cell* cell;
+			while (true)
+			{
+				cell = &cells[position & mask];
+				const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+				const intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+				if (difference == 0)
+				{
+					if (dequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = dequeuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			cell->slot.MoveTo(out);
+			cell->sequence.store(position + mask + 1, std::memory_order_release);
+			return true;
+		}
+
+		furud_nodiscard furud_inline size_t Capacity() const noexcept
+		{
+			return mask + 1;
+		}
+
+		/**
+		 * @brief    The number of elements, may be stale.
+		 * @details  元素数量（近似值）。
+		 */
+		furud_nodiscard furud_inline size_t SizeApprox() const noexcept
+		{
+			const size_t tail = enqueuePos.load(std::memory_order_relaxed);
+			const size_t head = dequeuePos.load(std::memory_order_relaxed);
+			return tail > head ? tail - head : 0;
+		}
+	};
+
+
+
+	/**
+	 * @brief    Bounded wait-free ring buffer for a single producer and a single consumer.
+	 *           The producer and the consumer write their own index on separate cache lines,
+	 *           and cache the other index, so the shared lines are touched only when the cache runs out.
+	 * @tparam   T  -  Element type.
+	 * @details  单生产者单消费者环形缓冲区。
+	 */
+	template <typename T>
+	class TSpscQueue
+	{
+	private:
+		Internal::TQueueSlot<T>* slots;
+		size_t mask;
+
+		/** Producer side. */
+		alignas(64) std::atomic<size_t> tail { 0 };
+		size_t cachedHead = 0;
+
+		/** Consumer side. */
+		alignas(64) std::atomic<size_t> head { 0 };
+		size_t cachedTail = 0;
+
+
+	public:
+		/**
+		 * @param    capacity  -  Rounded up to a power of two.
+		 */
+		explicit TSpscQueue(size_t capacity)
+		{
+			capacity = Internal::RoundUpPowerOfTwo(capacity);
+			slots = new Internal::TQueueSlot<T>[capacity];
+			mask = capacity - 1;
+		}
+
+		~TSpscQueue()
+		{
+			while (T* item = Front())
+			{
+				item->~T();
+				head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
+			delete[] slots;
+		}
+
+		TSpscQueue(const TSpscQueue&) = delete;
+		TSpscQueue& operator = (const TSpscQueue&) = delete;
+
+
+	public:
+		/**
+		 * @brief    Constructs an element at the tail, called by the producer only.
+		 * @returns  False if the queue is full.
+		 * @details  入队（仅生产者线程）。
+		 */
+		template <typename... Args>
+		bool TryPush(Args&&... args)
+		{
+			const size_t position = tail.load(std::memory_order_relaxed);
+			if (position - cachedHead > mask)
+			{
+				cachedHead = head.load(std::memory_order_acquire);
+				if (position - cachedHead > mask)
+				{
+					return false;
+				}
+			}
+
+			slots[position & mask].Construct(std::forward<Args>(args)...);
+			tail.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief    Pops the element at the head, called by the consumer only.
+		 * @returns  False if the queue is empty.
+		 * @details  出队（仅消费者线程）。
+		 */
+		bool TryPop(T& out)
+		{
+			T* item = Front();
+			if (!item)
+			{
+				return false;
+			}
+
+			out = std::move(*item);
+			Pop();
+			return true;
+		}
+
+		/**
+		 * @brief    Peeks the element at the head without copy, called by the consumer only.
+		 * @returns  Null if the queue is empty.
+		 * @details  查看队首（仅消费者线程）。
+		 */
+		furud_nodiscard T* Front()
+		{
+			const size_t position = head.load(std::memory_order_relaxed);
+			if (position == cachedTail)
+			{
+				cachedTail = tail.load(std::memory_order_acquire);
+				if (position == cachedTail)
+				{
+					return nullptr;
+				}
+			}
+			return slots[position & mask].Get();
+		}
+
+		/**
+		 * @brief    Destroys the element returned by Front(), called by the consumer only.
+		 * @details  移除队首（仅消费者线程）。
+		 */
+		void Pop()
+		{
+			const size_t position = head.load(std::memory_order_relaxed);
+			slots[position & mask].Get()->~T();
+			head.store(position + 1, std::memory_order_release);
+		}
+
+		furud_nodiscard furud_inline size_t Capacity() const noexcept
+		{
+			return mask + 1;
+		}
+
+		/**
+		 * @brief    The number of elements, may be stale.
+		 * @details  元素数量（近似值）。
+		 */
+		furud_nodiscard furud_inline size_t SizeApprox() const noexcept
+		{
+			const size_t position = head.load(std::memory_order_acquire);
+			const size_t end = tail.load(std::memory_order_acquire);
+			return end > position ? end - position : 0;
+		}
+	};
+
+
+
+	/**
+	 * @brief    Hook of the elements of TMpscQueue.
+	 * @details  多生产者单消费者队列节点。
+	 */
+	struct MpscQueueNode
+	{
+		std::atomic<MpscQueueNode*> next { nullptr };
+	};
+
+
+	/**
+	 * @brief    Unbounded intrusive queue for multiple producers and a single consumer.
+	 *           A push is a single exchange, the nodes are owned by the caller, e.g. from TPool.
+	 * @see      "Intrusive MPSC node-based queue", Dmitry Vyukov.
+	 * @tparam   T  -  Element type derived from MpscQueueNode.
+	 * @details  无界多生产者单消费者侵入式队列。
+	 */
+	template <typename T> requires std::is_base_of_v<MpscQueueNode, T>
+	class TMpscQueue
+	{
+	private:
+		/** Producers exchange the newest node. */
+		alignas(64) std::atomic<MpscQueueNode*> head;
+
+		/** The consumer pops the oldest node. */
+		alignas(64) MpscQueueNode* tail;
+		MpscQueueNode stub;
+
+
+	public:
+		TMpscQueue() noexcept
+			: head(&stub)
+			, tail(&stub)
+		{}
+
+		TMpscQueue(const TMpscQueue&) = delete;
+		TMpscQueue& operator = (const TMpscQueue&) = delete;
+
+
+	public:
+		/**
+		 * @brief    Pushes a node, called by any thread, never blocks.
+		 * @details  入队（任意线程）。
+		 */
+		furud_inline void Push(T* item) noexcept
+		{
+			PushNode(static_cast<MpscQueueNode*>(item));
+		}
+
+		/**
+		 * @brief    Pops the oldest node, called by the consumer only.
+		 * @returns  Null if the queue is empty, or if the next producer has not linked its node yet.
+		 * @details  出队（仅消费者线程）。
+		 */
+		T* Pop() noexcept
+		{
+			MpscQueueNode* current = tail;
+			MpscQueueNode* next = current->next.load(std::memory_order_acquire);
+			if (current == &stub)
+			{
+				if (!next)
+				{
+					return nullptr;
+				}
+				tail = next;
+				current = next;
+				next = next->next.load(std::memory_order_acquire);
+			}
+
+			if (next)
+			{
+				tail = next;
+				return static_cast<T*>(current);
+			}
+
+			// The producer of the last node is still linking it.
+			if (current != head.load(std::memory_order_acquire))
+			{
+				return nullptr;
+			}
+
+			// Puts the stub back so the last node can leave.
+			PushNode(&stub);
+			next = current->next.load(std::memory_order_acquire);
+			if (next)
+			{
+				tail = next;
+				return static_cast<T*>(current);
+			}
+			return nullptr;
+		}
+
+		/**
+		 * @brief    Whether the queue looks empty, called by the consumer only.
+		 * @details  队列是否为空。
+		 */
+		furud_nodiscard furud_inline bool Empty() const noexcept
+		{
+			return tail == &stub && !stub.next.load(std::memory_order_acquire);
+		}
+
+
+	private:
+		furud_inline void PushNode(MpscQueueNode* node) noexcept
+		{
+			node->next.store(nullptr, std::memory_order_relaxed);
+			MpscQueueNode* previous = head.exchange(node, std::memory_order_acq_rel);
+			previous->next.store(node, std::memory_order_release);
+		}
+	};
+}
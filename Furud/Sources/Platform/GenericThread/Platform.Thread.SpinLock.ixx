@@ -10,13 +10,71 @@ module;
 
 #include <Furud.hpp>
 #include <atomic>
+#include <stdint.h>
+#include <thread>
+#include <immintrin.h>
 
 
 
 export module Furud.Platform.Thread.SpinLock;
 
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Exponential backoff of spinning, doubles the pauses each round,
+	 *           and yields the thread once the bound is reached.
+	 * @details  自旋退避。
+	 */
+	struct SpinBackoff
+	{
+		static constexpr uint32_t MaxPauses = 64;
+
+		uint32_t numPauses = 1;
+
+		/** Returns false once the spinning budget is used up. */
+		furud_inline bool Spin() noexcept
+		{
+			if (numPauses > MaxPauses)
+			{
+				return false;
+			}
+
+			for (uint32_t index = 0; index < numPauses; ++index)
+			{
+				_mm_pause();
+			}
+			numPauses <<= 1;
+			return true;
+		}
+
+		/** Spins, or yields the thread once the spinning budget is used up and counts it in `numYields`. */
+		furud_inline void Pause(std::atomic<uint64_t>& numYields) noexcept
+		{
+			if (!Spin())
+			{
+				numYields.fetch_add(1, std::memory_order_relaxed);
+				std::this_thread::yield();
+			}
+		}
+	};
+}
+
+
+
 export namespace Furud
 {
+	/**
+	 * @brief    Contention counters of a lock, relaxed, only the slow paths update them.
+	 * @details  锁竞争统计。
+	 */
+	struct LockStats
+	{
+		/** The number of acquisitions which found the lock taken. */
+		uint64_t numContended = 0;
+
+		/** The number of times a thread went to sleep, or yielded for SharedSpinLock. */
+		uint64_t numParked = 0;
+	};
 
 	/**
 	 * @brief    A mutex that doesn't put the thread into a WAIT state but instead repeatedly tries to aquire the lock.
@@ -90,4 +148,282 @@ export namespace Furud
 			guard.UnLock();
 		}
 	};
-}
\ No newline at end of file
+
+
+
+	/**
+	 * @brief    A mutex that spins with exponential backoff for a bounded time, then parks the thread
+	 *           on the lock word ( futex on linux, WaitOnAddress on windows ) until the owner wakes it.
+	 *           The state is 0 unlocked, 1 locked, 2 locked with sleepers, so unlocking an uncontended
+	 *           lock never makes a system call.
+	 * @see      "Futexes Are Tricky", Ulrich Drepper.
+	 * @details  自适应互斥锁。
+	 */
+	class AdaptiveMutex
+	{
+		std::atomic<uint32_t> state { 0 };
+
+		/** On their own cache line, the waiters bump them while the owner works on `state`. */
+		alignas(64) std::atomic<uint64_t> numContended { 0 };
+		std::atomic<uint64_t> numParked { 0 };
+
+
+	public:
+		AdaptiveMutex() noexcept = default;
+		AdaptiveMutex(const AdaptiveMutex&) = delete;
+		AdaptiveMutex& operator = (const AdaptiveMutex&) = delete;
+
+
+	public:
+		furud_inline void Lock() noexcept
+		{
+			uint32_t expected = 0;
+			if (!state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) furud_unlikely
+			{
+				LockSlow();
+			}
+		}
+
+		furud_inline bool TryLock() noexcept
+		{
+			uint32_t expected = 0;
+			return state.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+
+		furud_inline void UnLock() noexcept
+		{
+			if (state.exchange(0, std::memory_order_release) == 2) furud_unlikely
+			{
+				state.notify_one();
+			}
+		}
+
+		furud_inline bool IsLock() const noexcept
+		{
+			return state.load(std::memory_order_acquire) != 0;
+		}
+
+		furud_nodiscard LockStats GetStats() const noexcept
+		{
+			return { numContended.load(std::memory_order_relaxed), numParked.load(std::memory_order_relaxed) };
+		}
+
+
+	private:
+		void LockSlow() noexcept
+		{
+			numContended.fetch_add(1, std::memory_order_relaxed);
+
+			Internal::SpinBackoff backoff;
+			while (backoff.Spin())
+			{
+				uint32_t expected = 0;
+				if (state.load(std::memory_order_relaxed) == 0
+					&& state.compare_exchange_weak(expected, 1, std::memory_order_acquire, std::memory_order_relaxed))
+				{
+					return;
+				}
+			}
+
+			// Marks the lock as having sleepers, whoever gets it after this point must wake the others.
+			while (state.exchange(2, std::memory_order_acquire) != 0)
+			{
+				numParked.fetch_add(1, std::memory_order_relaxed);
+				state.wait(2, std::memory_order_relaxed);
+			}
+		}
+	};
+
+
+
+	/**
+	 * @brief    A writer-preferring reader-writer spin lock for read-mostly data.
+	 *           A waiting writer blocks new readers, so writers are not starved by a stream of readers.
+	 *           Waiters back off exponentially, then yield.
+	 * @note     Should be used only for short locks.
+	 * @details  写优先读写自旋锁。
+	 */
+	class SharedSpinLock
+	{
+		static constexpr uint32_t Writer        = 1u << 31;
+		static constexpr uint32_t WriterPending = 1u << 30;
+		static constexpr uint32_t ReaderMask    = WriterPending - 1;
+
+		std::atomic<uint32_t> state { 0 };
+
+		/** Apart from `state`, as in AdaptiveMutex. */
+		alignas(64) std::atomic<uint64_t> numContended { 0 };
+		std::atomic<uint64_t> numParked { 0 };
+
+
+	public:
+		SharedSpinLock() noexcept = default;
+		SharedSpinLock(const SharedSpinLock&) = delete;
+		SharedSpinLock& operator = (const SharedSpinLock&) = delete;
+
+
+	public:
+		/**
+		 * @brief    Acquires exclusive access.
+		 * @details  加写锁。
+		 */
+		void Lock() noexcept
+		{
+			if (TryLock()) furud_likely
+			{
+				return;
+			}
+
+			numContended.fetch_add(1, std::memory_order_relaxed);
+			Internal::SpinBackoff backoff;
+			while (true)
+			{
+				uint32_t current = state.load(std::memory_order_relaxed);
+				if ((current & ~WriterPending) == 0)
+				{
+					// Clears the pending bit, the other waiting writers set it again.
+					if (state.compare_exchange_weak(current, Writer, std::memory_order_acquire, std::memory_order_relaxed))
+					{
+						return;
+					}
+					continue;
+				}
+
+				if (!(current & WriterPending))
+				{
+					state.fetch_or(WriterPending, std::memory_order_relaxed);
+				}
+				backoff.Pause(numParked);
+			}
+		}
+
+		furud_inline bool TryLock() noexcept
+		{
+			uint32_t expected = 0;
+			return state.compare_exchange_strong(expected, Writer, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+
+		furud_inline void UnLock() noexcept
+		{
+			state.fetch_and(~Writer, std::memory_order_release);
+		}
+
+		/**
+		 * @brief    Acquires shared access, waits while a writer holds or waits for the lock.
+		 * @details  加读锁。
+		 */
+		void LockShared() noexcept
+		{
+			if (TryLockShared()) furud_likely
+			{
+				return;
+			}
+
+			numContended.fetch_add(1, std::memory_order_relaxed);
+			Internal::SpinBackoff backoff;
+			while (!TryLockShared())
+			{
+				backoff.Pause(numParked);
+			}
+		}
+
+		furud_inline bool TryLockShared() noexcept
+		{
+			uint32_t current = state.load(std::memory_order_relaxed);
+			while (!(current & (Writer | WriterPending)))
+			{
+				if (state.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		furud_inline void UnLockShared() noexcept
+		{
+			state.fetch_sub(1, std::memory_order_release);
+		}
+
+		furud_inline bool IsLock() const noexcept
+		{
+			return (state.load(std::memory_order_acquire) & Writer) != 0;
+		}
+
+		furud_inline uint32_t NumReaders() const noexcept
+		{
+			return state.load(std::memory_order_acquire) & ReaderMask;
+		}
+
+		furud_nodiscard LockStats GetStats() const noexcept
+		{
+			return { numContended.load(std::memory_order_relaxed), numParked.load(std::memory_order_relaxed) };
+		}
+	};
+
+
+
+	/**
+	 * @brief    A RAII structure for AdaptiveMutex.
+	 * @details  自适应互斥锁。
+	 */
+	struct AdaptiveScopeLock final
+	{
+		AdaptiveMutex& guard;
+
+		explicit AdaptiveScopeLock(AdaptiveMutex& mutex) noexcept
+			: guard(mutex)
+		{
+			guard.Lock();
+		}
+
+		~AdaptiveScopeLock()
+		{
+			guard.UnLock();
+		}
+	};
+
+
+
+	/**
+	 * @brief    A RAII structure for the shared access of SharedSpinLock.
+	 * @details  读锁。
+	 */
+	struct SharedScopeReadLock final
+	{
+		SharedSpinLock& guard;
+
+		explicit SharedScopeReadLock(SharedSpinLock& mutex) noexcept
+			: guard(mutex)
+		{
+			guard.LockShared();
+		}
+
+		~SharedScopeReadLock()
+		{
+			guard.UnLockShared();
+		}
+	};
+
+
+
+	/**
+	 * @brief    A RAII structure for the exclusive access of SharedSpinLock.
+	 * @details  写锁。
+	 */
+	struct SharedScopeWriteLock final
+	{
+		SharedSpinLock& guard;
+
+		explicit SharedScopeWriteLock(SharedSpinLock& mutex) noexcept
+			: guard(mutex)
+		{
+			guard.Lock();
+		}
+
+		~SharedScopeWriteLock()
+		{
+			guard.UnLock();
+		}
+	};
+}
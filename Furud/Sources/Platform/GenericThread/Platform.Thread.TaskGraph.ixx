@@ -0,0 +1,349 @@
+//
+// Platform.Thread.TaskGraph.ixx
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Dependency-aware task graph on the job system.
+//
+module;
+
+#include <Furud.hpp>
+#include <atomic>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+
+
+export module Furud.Platform.Thread.TaskGraph;
+
+import Furud.Platform.Thread.JobSystem;
+
+namespace Furud::Internal
+{
+	/**
+	 * @brief    A node of the task graph, runs after all its predecessors are done.
+	 * @details  任务图节点。
+	 */
+	struct TaskNode
+	{
+		std::function<void()> work;
+		std::vector<TaskNode*> successors;
+
+		/** Counts down the finished task of the whole graph. */
+		JobCounter* graphCounter = nullptr;
+
+		/** The number of predecessors, restored into `pending` each run. */
+		int32_t numPredecessors = 0;
+
+		/** Unfinished predecessors of current run. */
+		std::atomic<int32_t> pending { 0 };
+
+		JobPriority priority = JobPriority::Normal;
+
+		/** Position in the graph. */
+		uint32_t index = 0;
+
+
+		/**
+		 * @brief    Runs the node, then releases its successors.
+		 *           The first successor which becomes ready runs on the same thread as continuation,
+		 *           the others are scheduled, so a chain of tasks never goes back to the queues.
+		 * @details  执行任务图节点。
+		 */
+		static void ExecuteJob(void* data)
+		{
+			TaskNode* node = static_cast<TaskNode*>(data);
+			while (node)
+			{
+				node->work();
+
+				TaskNode* continuation = nullptr;
+				for (TaskNode* successor : node->successors)
+				{
+					if (successor->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					{
+						if (!continuation)
+						{
+							continuation = successor;
+						}
+						else
+						{
+							IJobSystem::Schedule(ExecuteJob, successor, nullptr, successor->priority);
+						}
+					}
+				}
+
+				// Must be the last access without continuation, the waiter may release the graph immediately.
+				// A pending continuation keeps the counter above zero.
+				node->graphCounter->value.fetch_sub(1, std::memory_order_acq_rel);
+				node = continuation;
+			}
+		}
+	};
+}
+
+
+
+export namespace Furud
+{
+	/**
+	 * @brief    A directed acyclic graph of tasks on the work-stealing job system.
+	 *           Each task runs once all its predecessors are done, the graph can be run again
+	 *           after it finished, so a per-frame graph is built once and reused every frame.
+	 *           The waiting thread executes jobs until the graph is done.
+	 * @note     The graph must not be modified while running.
+	 * @details  任务图。
+	 */
+	class TaskGraph
+	{
+	public:
+		/**
+		 * @brief    Handle of a task in the graph.
+		 * @details  任务句柄。
+		 */
+		class Task
+		{
+			friend class TaskGraph;
+
+			TaskGraph* graph = nullptr;
+			Internal::TaskNode* node = nullptr;
+
+			Task(TaskGraph* inGraph, Internal::TaskNode* inNode) noexcept : graph(inGraph), node(inNode) {}
+
+
+		public:
+			Task() noexcept = default;
+
+			furud_nodiscard furud_inline bool IsValid() const noexcept
+			{
+				return node != nullptr;
+			}
+
+			/**
+			 * @brief    Makes the tasks run after this task, ( fan-out ).
+			 * @details  指定后继任务。
+			 */
+			template <typename... Tasks>
+			Task& Precede(Tasks... tasks)
+			{
+				assert(IsValid() && ((tasks.graph == graph) && ...) && "Tasks must belong to the same graph.");
+				(graph->Link(node, tasks.node), ...);
+				return *this;
+			}
+
+			/**
+			 * @brief    Makes this task run after the tasks, ( fan-in ).
+			 * @details  指定前驱任务。
+			 */
+			template <typename... Tasks>
+			Task& Succeed(Tasks... tasks)
+			{
+				assert(IsValid() && ((tasks.graph == graph) && ...) && "Tasks must belong to the same graph.");
+				(graph->Link(tasks.node, node), ...);
+				return *this;
+			}
+		};
+
+
+	private:
+		/** Deque keeps the nodes in place when adding tasks. */
+		std::deque<Internal::TaskNode> nodes;
+
+		JobCounter counter;
+
+		/** Whether the edges changed since the last cycle check. */
+		bool bDirty = false;
+
+
+	public:
+		TaskGraph() = default;
+		TaskGraph(const TaskGraph&) = delete;
+		TaskGraph& operator = (const TaskGraph&) = delete;
+
+		~TaskGraph()
+		{
+			Wait();
+		}
+
+
+	public:
+		/**
+		 * @brief    Adds a task.
+		 * @param    function  -  Task body, called as `function()`.
+		 * @param    priority  -  Job priority when the task is scheduled.
+		 * @details  添加任务。
+		 */
+		template <typename F> requires std::is_invocable_v<F&>
+		Task Add(F&& function, JobPriority priority = JobPriority::Normal)
+		{
+			Internal::TaskNode& node = nodes.emplace_back();
+			node.work = std::function<void()>(std::forward<F>(function));
+			node.graphCounter = &counter;
+			node.priority = priority;
+			node.index = (uint32_t)(nodes.size() - 1);
+			return Task(this, &node);
+		}
+
+		/**
+		 * @brief    Adds a task with a job entry point.
+		 * @details  添加任务。
+		 */
+		Task Add(JobProc proc, void* data, JobPriority priority = JobPriority::Normal)
+		{
+			return Add([proc, data]() { proc(data); }, priority);
+		}
+
+		/**
+		 * @brief    Adds a task which runs after all the tasks, ( join point ).
+		 * @details  添加汇合任务。
+		 */
+		template <typename F, typename... Tasks> requires std::is_invocable_v<F&>
+		Task AddAfter(F&& function, Tasks... predecessors)
+		{
+			Task task = Add(std::forward<F>(function));
+			task.Succeed(predecessors...);
+			return task;
+		}
+
+		/**
+		 * @brief    Removes all tasks, the graph must not be running.
+		 * @details  清空任务图。
+		 */
+		void Clear()
+		{
+			Wait();
+			nodes.clear();
+			bDirty = false;
+		}
+
+		furud_nodiscard furud_inline size_t NumTasks() const noexcept
+		{
+			return nodes.size();
+		}
+
+		furud_nodiscard furud_inline bool IsDone() const noexcept
+		{
+			return counter.IsDone();
+		}
+
+
+	public:
+		/**
+		 * @brief    Schedules the tasks without predecessors, then returns immediately.
+		 * @returns  False if the graph is running or has a cycle.
+		 * @details  开始执行任务图。
+		 */
+		bool Run()
+		{
+			if (nodes.empty())
+			{
+				return true;
+			}
+
+			if (!counter.IsDone())
+			{
+				return false;
+			}
+
+			if (bDirty)
+			{
+				if (HasCycle())
+				{
+					return false;
+				}
+				bDirty = false;
+			}
+
+			// All counters are reset before the first task starts.
+			for (Internal::TaskNode& node : nodes)
+			{
+				node.pending.store(node.numPredecessors, std::memory_order_relaxed);
+			}
+			counter.value.store((int32_t)nodes.size(), std::memory_order_release);
+
+			for (Internal::TaskNode& node : nodes)
+			{
+				if (node.numPredecessors == 0)
+				{
+					IJobSystem::Schedule(Internal::TaskNode::ExecuteJob, &node, nullptr, node.priority);
+				}
+			}
+			return true;
+		}
+
+		/**
+		 * @brief    Waits until all tasks are done, the calling thread executes jobs meanwhile.
+		 * @details  等待任务图完成。
+		 */
+		void Wait()
+		{
+			if (!counter.IsDone())
+			{
+				IJobSystem::Wait(counter);
+			}
+		}
+
+		/**
+		 * @brief    Runs the graph and waits for it.
+		 * @returns  False if the graph is running or has a cycle.
+		 * @details  执行并等待任务图。
+		 */
+		bool RunAndWait()
+		{
+			if (!Run())
+			{
+				return false;
+			}
+			Wait();
+			return true;
+		}
+
+
+	private:
+		void Link(Internal::TaskNode* from, Internal::TaskNode* to)
+		{
+			from->successors.push_back(to);
+			++to->numPredecessors;
+			bDirty = true;
+		}
+
+		/** Kahn's algorithm, the graph has a cycle if some task never becomes ready. */
+		bool HasCycle() const
+		{
+			std::vector<int32_t> remaining;
+			std::vector<const Internal::TaskNode*> ready;
+			remaining.reserve(nodes.size());
+
+			for (const Internal::TaskNode& node : nodes)
+			{
+				remaining.push_back(node.numPredecessors);
+				if (node.numPredecessors == 0)
+				{
+					ready.push_back(&node);
+				}
+			}
+
+			size_t numVisited = 0;
+			while (!ready.empty())
+			{
+				const Internal::TaskNode* node = ready.back();
+				ready.pop_back();
+				++numVisited;
+
+				for (const Internal::TaskNode* successor : node->successors)
+				{
+					if (--remaining[successor->index] == 0)
+					{
+						ready.push_back(successor);
+					}
+				}
+			}
+			return numVisited != nodes.size();
+		}
+	};
+}
@@ -4,43 +4,60 @@
 //       Copyright (c) Furud Engine. All rights reserved.
 //       @author FongZiSing
 //
-// Warpper Of Windows Concurrency Runtime.
+// Lightweight async task on the job system.
 //
 module;
 
-#include <concrt.h>
+#include <Furud.hpp>
+#include <chrono>
+#include <stdint.h>
+#include <thread>
 
 
 
 export module Furud.Platform.Thread.TinyTask;
 
+import Furud.Platform.Thread.JobSystem;
+
 namespace Furud::Internal
 {
 	/**
-	 * @brief  A runnable lightweiget async task base on window concurrency runtime library.
-	 * @see    https://docs.microsoft.com/en-us/cpp/parallel/concrt/reference/currentscheduler-class?view=msvc-170#scheduletask
-	 * @see    https://docs.microsoft.com/en-us/cpp/parallel/concrt/walkthrough-adapting-existing-code-to-use-lightweight-tasks?view=msvc-170
+	 * @brief  A runnable lightweiget async task base on the work-stealing job system.
 	 */
 	class TinyTask
 	{
-		Concurrency::event signal;
+		JobCounter counter;
 
 
 	public:
-		void Start(Concurrency::TaskProc task, void* data)
+		void Start(JobProc task, void* data)
 		{
-			signal.reset();
-			Concurrency::CurrentScheduler::ScheduleTask(task, data);
+			IJobSystem::Schedule(task, data, &counter);
 		}
 
-		void Finish()
+		uint64_t Wait(uint32_t timeout)
 		{
-			signal.set();
-		}
+			if (timeout == uint32_t(-1))
+			{
+				IJobSystem::Wait(counter);
+				return 0;
+			}
 
-		size_t Wait(uint32_t timeout)
-		{
-			return signal.wait(timeout);
+			// Helps the job system until the task is done or the wait times out.
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+			while (!counter.IsDone())
+			{
+				if (std::chrono::steady_clock::now() >= deadline)
+				{
+					return uint32_t(-1);
+				}
+
+				if (!IJobSystem::TryExecuteOne())
+				{
+					std::this_thread::yield();
+				}
+			}
+			return 0;
 		}
 	};
 }
@@ -64,15 +81,15 @@ export namespace Furud
 
 
 	private:
-		static void __cdecl DoWorkInternal(void* instance)
+		static void DoWorkInternal(void* instance)
 		{
 			TinyTask* pThis = static_cast<TinyTask*>(instance);
 			if (pThis->Init())
 			{
 				pThis->DoWork();
 			}
-			
-			pThis->task.Finish();
+
+			// The job system marks the task finished after return.
 		}
 
 
@@ -8,12 +8,22 @@
 //
 module;
 
+#include <Furud.hpp>
+#include <stdint.h>
+#include <string.h>
+
+#if FURUD_OS_WIN
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <Windows.h>
-#include <Furud.hpp>
 #include <process.h>
-#include <stdint.h>
+#else
+#include <atomic>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 
 
@@ -70,7 +80,7 @@ namespace Furud::Internal
 		 * @brief    Initializes Thread with the specified option.
 		 * @details  初始化线程。
 		 */
-		virtual bool Init(Option = {}) = 0;
+		virtual bool Init(Option = { nullptr, Priority::Default, InitFlag::CreateRunnable }) = 0;
 
 
 		/**
@@ -116,6 +126,7 @@ namespace Furud::Internal
 
 
 /** Thread utility. */
+#if FURUD_OS_WIN
 namespace Furud::Internal
 {
 	/**
@@ -174,6 +185,31 @@ namespace Furud::Internal
 		}
 	}
 }
+#else
+namespace Furud::Internal
+{
+	/**
+	 * @brief    Setting a thread name in native code.
+	 * @note     The name is truncated to 15 characters by the kernel.
+	 * @see      https://man7.org/linux/man-pages/man3/pthread_setname_np.3.html
+	 * @details  设置当前所在线程的名字。
+	 */
+	void SetThreadName(const char* threadName)
+	{
+		char name[16] = {};
+		::strncpy(name, threadName, sizeof(name) - 1);
+		::pthread_setname_np(::pthread_self(), name);
+	}
+
+
+	/**
+	 * @brief    Assigns a description to a thread.
+	 * @note     Posix threads have no description, so does nothing.
+	 * @details  设置当前所在线程的描述符。
+	 */
+	void SetThreadDescription(const wchar_t*) {}
+}
+#endif
 
 
 
@@ -193,8 +229,22 @@ export namespace Furud
 		}
 		details;
 		
+#if FURUD_OS_WIN
 		/** The handle to this thread. */
 		void* handle;
+#else
+		/** The handle to this thread. */
+		pthread_t handle;
+
+		/** Whether the handle is still owned by this object. */
+		bool bJoinable;
+
+		/** Posix threads can not be suspended, so the suspension is emulated before running. */
+		std::atomic<bool> bSuspended;
+
+		/** Set by the new thread once `details.id` is published, Init waits for it. */
+		std::atomic<bool> bStarted;
+#endif
 		
 		/** The priority value to this thread. */
 		IThread::Priority priority;
@@ -203,7 +253,14 @@ export namespace Furud
 	public:
 		Thread()
 			: details()
+#if FURUD_OS_WIN
 			, handle(nullptr)
+#else
+			, handle()
+			, bJoinable(false)
+			, bSuspended(false)
+			, bStarted(false)
+#endif
 			, priority(Priority::Default)
 		{}
 
@@ -220,11 +277,15 @@ export namespace Furud
 		virtual bool Init(IThread::Option option) final
 		{
 			// Create thread once.
-			if (handle)
+			if (IsCreated())
 			{
 				return false;
 			}
 
+			// Initialize thread name, the new thread applies it by itself.
+			SetThreadName(option.threadName ? option.threadName : "Furud Thread");
+
+#if FURUD_OS_WIN
 			// Launch a new thread.
 			// see https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/beginthread-beginthreadex
 			handle = (HANDLE)::_beginthreadex
@@ -244,9 +305,25 @@ export namespace Furud
 
 			// Initialize thread priority.
 			SetPriority(option.threadPriority);
+#else
+			// Launch a new thread.
+			// see https://man7.org/linux/man-pages/man3/pthread_create.3.html
+			bSuspended.store(option.threadInitFlag == InitFlag::CreateSuspended, std::memory_order_release);
+			bStarted.store(false, std::memory_order_relaxed);
+			if (::pthread_create(&handle, nullptr, ThreadProc, this) != 0)
+			{
+				details.id = 0;
+				return false;
+			}
 
-			// Initialize thread name.
-			SetThreadName(option.threadName);
+			bJoinable = true;
+
+			// The thread id is known only by the new thread, waits until it is published.
+			bStarted.wait(false, std::memory_order_acquire);
+
+			// Initialize thread priority.
+			SetPriority(option.threadPriority);
+#endif
 
 			return true;
 		}
@@ -260,6 +337,7 @@ export namespace Furud
 		 */
 		virtual void Suspend(bool bPause) final
 		{
+#if FURUD_OS_WIN
 			if (handle)
 			{
 				if (bPause)
@@ -276,6 +354,14 @@ export namespace Furud
 					::ResumeThread(handle);
 				}
 			}
+#else
+			// Posix threads can not be paused from outside, a running thread ignores the pause request.
+			bSuspended.store(bPause, std::memory_order_release);
+			if (!bPause)
+			{
+				bSuspended.notify_all();
+			}
+#endif
 		}
 
 
@@ -286,6 +372,7 @@ export namespace Furud
 		 */
 		virtual void Kill(bool bWait) final
 		{
+#if FURUD_OS_WIN
 			if (handle)
 			{
 				if (bWait)
@@ -300,6 +387,15 @@ export namespace Furud
 				handle = nullptr;
 				details.id = 0;
 			}
+#else
+			if (bJoinable)
+			{
+				// Never cancel the thread, same reason as above.
+				bWait ? ::pthread_join(handle, nullptr) : ::pthread_detach(handle);
+				bJoinable = false;
+				details.id = 0;
+			}
+#endif
 		}
 
 
@@ -309,12 +405,21 @@ export namespace Furud
 		 */
 		virtual void WaitForCompletion() final
 		{
+#if FURUD_OS_WIN
 			if (handle)
 			{
 				// Waits until this thread is in the signaled state or the time-out interval elapses.
 				// see https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
 				::WaitForSingleObject(handle, INFINITE);
 			}
+#else
+			if (bJoinable)
+			{
+				// A posix thread can be joined only once.
+				::pthread_join(handle, nullptr);
+				bJoinable = false;
+			}
+#endif
 		}
 
 
@@ -324,6 +429,7 @@ export namespace Furud
 		 */
 		virtual void SetPriority(Priority inPriority) final
 		{
+#if FURUD_OS_WIN
 			if (handle)
 			{
 				priority = inPriority;
@@ -332,6 +438,15 @@ export namespace Furud
 				// see https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-setthreadpriority
 				::SetThreadPriority(handle, TranslateThreadPriority(inPriority));
 			}
+#else
+			priority = inPriority;
+
+			// The thread id has been published by Init.
+			if (details.id)
+			{
+				ApplyPriority(details.id, inPriority);
+			}
+#endif
 		}
 
 
@@ -352,7 +467,28 @@ export namespace Furud
 
 			// Convert to widechar string.
 			details.description[len] = 0;
+#if FURUD_OS_WIN
 			MultiByteToWideChar(CP_ACP, 0, details.name, len, details.description, len);
+#else
+			for (int32_t index = 0; index < len; ++index)
+			{
+				details.description[index] = (wchar_t)(unsigned char)details.name[index];
+			}
+#endif
+		}
+
+
+		/**
+		 * @brief    Whether the native thread has been launched.
+		 * @details  线程是否已创建。
+		 */
+		bool IsCreated() const
+		{
+#if FURUD_OS_WIN
+			return handle != nullptr;
+#else
+			return bJoinable;
+#endif
 		}
 
 
@@ -360,6 +496,7 @@ export namespace Furud
 		 * @brief    The real thread entry point.
 		 * @details  线程中执行的函数。
 		 */
+#if FURUD_OS_WIN
 		static unsigned __stdcall ThreadProc(void* args)
 		{
 			Thread* this_thread = reinterpret_cast<Thread*>(args);
@@ -377,6 +514,34 @@ export namespace Furud
 
 			return 0;
 		}
+#else
+		static void* ThreadProc(void* args)
+		{
+			Thread* this_thread = reinterpret_cast<Thread*>(args);
+			if (this_thread)
+			{
+				Internal::SetThreadName(this_thread->details.name);
+
+#if FURUD_OS_LINUX
+				this_thread->details.id = (uint32_t)::syscall(SYS_gettid);
+#endif
+
+				// Publishes the thread id before Init returns.
+				this_thread->bStarted.store(true, std::memory_order_release);
+				this_thread->bStarted.notify_all();
+
+				// Emulates `CREATE_SUSPENDED`.
+				while (this_thread->bSuspended.load(std::memory_order_acquire))
+				{
+					this_thread->bSuspended.wait(true, std::memory_order_acquire);
+				}
+
+				this_thread->Run();
+			}
+
+			return nullptr;
+		}
+#endif
 
 
 	protected:
@@ -388,6 +553,7 @@ export namespace Furud
 
 
 	private:
+#if FURUD_OS_WIN
 		static int TranslateThreadPriority(IThread::Priority priority)
 		{
 			// Translates the enumeration to thread's priority value.
@@ -410,5 +576,25 @@ export namespace Furud
 			// see https://learn.microsoft.com/en-us/windows/win32/procthread/process-creation-flags#flags
 			return (initFlag == InitFlag::CreateSuspended) ? CREATE_SUSPENDED : 0;
 		}
+#else
+		static void ApplyPriority(uint32_t threadId, IThread::Priority priority)
+		{
+			// Linux schedules normal threads by nice value, and each thread has its own nice value.
+			// Raising the priority needs privileges, so failure is ignored.
+			// see https://man7.org/linux/man-pages/man2/setpriority.2.html
+			int niceValue = 0;
+			switch (priority)
+			{
+			case IThread::Priority::Low:      niceValue = 10;  break;
+			case IThread::Priority::Normal:   niceValue = 0;   break;
+			case IThread::Priority::High:     niceValue = -5;  break;
+			case IThread::Priority::Critical: niceValue = -10; break;
+
+			default: break;
+			}
+
+			::setpriority(PRIO_PROCESS, threadId, niceValue);
+		}
+#endif
 	};
 }
\ No newline at end of file
@@ -0,0 +1,200 @@
+//
+// LockBench.cpp
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Times AdaptiveMutex and SharedSpinLock against AtomicSpinLock and std::mutex with 2 to 64 threads
+// hammering one lock, for exclusive access and for read-mostly access ( 1 write per 16 acquisitions ).
+// Contention only shows on a multi-core machine, on a single core the numbers measure the scheduler.
+//
+// Usage: LockBench [numAcquisitions]
+//        The threads share numAcquisitions acquisitions per test ( default 1000000 ).
+//        The exit code is the number of tests whose protected data came out wrong.
+//
+#include <Furud.hpp>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+import Furud.Platform.Thread.SpinLock;
+
+using namespace Furud;
+
+
+
+/** Lock adapters. */
+namespace
+{
+	template <typename L>
+	struct TLockTraits
+	{
+		static void Lock(L& lock)         { lock.Lock(); }
+		static void UnLock(L& lock)       { lock.UnLock(); }
+		static void LockShared(L& lock)   { lock.Lock(); }
+		static void UnLockShared(L& lock) { lock.UnLock(); }
+		static LockStats GetStats(L&)     { return {}; }
+	};
+
+	template <>
+	struct TLockTraits<std::mutex>
+	{
+		static void Lock(std::mutex& lock)         { lock.lock(); }
+		static void UnLock(std::mutex& lock)       { lock.unlock(); }
+		static void LockShared(std::mutex& lock)   { lock.lock(); }
+		static void UnLockShared(std::mutex& lock) { lock.unlock(); }
+		static LockStats GetStats(std::mutex&)     { return {}; }
+	};
+
+	template <>
+	struct TLockTraits<AdaptiveMutex>
+	{
+		static void Lock(AdaptiveMutex& lock)         { lock.Lock(); }
+		static void UnLock(AdaptiveMutex& lock)       { lock.UnLock(); }
+		static void LockShared(AdaptiveMutex& lock)   { lock.Lock(); }
+		static void UnLockShared(AdaptiveMutex& lock) { lock.UnLock(); }
+		static LockStats GetStats(AdaptiveMutex& lock) { return lock.GetStats(); }
+	};
+
+	template <>
+	struct TLockTraits<SharedSpinLock>
+	{
+		static void Lock(SharedSpinLock& lock)         { lock.Lock(); }
+		static void UnLock(SharedSpinLock& lock)       { lock.UnLock(); }
+		static void LockShared(SharedSpinLock& lock)   { lock.LockShared(); }
+		static void UnLockShared(SharedSpinLock& lock) { lock.UnLockShared(); }
+		static LockStats GetStats(SharedSpinLock& lock) { return lock.GetStats(); }
+	};
+}
+
+
+
+/** Benchmark. */
+namespace
+{
+	/** The data behind the lock, a few cache lines like a small table. */
+	struct ProtectedData
+	{
+		int64_t values[32] = {};
+	};
+
+
+	struct Result
+	{
+		double nsPerAcquisition = 0.0;
+		LockStats stats;
+		bool bCorrect = true;
+	};
+
+
+	/**
+	 * @brief    Runs `numThreads` threads, released together, sharing `numAcquisitions` acquisitions.
+	 *           With `writeInterval` 1 every acquisition writes, otherwise one in `writeInterval` does
+	 *           and the others read under shared access.
+	 */
+	template <typename L>
+	Result Run(uint32_t numThreads, uint32_t numAcquisitions, uint32_t writeInterval)
+	{
+		using Traits = TLockTraits<L>;
+
+		L lock;
+		ProtectedData data;
+		std::atomic<bool> bStart { false };
+		std::atomic<bool> bTorn { false };
+		const uint32_t numPerThread = numAcquisitions / numThreads;
+
+		std::vector<std::thread> threads;
+		threads.reserve(numThreads);
+		for (uint32_t index = 0; index < numThreads; ++index)
+		{
+			threads.emplace_back([&]
+			{
+				while (!bStart.load(std::memory_order_acquire))
+				{
+					std::this_thread::yield();
+				}
+
+				for (uint32_t count = 0; count < numPerThread; ++count)
+				{
+					if (count % writeInterval == 0)
+					{
+						Traits::Lock(lock);
+						for (int64_t& value : data.values) ++value;
+						Traits::UnLock(lock);
+					}
+					else
+					{
+						Traits::LockShared(lock);
+						const int64_t first = data.values[0];
+						for (const int64_t& value : data.values)
+						{
+							if (value != first) bTorn.store(true, std::memory_order_relaxed);
+						}
+						Traits::UnLockShared(lock);
+					}
+				}
+			});
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		bStart.store(true, std::memory_order_release);
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+		const int64_t numWrites = int64_t(numThreads) * ((numPerThread + writeInterval - 1) / writeInterval);
+		Result result;
+		result.nsPerAcquisition = elapsed.count() / double(numPerThread * numThreads);
+		result.stats = Traits::GetStats(lock);
+		result.bCorrect = !bTorn.load() && std::all_of(data.values, data.values + 32, [&](int64_t value) { return value == numWrites; });
+		return result;
+	}
+
+
+	template <typename L>
+	int Report(const char* name, uint32_t numThreads, uint32_t numAcquisitions, uint32_t writeInterval)
+	{
+		const Result result = Run<L>(numThreads, numAcquisitions, writeInterval);
+		printf("  %-26s %10.1f %14llu %12llu%s\n", name, result.nsPerAcquisition,
+			(unsigned long long)result.stats.numContended, (unsigned long long)result.stats.numParked,
+			result.bCorrect ? "" : "   WRONG");
+		return result.bCorrect ? 0 : 1;
+	}
+}
+
+
+
+int main(int argc, char** argv)
+{
+	const uint32_t numAcquisitions = argc > 1 ? (uint32_t)std::max(64, atoi(argv[1])) : 1000000u;
+	printf("[Furud] %u hardware threads, %u acquisitions per test, sizeof(AdaptiveMutex) = %zu, sizeof(SharedSpinLock) = %zu\n",
+		std::thread::hardware_concurrency(), numAcquisitions, sizeof(AdaptiveMutex), sizeof(SharedSpinLock));
+
+	int numFailures = 0;
+	for (uint32_t numThreads : { 2u, 4u, 8u, 16u, 32u, 64u })
+	{
+		char title[64];
+		::snprintf(title, sizeof(title), "%u threads, exclusive", numThreads);
+		printf("\n%-28s %10s %14s %12s\n", title, "ns/acquire", "contended", "parked");
+		numFailures += Report<AtomicSpinLock>("AtomicSpinLock", numThreads, numAcquisitions, 1);
+		numFailures += Report<AdaptiveMutex>("AdaptiveMutex", numThreads, numAcquisitions, 1);
+		numFailures += Report<SharedSpinLock>("SharedSpinLock", numThreads, numAcquisitions, 1);
+		numFailures += Report<std::mutex>("std::mutex", numThreads, numAcquisitions, 1);
+
+		::snprintf(title, sizeof(title), "%u threads, 1 write in 16", numThreads);
+		printf("%-28s %10s %14s %12s\n", title, "ns/acquire", "contended", "parked");
+		numFailures += Report<AtomicSpinLock>("AtomicSpinLock", numThreads, numAcquisitions, 16);
+		numFailures += Report<AdaptiveMutex>("AdaptiveMutex", numThreads, numAcquisitions, 16);
+		numFailures += Report<SharedSpinLock>("SharedSpinLock", numThreads, numAcquisitions, 16);
+		numFailures += Report<std::mutex>("std::mutex", numThreads, numAcquisitions, 16);
+	}
+	return numFailures;
+}
@@ -0,0 +1,288 @@
+//
+// NumberParsing.cpp
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Measures the throughput of TCharArrayView::ToDouble/ToFloat/ToInt64 against the C library
+// ( strtod/strtof/strtoll, the path used before Platform.API.CharArray-Number.ixx ) on OBJ-style vertex text,
+// and checks that both agree bit for bit, i.e. the new parser is correctly rounded.
+//
+// Usage: NumberParsing [numVertices]
+//        The text has numVertices lines of each "v", "vt" and "vn", and as many "f" lines ( default 200000 ).
+//        The exit code is the number of disagreements.
+//
+#include <Furud.hpp>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+import Furud.Platform.API.CharArray;
+
+using namespace Furud;
+
+
+
+/** Test data. */
+namespace
+{
+	/** A number in the text, not null-terminated but followed by a separator. */
+	struct Token
+	{
+		const char* data;
+		size_t size;
+	};
+
+
+	struct ObjText
+	{
+		std::string text;
+		std::vector<Token> reals;
+		std::vector<Token> integers;
+		size_t realBytes = 0;
+		size_t integerBytes = 0;
+	};
+
+
+	/**
+	 * @brief    Writes positions, texture coordinates, normals and faces like common exporters do,
+	 *           "%.6f" mostly, and a few values with exponents or more digits.
+	 */
+	ObjText GenerateObj(uint32_t numVertices)
+	{
+		std::mt19937_64 random(20241017);
+		std::uniform_real_distribution<double> position(-250.0, 250.0);
+		std::uniform_real_distribution<double> unit(-1.0, 1.0);
+		std::uniform_real_distribution<double> texcoord(0.0, 1.0);
+		std::uniform_int_distribution<uint32_t> vertex(1, numVertices);
+
+		ObjText obj;
+		obj.text.reserve((size_t)numVertices * 140);
+		char line[256];
+
+		const auto real = [&](double value) -> const char*
+		{
+			static char buffer[64];
+			const uint64_t style = random() % 16;
+			if (style == 0)
+			{
+				snprintf(buffer, sizeof(buffer), "%.9e", value);
+			}
+			else if (style == 1)
+			{
+				snprintf(buffer, sizeof(buffer), "%.17g", value);
+			}
+			else
+			{
+				snprintf(buffer, sizeof(buffer), "%.6f", value);
+			}
+			return buffer;
+		};
+
+		for (uint32_t index = 0; index < numVertices; ++index)
+		{
+			std::string v = "v";
+			for (int axis = 0; axis < 3; ++axis) { v += ' '; v += real(position(random)); }
+			obj.text += v + '\n';
+
+			std::string vt = "vt";
+			for (int axis = 0; axis < 2; ++axis) { vt += ' '; vt += real(texcoord(random)); }
+			obj.text += vt + '\n';
+
+			std::string vn = "vn";
+			for (int axis = 0; axis < 3; ++axis) { vn += ' '; vn += real(unit(random)); }
+			obj.text += vn + '\n';
+
+			const uint32_t a = vertex(random), b = vertex(random), c = vertex(random);
+			snprintf(line, sizeof(line), "f %u/%u/%u %u/%u/%u %u/%u/%u\n", a, a, a, b, b, b, c, c, c);
+			obj.text += line;
+		}
+
+		// Tokenizes once, so the timing covers the conversion only.
+		const char* cursor = obj.text.data();
+		const char* end = cursor + obj.text.size();
+		while (cursor < end)
+		{
+			const char* lineEnd = (const char*)memchr(cursor, '\n', size_t(end - cursor));
+			const bool bFace = cursor[0] == 'f';
+			const char* first = (const char*)memchr(cursor, ' ', size_t(lineEnd - cursor)) + 1;
+			while (first < lineEnd)
+			{
+				const char* last = first;
+				while (last < lineEnd && *last != ' ' && *last != '/') ++last;
+				if (bFace)
+				{
+					obj.integers.push_back({ first, size_t(last - first) });
+					obj.integerBytes += size_t(last - first);
+				}
+				else
+				{
+					obj.reals.push_back({ first, size_t(last - first) });
+					obj.realBytes += size_t(last - first);
+				}
+				first = last + 1;
+			}
+			cursor = lineEnd + 1;
+		}
+		return obj;
+	}
+}
+
+
+
+/** Benchmark. */
+namespace
+{
+	/** Returns the best time of a few rounds in seconds. */
+	template <typename F>
+	double Time(const F& function)
+	{
+		double best = 1e30;
+		for (int round = 0; round < 7; ++round)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			function();
+			const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			best = std::min(best, elapsed.count());
+		}
+		return best;
+	}
+
+
+	/** Keeps the results alive. */
+	volatile double sink = 0;
+
+
+	template <typename T, typename FNew, typename FOld>
+	int Compare(const char* name, const char* oldName, const std::vector<Token>& tokens, size_t bytes, const FNew& parseNew, const FOld& parseOld)
+	{
+		std::vector<T> results(tokens.size());
+		std::vector<T> references(tokens.size());
+
+		const double timeNew = Time([&]
+		{
+			for (size_t index = 0; index < tokens.size(); ++index)
+			{
+				results[index] = parseNew(tokens[index]);
+			}
+			sink = sink + (double)results[tokens.size() / 2];
+		});
+		const double timeOld = Time([&]
+		{
+			for (size_t index = 0; index < tokens.size(); ++index)
+			{
+				references[index] = parseOld(tokens[index]);
+			}
+			sink = sink + (double)references[tokens.size() / 2];
+		});
+
+		int numMismatches = 0;
+		for (size_t index = 0; index < tokens.size(); ++index)
+		{
+			if (memcmp(&results[index], &references[index], sizeof(T)) != 0)
+			{
+				if (++numMismatches <= 5)
+				{
+					printf("  mismatch %.*s\n", (int)tokens[index].size, tokens[index].data);
+				}
+			}
+		}
+
+		const double megabytes = (double)bytes / (1024.0 * 1024.0);
+		printf("%-9s %8.1f MB/s   %-8s %8.1f MB/s   x%.2f   %zu values, %d mismatches\n",
+			name, megabytes / timeNew, oldName, megabytes / timeOld, timeOld / timeNew, tokens.size(), numMismatches);
+		return numMismatches;
+	}
+
+
+	/**
+	 * @brief    Random decimal strings around the hard cases of rounding: many digits, extreme exponents,
+	 *           subnormals, halfway points printed with %.17g / %.9g.
+	 */
+	int CheckRounding(size_t num)
+	{
+		std::mt19937_64 random(7);
+		int numMismatches = 0;
+		char buffer[96];
+		for (size_t index = 0; index < num; ++index)
+		{
+			const uint64_t style = random() % 4;
+			if (style == 0)
+			{
+				double value;
+				const uint64_t bits = random();
+				memcpy(&value, &bits, sizeof(value));
+				if (value != value || value - value != 0) continue;
+				snprintf(buffer, sizeof(buffer), "%.17g", value);
+			}
+			else if (style == 1)
+			{
+				float value;
+				const uint32_t bits = (uint32_t)random();
+				memcpy(&value, &bits, sizeof(value));
+				if (value != value || value - value != 0) continue;
+				snprintf(buffer, sizeof(buffer), "%.9g", value);
+			}
+			else if (style == 2)
+			{
+				// The midpoint between two adjacent doubles needs all its digits.
+				double value;
+				const uint64_t bits = random() >> 2;
+				memcpy(&value, &bits, sizeof(value));
+				snprintf(buffer, sizeof(buffer), "%.40e", value + 0.5 * (nextafter(value, 1e308) - value));
+			}
+			else
+			{
+				int length = snprintf(buffer, sizeof(buffer), "%s", random() % 2 ? "-" : "");
+				const int numDigits = 1 + int(random() % 30);
+				for (int digit = 0; digit < numDigits; ++digit) buffer[length++] = char('0' + random() % 10);
+				snprintf(buffer + length, sizeof(buffer) - length, "e%d", int(random() % 700) - 350);
+			}
+
+			const AnsicharArrayView view(buffer);
+			const double toDouble = view.ToDouble();
+			const double strtodValue = strtod(buffer, nullptr);
+			const float toFloat = view.ToFloat();
+			const float strtofValue = strtof(buffer, nullptr);
+			if (memcmp(&toDouble, &strtodValue, sizeof(double)) != 0 || memcmp(&toFloat, &strtofValue, sizeof(float)) != 0)
+			{
+				if (++numMismatches <= 5)
+				{
+					printf("  mismatch %s\n", buffer);
+				}
+			}
+		}
+		printf("Rounding  %zu random hard-case strings, %d mismatches against strtod/strtof\n", num, numMismatches);
+		return numMismatches;
+	}
+}
+
+
+
+int main(int argc, char** argv)
+{
+	const uint32_t numVertices = argc > 1 ? (uint32_t)std::max(1, atoi(argv[1])) : 200000u;
+	const ObjText obj = GenerateObj(numVertices);
+	printf("[Furud] OBJ text: %.1f MB, %zu reals, %zu indices\n\n", obj.text.size() / (1024.0 * 1024.0), obj.reals.size(), obj.integers.size());
+
+	int numFailures = 0;
+	numFailures += Compare<double>("ToDouble", "strtod", obj.reals, obj.realBytes,
+		[](const Token& token) { return AnsicharArrayView(token.data, token.size).ToDouble(); },
+		[](const Token& token) { return strtod(token.data, nullptr); });
+	numFailures += Compare<float>("ToFloat", "strtof", obj.reals, obj.realBytes,
+		[](const Token& token) { return AnsicharArrayView(token.data, token.size).ToFloat(); },
+		[](const Token& token) { return strtof(token.data, nullptr); });
+	numFailures += Compare<int64_t>("ToInt64", "strtoll", obj.integers, obj.integerBytes,
+		[](const Token& token) { return AnsicharArrayView(token.data, token.size).ToInt64(); },
+		[](const Token& token) { return (int64_t)strtoll(token.data, nullptr, 10); });
+	printf("\n");
+
+	numFailures += CheckRounding(2000000);
+	return numFailures;
+}
@@ -0,0 +1,128 @@
+//
+// ParallelSort.cpp
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Times IParallel::RadixSort and the comparison sort of IParallel::Sort against Concurrency::parallel_sort
+// and Concurrency::parallel_radixsort of the PPL, on uniform random 32/64-bit keys from 10^4 to 10^maxExponent,
+// and checks every result against std::sort. Run it on the multi-core machine the numbers are quoted for.
+//
+// Usage: ParallelSort [maxExponent] [numWorkers]
+//        maxExponent is 4 to 8 ( default 8 ), numWorkers defaults to the number of cores minus one.
+//        The exit code is the number of unsorted results.
+//
+#include <Furud.hpp>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+#if FURUD_OS_WIN
+#include <ppl.h>
+#endif
+
+import Furud.Platform.Thread.JobSystem;
+import Furud.Platform.Thread.Parallel;
+
+using namespace Furud;
+
+
+
+/** Benchmark. */
+namespace
+{
+	/** Uniform random keys, the same for every sort of the same size. */
+	template <typename K>
+	std::vector<K> GenerateKeys(size_t num)
+	{
+		std::mt19937_64 random(num);
+		std::vector<K> keys(num);
+		for (K& key : keys)
+		{
+			key = (K)random();
+		}
+		return keys;
+	}
+
+
+	/**
+	 * @brief    Returns the best time of a few rounds in milliseconds, each round sorts a fresh copy of `source`.
+	 *           The result of the last round is compared with `reference`.
+	 */
+	template <typename K, typename F>
+	double Time(const std::vector<K>& source, const std::vector<K>& reference, const F& sort, int& numFailures)
+	{
+		const int numRounds = source.size() <= 1000000 ? 5 : (source.size() <= 10000000 ? 3 : 1);
+		std::vector<K> keys(source.size());
+		double best = 1e30;
+		for (int round = 0; round < numRounds; ++round)
+		{
+			memcpy(keys.data(), source.data(), source.size() * sizeof(K));
+			const auto start = std::chrono::steady_clock::now();
+			sort(keys.data(), keys.data() + keys.size());
+			const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+			best = std::min(best, elapsed.count());
+		}
+		if (memcmp(keys.data(), reference.data(), keys.size() * sizeof(K)) != 0)
+		{
+			++numFailures;
+			printf("  unsorted result\n");
+		}
+		return best;
+	}
+
+
+	template <typename K>
+	int Compare(const char* name, size_t num)
+	{
+		const std::vector<K> source = GenerateKeys<K>(num);
+		std::vector<K> reference = source;
+		std::sort(reference.begin(), reference.end());
+
+		int numFailures = 0;
+		const double radix = Time(source, reference, [](K* first, K* last) { IParallel::RadixSort(first, last); }, numFailures);
+		const double comparison = Time(source, reference, [](K* first, K* last) { IParallel::Sort(first, last, std::less<K>{}); }, numFailures);
+#if FURUD_OS_WIN
+		const double pplSort = Time(source, reference, [](K* first, K* last) { Concurrency::parallel_sort(first, last); }, numFailures);
+		const double pplRadix = Time(source, reference, [](K* first, K* last) { Concurrency::parallel_radixsort(first, last); }, numFailures);
+		printf("%-4s %10zu %12.2f %12.2f %12.2f %12.2f\n", name, num, radix, comparison, pplSort, pplRadix);
+#else
+		const double serialSort = Time(source, reference, [](K* first, K* last) { std::sort(first, last); }, numFailures);
+		printf("%-4s %10zu %12.2f %12.2f %12.2f\n", name, num, radix, comparison, serialSort);
+#endif
+		return numFailures;
+	}
+}
+
+
+
+int main(int argc, char** argv)
+{
+	const int maxExponent = argc > 1 ? std::clamp(atoi(argv[1]), 4, 8) : 8;
+	IJobSystem::Init(argc > 2 ? (uint32_t)std::max(0, atoi(argv[2])) : 0u);
+
+	printf("[Furud] %u hardware threads, %u workers + main thread, best time in ms\n\n",
+		std::thread::hardware_concurrency(), IJobSystem::NumWorkers());
+#if FURUD_OS_WIN
+	printf("%-4s %10s %12s %12s %12s %12s\n", "key", "n", "RadixSort", "Sort(less)", "ppl sort", "ppl radix");
+#else
+	printf("%-4s %10s %12s %12s %12s\n", "key", "n", "RadixSort", "Sort(less)", "std::sort");
+#endif
+
+	int numFailures = 0;
+	size_t num = 10000;
+	for (int exponent = 4; exponent <= maxExponent; ++exponent, num *= 10)
+	{
+		numFailures += Compare<uint32_t>("u32", num);
+		numFailures += Compare<uint64_t>("u64", num);
+	}
+
+	IJobSystem::Shutdown();
+	return numFailures;
+}
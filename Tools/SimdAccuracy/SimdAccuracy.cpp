@@ -0,0 +1,440 @@
+//
+// SimdAccuracy.cpp
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Compares the vectorized transcendental functions of Vec4f and Vec8f with the C library in double precision,
+// and checks the error bounds documented in Platform.SIMD-Transcendental.ixx.
+//
+// Usage: SimdAccuracy [stride]
+//        Every stride-th float bit pattern is tested, stride 1 sweeps all 2^32 inputs ( default 17 ).
+//        The exit code is the number of functions exceeding their documented bound.
+//
+#include <Furud.hpp>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <random>
+
+import Furud.Platform.SIMD;
+
+using namespace Furud;
+
+
+
+/** Error metrics. */
+namespace
+{
+	/**
+	 * @brief    The error in units of the last place of the float nearest to the reference.
+	 *           Special values must match exactly, a miss counts as a huge error.
+	 */
+	double UlpError(float result, double reference)
+	{
+		if (isnan(reference))
+		{
+			return isnan(result) ? 0.0 : 1e9;
+		}
+
+		const float rounded = (float)reference;
+		if (isinf(rounded))
+		{
+			// An overflow may stop at FLT_MAX, which is half an ulp away.
+			if (isinf(result) && signbit(result) == signbit(rounded))
+			{
+				return 0.0;
+			}
+			return fabsf(result) == 3.40282347e38f ? 0.5 : 1e9;
+		}
+		if (isinf(result) || isnan(result))
+		{
+			return 1e9;
+		}
+
+		int exponent;
+		frexp(fabs(reference), &exponent);
+		const double ulp = ldexp(1.0, std::max(exponent - 24, -149));
+		return fabs((double)result - reference) / ulp;
+	}
+
+
+	enum class EMetric
+	{
+		/** Units in the last place. */
+		Ulp,
+
+		/** |result - reference|. */
+		Absolute,
+
+		/** |result - reference| / |reference|, zero and infinite references are skipped. */
+		Relative,
+	};
+
+
+	/**
+	 * @brief    The largest error of a function over the tested inputs, measured against its bound.
+	 */
+	struct Statistic
+	{
+		double maxRatio = 0.0;
+		double maxError = 0.0;
+		float worstX = 0.f;
+		float worstY = 0.f;
+		int64_t numTested = 0;
+
+		void Add(double error, double bound, float x, float y = 0.f)
+		{
+			++numTested;
+			if (error / bound > maxRatio)
+			{
+				maxRatio = error / bound;
+				maxError = error;
+				worstX = x;
+				worstY = y;
+			}
+		}
+	};
+
+
+	double Measure(EMetric metric, float result, double reference)
+	{
+		switch (metric)
+		{
+		case EMetric::Ulp:
+			return UlpError(result, reference);
+		case EMetric::Absolute:
+			return fabs((double)result - reference);
+		default:
+			if (reference == 0.0 || !isfinite(reference))
+			{
+				return 0.0;
+			}
+			return fabs((double)result - reference) / fabs(reference);
+		}
+	}
+
+
+	const char* MetricName(EMetric metric)
+	{
+		switch (metric)
+		{
+		case EMetric::Ulp:      return "ulp";
+		case EMetric::Absolute: return "abs";
+		default:                return "rel";
+		}
+	}
+
+
+	int32_t numFailures = 0;
+
+
+	void Report(const char* name, int32_t numLanes, EMetric metric, const Statistic& statistic)
+	{
+		const bool bPassed = statistic.maxRatio <= 1.0;
+		numFailures += bPassed ? 0 : 1;
+		printf("%-10s Vec%df  %s  max %-11.4g %s ( %5.1f%% of bound )  at x = %-15.9g y = %-15.9g n = %lld\n",
+			name, numLanes, bPassed ? "ok  " : "FAIL", statistic.maxError, MetricName(metric),
+			statistic.maxRatio * 100.0, statistic.worstX, statistic.worstY, (long long)statistic.numTested);
+	}
+}
+
+
+
+/** Unary functions, swept over the float bit patterns. */
+namespace
+{
+	/**
+	 * @brief    Tests a unary function on every stride-th float in [lo, hi], plus the special values.
+	 * @param    vectorized  -  Called as `vectorized(const float* in, float* out)` on NumLanes inputs.
+	 * @param    reference   -  The C library function in double precision.
+	 * @param    bound       -  The documented bound of the metric, called as `bound(x)`.
+	 */
+	template <int32_t NumLanes, typename TVectorized, typename TReference, typename TBound>
+	void TestUnary(const char* name, uint32_t stride, float lo, float hi, EMetric metric, TVectorized&& vectorized, TReference&& reference, TBound&& bound)
+	{
+		Statistic statistic;
+		alignas(32) float in[NumLanes];
+		alignas(32) float out[NumLanes];
+		int32_t count = 0;
+
+		const auto flush = [&]()
+		{
+			for (int32_t index = count; index < NumLanes; ++index)
+			{
+				in[index] = in[0];
+			}
+			vectorized(in, out);
+			for (int32_t index = 0; index < count; ++index)
+			{
+				const double expected = reference((double)in[index]);
+				statistic.Add(Measure(metric, out[index], expected), bound(in[index]), in[index]);
+			}
+			count = 0;
+		};
+
+		const auto push = [&](float x)
+		{
+			in[count++] = x;
+			if (count == NumLanes)
+			{
+				flush();
+			}
+		};
+
+		for (uint64_t bits = 0; bits <= UINT32_MAX; bits += stride)
+		{
+			float x;
+			const uint32_t pattern = (uint32_t)bits;
+			memcpy(&x, &pattern, sizeof(x));
+			if ((x >= lo && x <= hi) || (isnan(x) && isinf(hi)))
+			{
+				push(x);
+			}
+		}
+
+		const float specials[] = { 0.f, -0.f, 1.f, -1.f, INFINITY, -INFINITY, NAN, 1e-45f, -1e-45f, 1.17549435e-38f, 3.40282347e38f, -3.40282347e38f };
+		for (float x : specials)
+		{
+			if ((x >= lo && x <= hi) || isinf(hi))
+			{
+				push(x);
+			}
+		}
+		if (count > 0)
+		{
+			flush();
+		}
+
+		Report(name, NumLanes, metric, statistic);
+	}
+
+
+	/**
+	 * @brief    Tests a Vec4f and a Vec8f overload of the same function.
+	 */
+#define FURUD_TEST_UNARY(Name, Function, Lo, Hi, Metric, Reference, Bound)                                                              \
+	TestUnary<4>(Name, stride, Lo, Hi, Metric, [](const float* in, float* out) { Vec4f value; value.Load4(in); Function(value).Store4(out); }, \
+		Reference, Bound);                                                                                                               \
+	TestUnary<8>(Name, stride, Lo, Hi, Metric, [](const float* in, float* out) { Vec8f value; value.LoadUnaligned(in); Function(value).StoreUnaligned(out); }, \
+		Reference, Bound);
+}
+
+
+
+/** Binary functions, on random inputs. */
+namespace
+{
+	/** Random pairs covering huge, tiny, negative and integral operands. */
+	struct PairGenerator
+	{
+		std::mt19937 engine { 20240917u };
+
+		float Any()
+		{
+			const uint32_t bits = engine();
+			float x;
+			memcpy(&x, &bits, sizeof(x));
+			return x;
+		}
+
+		void Next(float& x, float& y)
+		{
+			switch (engine() % 4)
+			{
+			case 0:
+				x = Any();
+				y = Any();
+				break;
+			case 1:
+				x = ldexpf((float)(engine() % 100000) / 100000.f, (int32_t)(engine() % 40) - 20);
+				y = ((float)(engine() % 20000) - 10000.f) / 100.f;
+				break;
+			case 2:
+				x = -(float)(engine() % 50) / 7.f;
+				y = (float)((int32_t)(engine() % 60) - 30) * ((engine() & 1) ? 1.f : 0.5f);
+				break;
+			default:
+				x = (float)(engine() % 1000) / 500.f;
+				y = ((float)(engine() % 2000000) - 1000000.f) / 1000.f;
+				break;
+			}
+		}
+	};
+
+
+	/**
+	 * @brief    Tests a binary function on random pairs.
+	 * @param    accept  -  Whether a pair is in the documented domain, called as `accept(x, y)`.
+	 * @param    bound   -  The documented bound of the metric, called as `bound(x, y)`.
+	 */
+	template <int32_t NumLanes, typename TVectorized, typename TReference, typename TAccept, typename TBound>
+	void TestBinary(const char* name, int64_t numPairs, EMetric metric, TVectorized&& vectorized, TReference&& reference, TAccept&& accept, TBound&& bound)
+	{
+		Statistic statistic;
+		PairGenerator generator;
+		alignas(32) float xs[NumLanes];
+		alignas(32) float ys[NumLanes];
+		alignas(32) float out[NumLanes];
+
+		for (int64_t pair = 0; pair < numPairs; pair += NumLanes)
+		{
+			for (int32_t index = 0; index < NumLanes; ++index)
+			{
+				do
+				{
+					generator.Next(xs[index], ys[index]);
+				} while (!accept(xs[index], ys[index]));
+			}
+
+			vectorized(xs, ys, out);
+			for (int32_t index = 0; index < NumLanes; ++index)
+			{
+				const double expected = reference((double)xs[index], (double)ys[index]);
+				statistic.Add(Measure(metric, out[index], expected), bound(xs[index], ys[index]), xs[index], ys[index]);
+			}
+		}
+
+		Report(name, NumLanes, metric, statistic);
+	}
+
+
+#define FURUD_TEST_BINARY(Name, Function, Metric, Reference, Accept, Bound)                                                             \
+	TestBinary<4>(Name, numPairs, Metric, [](const float* xs, const float* ys, float* out)                                               \
+		{ Vec4f x, y; x.Load4(xs); y.Load4(ys); Function(x, y).Store4(out); }, Reference, Accept, Bound);                                \
+	TestBinary<8>(Name, numPairs, Metric, [](const float* xs, const float* ys, float* out)                                               \
+		{ Vec8f x, y; x.LoadUnaligned(xs); y.LoadUnaligned(ys); Function(x, y).StoreUnaligned(out); }, Reference, Accept, Bound);
+
+
+	/** Special values of pow and atan2 must match the C library exactly. */
+	void TestSpecialValues()
+	{
+		const float powX[] = { -0.f, 0.f, -0.f, 0.f, -1.f, -1.f, 1.f, NAN, -INFINITY, -INFINITY, -INFINITY, -2.f, -2.f, 0.5f, 2.f, -8.f, -0.f, 0.f, INFINITY };
+		const float powY[] = { -1.f, -1.f, 3.f, -0.5f, INFINITY, -INFINITY, NAN, 0.f, 3.f, -3.f, 1.5f, 0.5f, 3.f, INFINITY, -INFINITY, 1.f / 3.f, -1.3f, -INFINITY, -2.f };
+		const float atanY[] = { 0.f, -0.f, 0.f, -0.f, INFINITY, INFINITY, -INFINITY, 1.f, NAN };
+		const float atanX[] = { 0.f, 0.f, -0.f, -0.f, INFINITY, -INFINITY, -INFINITY, 0.f, 1.f };
+
+		const auto same = [](float result, float expected)
+		{
+			return (result == expected && signbit(result) == signbit(expected)) || (isnan(result) && isnan(expected));
+		};
+
+		int32_t numMismatches = 0;
+		for (size_t index = 0; index < sizeof(powX) / sizeof(float); ++index)
+		{
+			alignas(16) float out[4];
+			Pow(Vec4f(powX[index]), Vec4f(powY[index])).Store4(out);
+			if (!same(out[0], powf(powX[index], powY[index])))
+			{
+				printf("Pow(%g, %g) = %g, expected %g\n", powX[index], powY[index], out[0], powf(powX[index], powY[index]));
+				++numMismatches;
+			}
+		}
+		for (size_t index = 0; index < sizeof(atanX) / sizeof(float); ++index)
+		{
+			alignas(16) float out[4];
+			Atan2(Vec4f(atanY[index]), Vec4f(atanX[index])).Store4(out);
+			if (!same(out[0], atan2f(atanY[index], atanX[index])))
+			{
+				printf("Atan2(%g, %g) = %.9g, expected %.9g\n", atanY[index], atanX[index], out[0], atan2f(atanY[index], atanX[index]));
+				++numMismatches;
+			}
+		}
+
+		printf("%-10s         %s  %d mismatches\n", "Specials", numMismatches == 0 ? "ok  " : "FAIL", numMismatches);
+		numFailures += numMismatches == 0 ? 0 : 1;
+	}
+
+
+	/** Vec4i division must equal the scalar truncating division. */
+	void TestDivide(int64_t numPairs)
+	{
+		std::mt19937 engine { 5u };
+		int64_t numMismatches = 0;
+		for (int64_t pair = 0; pair < numPairs; pair += 4)
+		{
+			alignas(16) int32_t lhs[4];
+			alignas(16) int32_t rhs[4];
+			alignas(16) int32_t out[4];
+			for (int32_t index = 0; index < 4; ++index)
+			{
+				lhs[index] = (int32_t)engine();
+				rhs[index] = (int32_t)engine() >> (engine() % 31);
+				if (rhs[index] == 0 || (lhs[index] == INT32_MIN && rhs[index] == -1))
+				{
+					rhs[index] = 1;
+				}
+			}
+
+			Vec4i dividend, divisor;
+			dividend.Load4(lhs);
+			divisor.Load4(rhs);
+			(dividend / divisor).Store4(out);
+			for (int32_t index = 0; index < 4; ++index)
+			{
+				numMismatches += out[index] != lhs[index] / rhs[index];
+			}
+		}
+
+		printf("%-10s Vec4i  %s  %lld mismatches\n", "Divide", numMismatches == 0 ? "ok  " : "FAIL", (long long)numMismatches);
+		numFailures += numMismatches == 0 ? 0 : 1;
+	}
+}
+
+
+
+int main(int argc, char** argv)
+{
+	const uint32_t stride = argc > 1 ? (uint32_t)std::max(1, atoi(argv[1])) : 17u;
+	const int64_t numPairs = 4000000;
+	const float all = INFINITY;
+	const float normal = 1.17549435e-38f;
+
+	const auto constant = [](double value) { return [value](float) { return value; }; };
+	printf("[Furud] SIMD level: %s, stride %u\n\n", GetSimdLevelName(CompiledSimdLevel), stride);
+
+	// Precise functions, over the whole float range.
+	FURUD_TEST_UNARY("Sin",   Sin,   -all, all, EMetric::Ulp, [](double x) { return sin(x); },  constant(2.4));
+	FURUD_TEST_UNARY("Cos",   Cos,   -all, all, EMetric::Ulp, [](double x) { return cos(x); },  constant(2.4));
+	FURUD_TEST_UNARY("Exp",   Exp,   -all, all, EMetric::Ulp, [](double x) { return exp(x); },  constant(1.1));
+	FURUD_TEST_UNARY("Exp2",  Exp2,  -all, all, EMetric::Ulp, [](double x) { return exp2(x); }, constant(1.3));
+	FURUD_TEST_UNARY("Log",   Log,   -all, all, EMetric::Ulp, [](double x) { return log(x); },  constant(1.0));
+	FURUD_TEST_UNARY("Log2",  Log2,  -all, all, EMetric::Ulp, [](double x) { return log2(x); }, constant(1.5));
+
+	// Fast functions, over their documented domain.
+	FURUD_TEST_UNARY("FastSin",  FastSin,  -8192.f, 8192.f, EMetric::Absolute, [](double x) { return sin(x); }, constant(2e-6));
+	FURUD_TEST_UNARY("FastCos",  FastCos,  -8192.f, 8192.f, EMetric::Absolute, [](double x) { return cos(x); }, constant(2e-6));
+	FURUD_TEST_UNARY("FastExp",  FastExp,  -87.f, 88.f, EMetric::Relative, [](double x) { return exp(x); }, [](float x) { return 2e-7 + fabs(x) * 7.5e-8; });
+	FURUD_TEST_UNARY("FastExp2", FastExp2, -126.f, 127.f, EMetric::Relative, [](double x) { return exp2(x); }, constant(2e-7));
+	FURUD_TEST_UNARY("FastLog",  FastLog,  normal, 3.40282347e38f, EMetric::Relative, [](double x) { return log(x); }, constant(4e-7));
+	FURUD_TEST_UNARY("FastLog2", FastLog2, normal, 3.40282347e38f, EMetric::Relative, [](double x) { return log2(x); }, constant(4e-7));
+	printf("\n");
+
+	// Binary functions.
+	FURUD_TEST_BINARY("Pow", Pow, EMetric::Ulp,
+		[](double x, double y) { return pow(x, y); },
+		[](float, float) { return true; },
+		[](float, float) { return 1.0; });
+	FURUD_TEST_BINARY("Atan2", Atan2, EMetric::Ulp,
+		[](double y, double x) { return atan2(y, x); },
+		[](float, float) { return true; },
+		[](float, float) { return 2.5; });
+	FURUD_TEST_BINARY("FastPow", FastPow, EMetric::Relative,
+		[](double x, double y) { return pow(x, y); },
+		[](float x, float y) { return x >= 1.17549435e-38f && x < INFINITY && fabsf(y) <= 100.f && fabs(pow(x, y)) > 1e-30 && fabs(pow(x, y)) < 1e30; },
+		[](float x, float y) { return 4e-7 * std::max(1.0, fabs((double)y * log2((double)x))); });
+	FURUD_TEST_BINARY("FastAtan2", FastAtan2, EMetric::Absolute,
+		[](double y, double x) { return atan2(y, x); },
+		[](float y, float x) { return isfinite(x) && isfinite(y) && (x != 0.f || y != 0.f); },
+		[](float, float) { return 2e-6; });
+	printf("\n");
+
+	TestSpecialValues();
+	TestDivide(numPairs);
+
+	printf("\n%d failure(s)\n", numFailures);
+	return numFailures;
+}
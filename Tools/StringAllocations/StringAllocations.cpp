@@ -0,0 +1,237 @@
+//
+// StringAllocations.cpp
+//
+//       Copyright (c) Furud Engine. All rights reserved.
+//       @author FongZiSing
+//
+// Counts the allocator calls of TCharArray and times the construction of typical engine strings:
+// thread names, RHIBuffer debug names, asset and shader paths, built, appended, moved and cloned.
+// The allocator has the interface of TStringAllocator and counts every Alloc, Realloc and Free.
+//
+// Usage: StringAllocations [numIterations]
+//        Each workload builds its strings numIterations times ( default 200000 ).
+//        The exit code is the number of workloads that leak.
+//
+#include <Furud.hpp>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+import Furud.Platform.API.CharArray;
+
+using namespace Furud;
+
+
+
+/** Counting allocator. */
+namespace
+{
+	struct AllocationCounters
+	{
+		uint64_t numAllocs = 0;
+		uint64_t numReallocs = 0;
+		uint64_t numFrees = 0;
+		uint64_t numBytes = 0;
+		int64_t numLive = 0;
+	};
+
+	AllocationCounters counters;
+
+
+	/** Same growth and storage as TStringAllocator, with counters. */
+	template <typename TChar, typename TSize>
+	struct TCountingAllocator
+	{
+		static constexpr TSize CalculateCapacityGrowth(TSize capacity) noexcept
+		{
+			const TSize growth = 4 + capacity + ((capacity + 1) >> 1);
+			return growth > capacity ? growth : capacity;
+		}
+
+		furud_inline static void Free(TChar* oldData)
+		{
+			if (oldData != nullptr)
+			{
+				++counters.numFrees;
+				--counters.numLive;
+				delete[] oldData;
+			}
+		}
+
+		furud_inline static void Alloc(const TSize& inStorageSize, TChar** furud_restrict outData, TSize* furud_restrict outCapacity)
+		{
+			++counters.numAllocs;
+			++counters.numLive;
+			counters.numBytes += inStorageSize * sizeof(TChar);
+			*outData = new TChar[inStorageSize];
+			*outCapacity = inStorageSize;
+		}
+
+		furud_inline static void Realloc(TChar** furud_restrict inOutData, TSize* furud_restrict outCapacity, TSize newCapacity, TSize oldReservedSize)
+		{
+			++counters.numReallocs;
+			counters.numBytes += newCapacity * sizeof(TChar);
+			TChar* newData = nullptr;
+			if (newCapacity != 0)
+			{
+				++counters.numLive;
+				newData = new TChar[newCapacity];
+				if (oldReservedSize != 0)
+				{
+					memcpy(newData, *inOutData, std::min(newCapacity, oldReservedSize) * sizeof(TChar));
+				}
+			}
+			Free(*inOutData);
+			*inOutData = newData;
+			*outCapacity = newCapacity;
+		}
+	};
+
+
+	using NameArray = TAnsicharArray<TCountingAllocator<char, size_t>>;
+	using PathArray = TWidecharArray<TCountingAllocator<wchar_t, size_t>>;
+}
+
+
+
+/** Workloads, each returns the number of strings it built. */
+namespace
+{
+	/** Keeps the results alive. */
+	volatile size_t sink = 0;
+
+
+	/** The names given by JobSystem, AsyncIO, FileStream and Thread. */
+	size_t BuildThreadNames(uint32_t numIterations)
+	{
+		std::vector<NameArray> names;
+		names.reserve(64);
+		for (uint32_t iteration = 0; iteration < numIterations; ++iteration)
+		{
+			names.clear();
+			for (uint32_t index = 0; index < 16; ++index)
+			{
+				char name[32];
+				::snprintf(name, sizeof(name), "Furud Worker %u", index);
+				names.emplace_back(name);
+			}
+			names.emplace_back("Furud AsyncIO");
+			names.emplace_back("Furud FileFlusher");
+			names.emplace_back("Furud Thread");
+			sink = sink + names.back().Size();
+		}
+		return size_t(numIterations) * 19;
+	}
+
+
+	/** RHIBufferCreateInfo::name of the vertex, index, structured buffers and their upload heaps. */
+	size_t BuildBufferNames(uint32_t numIterations)
+	{
+		static const char* const meshes[] = { "boxGeo", "sphereGeo", "terrainChunk", "skyDome" };
+		for (uint32_t iteration = 0; iteration < numIterations; ++iteration)
+		{
+			const char* mesh = meshes[iteration % 4];
+
+			NameArray vertexName(mesh);
+			vertexName.Append(" VertexBuffer");
+			NameArray indexName(mesh);
+			indexName.Append(" IndexBuffer");
+
+			char name[48];
+			::snprintf(name, sizeof(name), "Instances %u", iteration % 1024);
+			NameArray structuredName(name);
+
+			NameArray uploaderName = vertexName.Clone();
+			uploaderName.Append(" Uploader");
+
+			sink = sink + vertexName.Size() + indexName.Size() + structuredName.Size() + uploaderName.Size();
+		}
+		return size_t(numIterations) * 4;
+	}
+
+
+	/** Short relative asset paths, built from a directory and a file name, then moved into a list. */
+	size_t BuildAssetPaths(uint32_t numIterations)
+	{
+		static const char* const files[] = { "box.obj", "grass.dds", "rock.dds", "hero.fbx" };
+		std::vector<NameArray> paths;
+		paths.reserve(4);
+		for (uint32_t iteration = 0; iteration < numIterations; ++iteration)
+		{
+			paths.clear();
+			for (const char* file : files)
+			{
+				NameArray path("Content/");
+				path.Append(file);
+				paths.push_back(std::move(path));
+			}
+			sink = sink + paths[iteration % 4].Size();
+		}
+		return size_t(numIterations) * 4;
+	}
+
+
+	/** Shader source paths, as passed to the D3D compiler. */
+	size_t BuildShaderPaths(uint32_t numIterations)
+	{
+		for (uint32_t iteration = 0; iteration < numIterations; ++iteration)
+		{
+			PathArray path(L"..\\Furud\\Sources\\Engine\\Renderer\\Shaders\\");
+			path.Append(iteration & 1 ? L"color.hlsl" : L"shadow.hlsl");
+			PathArray clone = path.Clone();
+			sink = sink + clone.Size();
+		}
+		return size_t(numIterations) * 2;
+	}
+}
+
+
+
+int main(int argc, char** argv)
+{
+	const uint32_t numIterations = argc > 1 ? (uint32_t)std::max(1, atoi(argv[1])) : 200000u;
+	printf("[Furud] sizeof(AnsicharArray) = %zu, sizeof(WidecharArray) = %zu, %u iterations\n\n",
+		sizeof(NameArray), sizeof(PathArray), numIterations);
+	printf("%-14s %10s %10s %10s %10s %12s %10s\n", "workload", "strings", "allocs", "reallocs", "frees", "bytes", "ns/string");
+
+	struct Workload
+	{
+		const char* name;
+		size_t (*function)(uint32_t);
+	};
+	const Workload workloads[] =
+	{
+		{ "thread names", BuildThreadNames },
+		{ "buffer names", BuildBufferNames },
+		{ "asset paths",  BuildAssetPaths  },
+		{ "shader paths", BuildShaderPaths },
+	};
+
+	int numLeaks = 0;
+	for (const Workload& workload : workloads)
+	{
+		// Warms up, then keeps the best of a few rounds, the counts are the same in every round.
+		workload.function(numIterations / 10 + 1);
+		double best = 1e30;
+		size_t numStrings = 0;
+		for (int round = 0; round < 5; ++round)
+		{
+			counters = {};
+			const auto start = std::chrono::steady_clock::now();
+			numStrings = workload.function(numIterations);
+			const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			best = std::min(best, elapsed.count());
+		}
+
+		printf("%-14s %10zu %10llu %10llu %10llu %12llu %10.1f\n", workload.name, numStrings,
+			(unsigned long long)counters.numAllocs, (unsigned long long)counters.numReallocs,
+			(unsigned long long)counters.numFrees, (unsigned long long)counters.numBytes, best * 1e9 / (double)numStrings);
+		numLeaks += counters.numLive != 0;
+	}
+	return numLeaks;
+}